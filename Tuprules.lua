@@ -131,6 +131,11 @@ LDFLAGS += CONFIG_DEBUGGING_INFORMATION_LINKING
 LDFLAGS += CONFIG_ARCHITECTURE_FLAGS
 LDFLAGS += "-Wl,--cref,--gc-sections"
 
+-- host's linker searches for archives passed as "-l:<path>" only in library paths
+if CONFIG_ARCHITECTURE_POSIX == "y" then
+	LDFLAGS += "-L."
+end	-- if CONFIG_ARCHITECTURE_POSIX == "y" then
+
 ------------------------------------------------------------------------------------------------------------------------
 -- "constants" with include paths
 ------------------------------------------------------------------------------------------------------------------------
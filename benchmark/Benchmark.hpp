@@ -0,0 +1,68 @@
+/**
+ * \file
+ * \brief Benchmark and BenchmarkGroup structs header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_BENCHMARK_HPP_
+#define BENCHMARK_BENCHMARK_HPP_
+
+#include "estd/ContiguousRange.hpp"
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/// range of samples
+using SamplesRange = estd::ContiguousRange<uint32_t>;
+
+/// Benchmark struct describes single benchmark
+struct Benchmark
+{
+	/**
+	 * \brief Type of benchmark's function.
+	 *
+	 * Function must fill each element of the range with one sample - the cost of single execution of measured
+	 * operation, in units described by cycleCounterUnit.
+	 *
+	 * \param [out] samples is a range of samples that will be filled
+	 *
+	 * \return true if the benchmark succeeded, false otherwise
+	 */
+
+	using Function = bool(SamplesRange samples);
+
+	/// name of benchmark, must not contain commas, as it is printed in CSV row without quoting
+	const char* name;
+
+	/// reference to function of benchmark
+	Function& function;
+};
+
+/// range of benchmarks
+using BenchmarkRange = estd::ContiguousRange<const Benchmark>;
+
+/// BenchmarkGroup struct is a group of benchmarks of single kernel primitive
+struct BenchmarkGroup
+{
+	/// name of group, must not contain commas, as it is printed in CSV row without quoting
+	const char* name;
+
+	/// range of benchmarks in this group
+	BenchmarkRange benchmarks;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_BENCHMARK_HPP_
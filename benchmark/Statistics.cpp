@@ -0,0 +1,70 @@
+/**
+ * \file
+ * \brief Statistics struct implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "Statistics.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets percentile of sorted samples with nearest-rank method.
+ *
+ * \param [in] samples is a range of sorted samples, must not be empty
+ * \param [in] percent is the percentage of samples which are not greater than returned value, [1; 100]
+ *
+ * \return requested percentile of \a samples
+ */
+
+uint32_t getPercentile(const SamplesRange samples, const size_t percent)
+{
+	const auto rank = (samples.size() * percent + 99) / 100;
+	return samples.begin()[rank - 1];
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public static functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+Statistics Statistics::calculate(const SamplesRange samples)
+{
+	std::sort(samples.begin(), samples.end());
+
+	uint64_t sum {};
+	for (const auto sample : samples)
+		sum += sample;
+
+	Statistics statistics;
+	statistics.min = *samples.begin();
+	statistics.mean = sum / samples.size();
+	statistics.max = *(samples.end() - 1);
+	statistics.percentile50 = getPercentile(samples, 50);
+	statistics.percentile90 = getPercentile(samples, 90);
+	statistics.percentile99 = getPercentile(samples, 99);
+	return statistics;
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \brief Statistics struct header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_STATISTICS_HPP_
+#define BENCHMARK_STATISTICS_HPP_
+
+#include "Benchmark.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/// Statistics struct holds statistics of samples collected by single benchmark
+struct Statistics
+{
+	/**
+	 * \brief Calculates statistics of samples.
+	 *
+	 * Percentiles are calculated with nearest-rank method.
+	 *
+	 * \note Samples are sorted in place.
+	 *
+	 * \param [in,out] samples is a range of samples, must not be empty
+	 *
+	 * \return statistics of \a samples
+	 */
+
+	static Statistics calculate(SamplesRange samples);
+
+	/// lowest sample
+	uint32_t min;
+
+	/// arithmetic mean of samples, rounded down
+	uint32_t mean;
+
+	/// highest sample
+	uint32_t max;
+
+	/// 50th percentile (median)
+	uint32_t percentile50;
+
+	/// 90th percentile
+	uint32_t percentile90;
+
+	/// 99th percentile
+	uint32_t percentile99;
+};
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_STATISTICS_HPP_
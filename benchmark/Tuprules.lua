@@ -0,0 +1,11 @@
+--
+-- file: Tuprules.lua
+--
+-- author: Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+--
+-- This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+-- distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+--
+
+-- start group of <objects> for benchmark application
+startObjectsGroup()
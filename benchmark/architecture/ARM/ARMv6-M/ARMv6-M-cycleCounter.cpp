@@ -0,0 +1,64 @@
+/**
+ * \file
+ * \brief Implementation of cycle counter for ARMv6-M, using SysTick and tick count
+ *
+ * ARMv6-M has no DWT's CYCCNT, so the value of cycle counter is calculated from the number of ticks and the current
+ * value of SysTick. The counter has the resolution of SysTick's clock.
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "cycleCounter.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const char cycleCounterUnit[] {"SysTick cycles"};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint32_t getCycleCount()
+{
+	const architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const uint32_t period = SysTick->LOAD + 1;
+	uint32_t value = SysTick->VAL;
+	auto tickCount = internal::getScheduler().getTickCount();
+	// SysTick already reloaded, but "tick" interrupt was not handled yet?
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)
+	{
+		value = SysTick->VAL;
+		++tickCount;
+	}
+
+	return tickCount * period + (period - 1 - value);
+}
+
+void initializeCycleCounter()
+{
+	// SysTick is already running
+}
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,46 @@
+/**
+ * \file
+ * \brief Definition of range of all groups of benchmarks
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "benchmarkGroups.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// array with pointers to all groups of benchmarks
+const BenchmarkGroup* const benchmarkGroups_[]
+{
+		&threadBenchmarks,
+		&semaphoreBenchmarks,
+		&mutexBenchmarks,
+		&fifoQueueBenchmarks,
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const BenchmarkGroupRange benchmarkGroups {benchmarkGroups_};
+
+}	// namespace benchmark
+
+}	// namespace distortos
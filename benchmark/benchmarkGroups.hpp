@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief Declarations of all groups of benchmarks
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_BENCHMARKGROUPS_HPP_
+#define BENCHMARK_BENCHMARKGROUPS_HPP_
+
+#include "Benchmark.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/// range of references to BenchmarkGroup objects
+using BenchmarkGroupRange = estd::ContiguousRange<const BenchmarkGroup* const>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// group of benchmarks of FifoQueue
+extern const BenchmarkGroup fifoQueueBenchmarks;
+
+/// group of benchmarks of Mutex
+extern const BenchmarkGroup mutexBenchmarks;
+
+/// group of benchmarks of Semaphore
+extern const BenchmarkGroup semaphoreBenchmarks;
+
+/// group of benchmarks of thread switching
+extern const BenchmarkGroup threadBenchmarks;
+
+/// range of all groups of benchmarks
+extern const BenchmarkGroupRange benchmarkGroups;
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_BENCHMARKGROUPS_HPP_
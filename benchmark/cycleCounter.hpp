@@ -0,0 +1,59 @@
+/**
+ * \file
+ * \brief Declarations of functions of cycle counter used by benchmarks
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef BENCHMARK_CYCLECOUNTER_HPP_
+#define BENCHMARK_CYCLECOUNTER_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// unit of values returned by getCycleCount()
+extern const char cycleCounterUnit[];
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets current value of cycle counter.
+ *
+ * The counter wraps around, so only differences of values which are not too far apart are meaningful.
+ *
+ * \note Architecture-specific, implemented for each supported architecture.
+ *
+ * \return current value of cycle counter, in units described by cycleCounterUnit
+ */
+
+uint32_t getCycleCount();
+
+/**
+ * \brief Initializes cycle counter.
+ *
+ * \note Architecture-specific, implemented for each supported architecture. Must be called before first use of
+ * getCycleCount().
+ */
+
+void initializeCycleCounter();
+
+}	// namespace benchmark
+
+}	// namespace distortos
+
+#endif	// BENCHMARK_CYCLECOUNTER_HPP_
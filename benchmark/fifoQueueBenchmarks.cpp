@@ -0,0 +1,215 @@
+/**
+ * \file
+ * \brief Benchmarks of FifoQueue
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "benchmarkGroups.hpp"
+
+#include "cycleCounter.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of elements transferred in each sample of batch benchmarks
+constexpr size_t batchSize {16};
+
+/// size of stack for helper thread, bytes
+constexpr size_t helperThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of FIFO queue used in benchmarks
+using TestFifoQueue = StaticFifoQueue<uint32_t, 1>;
+
+/// type of FIFO queue used in batch benchmarks
+using BatchFifoQueue = StaticFifoQueue<uint32_t, batchSize>;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures the cost of FifoQueue::push() followed by FifoQueue::pop() when no thread is waiting.
+ *
+ * \param [out] samples is a range of samples that will be filled
+ *
+ * \return true if the benchmark succeeded, false otherwise
+ */
+
+bool pushPop(const SamplesRange samples)
+{
+	TestFifoQueue fifoQueue;
+	for (auto& sample : samples)
+	{
+		uint32_t value {};
+		const auto start = getCycleCount();
+		const auto pushRet = fifoQueue.push(start);
+		const auto popRet = fifoQueue.pop(value);
+		sample = getCycleCount() - start;
+		if (pushRet != 0 || popRet != 0 || value != start)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Measures the cost of transferring batchSize elements with FifoQueue::push() and FifoQueue::pop() called for
+ * each element.
+ *
+ * Reference for pushNPopN().
+ *
+ * \param [out] samples is a range of samples that will be filled
+ *
+ * \return true if the benchmark succeeded, false otherwise
+ */
+
+bool pushPopBatch(const SamplesRange samples)
+{
+	BatchFifoQueue fifoQueue;
+	for (auto& sample : samples)
+	{
+		uint32_t values[batchSize] {};
+		int ret {};
+		const auto start = getCycleCount();
+		for (size_t i {}; i < batchSize; ++i)
+			ret |= fifoQueue.push(start + i);
+		for (auto& value : values)
+			ret |= fifoQueue.pop(value);
+		sample = getCycleCount() - start;
+		if (ret != 0 || values[0] != start || values[batchSize - 1] != start + batchSize - 1)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Measures the cost of transferring batchSize elements with single FifoQueue::pushN() and single
+ * FifoQueue::popN().
+ *
+ * \param [out] samples is a range of samples that will be filled
+ *
+ * \return true if the benchmark succeeded, false otherwise
+ */
+
+bool pushNPopN(const SamplesRange samples)
+{
+	BatchFifoQueue fifoQueue;
+	for (auto& sample : samples)
+	{
+		uint32_t pushedValues[batchSize];
+		uint32_t poppedValues[batchSize] {};
+		size_t pushedCount {};
+		size_t poppedCount {};
+		const auto start = getCycleCount();
+		for (size_t i {}; i < batchSize; ++i)
+			pushedValues[i] = start + i;
+		const auto pushRet = fifoQueue.pushN(pushedValues, batchSize, pushedCount);
+		const auto popRet = fifoQueue.popN(poppedValues, batchSize, poppedCount);
+		sample = getCycleCount() - start;
+		if (pushRet != 0 || popRet != 0 || pushedCount != batchSize || poppedCount != batchSize ||
+				poppedValues[0] != start || poppedValues[batchSize - 1] != start + batchSize - 1)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Helper thread for FifoQueue::push() -> FifoQueue::pop() benchmark.
+ *
+ * Pops the cycle count at which main thread called FifoQueue::push() and stores the time elapsed since that moment
+ * in each sample.
+ *
+ * \param [in] fifoQueue is a reference to FIFO queue to which main thread pushes the values
+ * \param [out] samples is a range of samples that will be filled
+ * \param [out] sharedRet is a reference to variable for storing first error code returned by FifoQueue::pop()
+ */
+
+void popThread(TestFifoQueue& fifoQueue, const SamplesRange samples, int& sharedRet)
+{
+	for (auto& sample : samples)
+	{
+		uint32_t start {};
+		const auto ret = fifoQueue.pop(start);
+		sample = getCycleCount() - start;
+		if (ret != 0 && sharedRet == 0)
+			sharedRet = ret;
+	}
+}
+
+/**
+ * \brief Measures the cost of FifoQueue::push() which unblocks higher priority thread waiting in FifoQueue::pop().
+ *
+ * \param [out] samples is a range of samples that will be filled
+ *
+ * \return true if the benchmark succeeded, false otherwise
+ */
+
+bool pushPopHandoff(const SamplesRange samples)
+{
+	TestFifoQueue fifoQueue;
+	int sharedRet {};
+	auto helperThread = makeDynamicThread({helperThreadStackSize, static_cast<uint8_t>(ThisThread::getPriority() + 1)},
+			popThread, std::ref(fifoQueue), samples, std::ref(sharedRet));
+	// helper thread has higher priority, so it blocks on the FIFO queue right away
+	if (helperThread.start() != 0)
+		return false;
+
+	for (size_t i {}; i < samples.size(); ++i)
+	{
+		const auto ret = fifoQueue.push(getCycleCount());
+		if (ret != 0 && sharedRet == 0)
+			sharedRet = ret;
+	}
+
+	return helperThread.join() == 0 && sharedRet == 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// array with all benchmarks of FifoQueue
+const Benchmark fifoQueueBenchmarks_[]
+{
+		{"push() + pop()", pushPop},
+		{"push() -> pop() handoff", pushPopHandoff},
+		{"16 x push() + 16 x pop()", pushPopBatch},
+		{"pushN() + popN() of 16", pushNPopN},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const BenchmarkGroup fifoQueueBenchmarks {"FifoQueue", BenchmarkRange{fifoQueueBenchmarks_}};
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,169 @@
+/**
+ * \file
+ * \brief Main code block of benchmark application.
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "benchmarkGroups.hpp"
+#include "cycleCounter.hpp"
+#include "Statistics.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include "distortos/ThisThread.hpp"
+
+#include <array>
+#include <memory>
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// result of single benchmark
+struct Result
+{
+	/// pointer to group of benchmark
+	const distortos::benchmark::BenchmarkGroup* group;
+
+	/// pointer to benchmark
+	const distortos::benchmark::Benchmark* benchmark;
+
+	/// statistics of samples, valid only if \a success is true
+	distortos::benchmark::Statistics statistics;
+
+	/// true if the benchmark succeeded, false otherwise
+	bool success;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// buffer for samples of single benchmark
+std::array<uint32_t, CONFIG_BENCHMARK_SAMPLES> samples;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Prints result as a line of CSV table.
+ *
+ * \param [in] result is a reference to printed result
+ */
+
+void printCsvRow(const Result& result)
+{
+	printf("%s: %s,%s,%u", result.group->name, result.benchmark->name, distortos::benchmark::cycleCounterUnit,
+			static_cast<unsigned int>(samples.size()));
+	if (result.success == false)
+	{
+		printf(",,,,,,\n");
+		return;
+	}
+
+	const auto& statistics = result.statistics;
+	printf(",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 ",%" PRIu32 "\n", statistics.min,
+			statistics.mean, statistics.max, statistics.percentile50, statistics.percentile90,
+			statistics.percentile99);
+}
+
+/**
+ * \brief Prints result as a row of human-readable table.
+ *
+ * \param [in] result is a reference to printed result
+ */
+
+void printTableRow(const Result& result)
+{
+	printf("%-32s", result.benchmark->name);
+	if (result.success == false)
+	{
+		printf(" failed\n");
+		return;
+	}
+
+	const auto& statistics = result.statistics;
+	printf(" %10" PRIu32 " %10" PRIu32 " %10" PRIu32 " %10" PRIu32 " %10" PRIu32 " %10" PRIu32 "\n", statistics.min,
+			statistics.mean, statistics.max, statistics.percentile50, statistics.percentile90,
+			statistics.percentile99);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Main code block of benchmark application
+ *
+ * Runs all benchmarks and prints their results to standard output - first as human-readable tables (one for each
+ * group of benchmarks), then as a machine-readable CSV table with a header line, which can be used to track changes
+ * between releases. On POSIX host the process exits when all benchmarks are done, returning EXIT_FAILURE if any of
+ * them failed.
+ */
+
+int main()
+{
+	using namespace distortos::benchmark;
+
+	initializeCycleCounter();
+
+	size_t totalBenchmarks {};
+	for (const auto group : benchmarkGroups)
+		totalBenchmarks += group->benchmarks.size();
+	const std::unique_ptr<Result[]> results {new Result[totalBenchmarks]};
+
+	printf("distortos benchmark - %u samples, unit: %s\n", static_cast<unsigned int>(samples.size()),
+			cycleCounterUnit);
+
+	auto result = results.get();
+	// "volatile" to allow examination of the value with debugger - the variable will not be optimized out
+	volatile bool success {true};
+	for (const auto group : benchmarkGroups)
+	{
+		printf("\n%-32s %10s %10s %10s %10s %10s %10s\n", group->name, "min", "mean", "max", "p50", "p90", "p99");
+
+		for (auto& benchmark : group->benchmarks)
+		{
+			const SamplesRange samplesRange {samples.begin(), samples.end()};
+			result->group = group;
+			result->benchmark = &benchmark;
+			result->success = benchmark.function(samplesRange);
+			if (result->success == true)
+				result->statistics = Statistics::calculate(samplesRange);
+			else
+				success = false;
+
+			printTableRow(*result);
+			++result;
+		}
+	}
+
+	printf("\nname,unit,samples,min,mean,max,p50,p90,p99\n");
+	for (size_t i {}; i < totalBenchmarks; ++i)
+		printCsvRow(results[i]);
+	fflush(stdout);
+
+#ifdef CONFIG_ARCHITECTURE_POSIX
+
+	return success == true ? EXIT_SUCCESS : EXIT_FAILURE;
+
+#endif	// def CONFIG_ARCHITECTURE_POSIX
+
+	while (1)
+		distortos::ThisThread::sleepFor(std::chrono::seconds{1});
+}
@@ -0,0 +1,155 @@
+/**
+ * \file
+ * \brief Benchmarks of Mutex
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "benchmarkGroups.hpp"
+
+#include "cycleCounter.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Mutex.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for helper thread, bytes
+constexpr size_t helperThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures the cost of Mutex::lock() followed by Mutex::unlock() when the mutex is not contended.
+ *
+ * \param [out] samples is a range of samples that will be filled
+ *
+ * \return true if the benchmark succeeded, false otherwise
+ */
+
+bool lockUnlock(const SamplesRange samples)
+{
+	Mutex mutex;
+	for (auto& sample : samples)
+	{
+		const auto start = getCycleCount();
+		const auto lockRet = mutex.lock();
+		const auto unlockRet = mutex.unlock();
+		sample = getCycleCount() - start;
+		if (lockRet != 0 || unlockRet != 0)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Helper thread for Mutex::unlock() -> Mutex::lock() benchmark.
+ *
+ * Locks the mutex held by the main thread and stores the time elapsed since \a start in each sample. After that the
+ * mutex is unlocked and the thread waits for the semaphore, which is posted by main thread once it locks the mutex
+ * again.
+ *
+ * \param [in] mutex is a reference to mutex held by the main thread
+ * \param [in] semaphore is a reference to semaphore posted by the main thread when the mutex is locked again
+ * \param [out] samples is a range of samples that will be filled
+ * \param [in] start is a reference to cycle count at which main thread called Mutex::unlock()
+ * \param [out] sharedRet is a reference to variable for storing first error code returned by any function
+ */
+
+void lockThread(Mutex& mutex, Semaphore& semaphore, const SamplesRange samples, const uint32_t& start,
+		int& sharedRet)
+{
+	for (auto& sample : samples)
+	{
+		const auto lockRet = mutex.lock();
+		sample = getCycleCount() - start;
+		const auto unlockRet = mutex.unlock();
+		const auto waitRet = semaphore.wait();
+		const auto ret = lockRet != 0 ? lockRet : unlockRet != 0 ? unlockRet : waitRet;
+		if (ret != 0 && sharedRet == 0)
+			sharedRet = ret;
+	}
+}
+
+/**
+ * \brief Measures the cost of Mutex::unlock() which passes the mutex to higher priority thread waiting in
+ * Mutex::lock().
+ *
+ * \param [out] samples is a range of samples that will be filled
+ *
+ * \return true if the benchmark succeeded, false otherwise
+ */
+
+bool unlockLockHandoff(const SamplesRange samples)
+{
+	Mutex mutex;
+	Semaphore semaphore {0};
+	uint32_t start {};
+	int sharedRet {};
+	auto helperThread = makeDynamicThread({helperThreadStackSize, static_cast<uint8_t>(ThisThread::getPriority() + 1)},
+			lockThread, std::ref(mutex), std::ref(semaphore), samples, std::cref(start), std::ref(sharedRet));
+
+	if (mutex.lock() != 0)
+		return false;
+
+	// helper thread has higher priority, so it blocks on the mutex right away
+	if (helperThread.start() != 0)
+	{
+		mutex.unlock();
+		return false;
+	}
+
+	for (size_t i {}; i < samples.size(); ++i)
+	{
+		start = getCycleCount();
+		mutex.unlock();
+		mutex.lock();
+		semaphore.post();
+	}
+
+	mutex.unlock();
+	return helperThread.join() == 0 && sharedRet == 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// array with all benchmarks of Mutex
+const Benchmark mutexBenchmarks_[]
+{
+		{"lock() + unlock()", lockUnlock},
+		{"unlock() -> lock() handoff", unlockLockHandoff},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const BenchmarkGroup mutexBenchmarks {"Mutex", BenchmarkRange{mutexBenchmarks_}};
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,137 @@
+/**
+ * \file
+ * \brief Benchmarks of Semaphore
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "benchmarkGroups.hpp"
+
+#include "cycleCounter.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for helper thread, bytes
+constexpr size_t helperThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures the cost of Semaphore::post() followed by Semaphore::tryWait() when no thread is waiting.
+ *
+ * \param [out] samples is a range of samples that will be filled
+ *
+ * \return true if the benchmark succeeded, false otherwise
+ */
+
+bool postTryWait(const SamplesRange samples)
+{
+	Semaphore semaphore {0};
+	for (auto& sample : samples)
+	{
+		const auto start = getCycleCount();
+		const auto postRet = semaphore.post();
+		const auto tryWaitRet = semaphore.tryWait();
+		sample = getCycleCount() - start;
+		if (postRet != 0 || tryWaitRet != 0)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Helper thread for Semaphore::post() -> Semaphore::wait() benchmark.
+ *
+ * Waits for the semaphore and stores the time elapsed since \a start in each sample.
+ *
+ * \param [in] semaphore is a reference to semaphore posted by the main thread
+ * \param [out] samples is a range of samples that will be filled
+ * \param [in] start is a reference to cycle count at which main thread called Semaphore::post()
+ * \param [out] sharedRet is a reference to variable for storing first error code returned by Semaphore::wait()
+ */
+
+void waitThread(Semaphore& semaphore, const SamplesRange samples, const uint32_t& start, int& sharedRet)
+{
+	for (auto& sample : samples)
+	{
+		const auto ret = semaphore.wait();
+		sample = getCycleCount() - start;
+		if (ret != 0 && sharedRet == 0)
+			sharedRet = ret;
+	}
+}
+
+/**
+ * \brief Measures the cost of Semaphore::post() which unblocks higher priority thread waiting in Semaphore::wait().
+ *
+ * \param [out] samples is a range of samples that will be filled
+ *
+ * \return true if the benchmark succeeded, false otherwise
+ */
+
+bool postWaitHandoff(const SamplesRange samples)
+{
+	Semaphore semaphore {0};
+	uint32_t start {};
+	int sharedRet {};
+	auto helperThread = makeDynamicThread({helperThreadStackSize, static_cast<uint8_t>(ThisThread::getPriority() + 1)},
+			waitThread, std::ref(semaphore), samples, std::cref(start), std::ref(sharedRet));
+	// helper thread has higher priority, so it blocks on the semaphore right away
+	if (helperThread.start() != 0)
+		return false;
+
+	for (size_t i {}; i < samples.size(); ++i)
+	{
+		start = getCycleCount();
+		const auto ret = semaphore.post();
+		if (ret != 0 && sharedRet == 0)
+			sharedRet = ret;
+	}
+
+	return helperThread.join() == 0 && sharedRet == 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// array with all benchmarks of Semaphore
+const Benchmark semaphoreBenchmarks_[]
+{
+		{"post() + tryWait()", postTryWait},
+		{"post() -> wait() handoff", postWaitHandoff},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const BenchmarkGroup semaphoreBenchmarks {"Semaphore", BenchmarkRange{semaphoreBenchmarks_}};
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -0,0 +1,212 @@
+/**
+ * \file
+ * \brief Benchmarks of thread switching
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "benchmarkGroups.hpp"
+
+#include "cycleCounter.hpp"
+
+#include "distortos/internal/scheduler/forceContextSwitch.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/RecyclingMemoryResource.hpp"
+#include "distortos/ThisThread.hpp"
+
+namespace distortos
+{
+
+namespace benchmark
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for helper thread, bytes
+constexpr size_t helperThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Measures the cost of reading the cycle counter, which is included in all other samples.
+ *
+ * \param [out] samples is a range of samples that will be filled
+ *
+ * \return always true
+ */
+
+bool cycleCounterOverhead(const SamplesRange samples)
+{
+	for (auto& sample : samples)
+	{
+		const auto start = getCycleCount();
+		sample = getCycleCount() - start;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Measures the cost of unconditional context switch which resumes the same thread.
+ *
+ * \param [out] samples is a range of samples that will be filled
+ *
+ * \return always true
+ */
+
+bool forcedContextSwitch(const SamplesRange samples)
+{
+	for (auto& sample : samples)
+	{
+		const auto start = getCycleCount();
+		internal::forceContextSwitch();
+		sample = getCycleCount() - start;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Helper thread for yield() benchmark.
+ *
+ * Stores the time elapsed since \a start in each sample, yielding back to the main thread after each one.
+ *
+ * \param [out] samples is a range of samples that will be filled
+ * \param [in] start is a reference to cycle count at which main thread called ThisThread::yield()
+ */
+
+void yieldThread(const SamplesRange samples, const uint32_t& start)
+{
+	for (auto& sample : samples)
+	{
+		sample = getCycleCount() - start;
+		ThisThread::yield();
+	}
+}
+
+/**
+ * \brief Measures the cost of ThisThread::yield() which switches to another thread with the same priority.
+ *
+ * \param [out] samples is a range of samples that will be filled
+ *
+ * \return true if the benchmark succeeded, false otherwise
+ */
+
+bool yieldToThread(const SamplesRange samples)
+{
+	uint32_t start {};
+	auto helperThread = makeDynamicThread({helperThreadStackSize, ThisThread::getPriority()}, yieldThread, samples,
+			std::cref(start));
+	if (helperThread.start() != 0)
+		return false;
+
+	for (size_t i {}; i < samples.size(); ++i)
+	{
+		start = getCycleCount();
+		ThisThread::yield();
+	}
+
+	return helperThread.join() == 0;
+}
+
+/**
+ * \brief Measures the cost of creating, starting, joining and destroying DynamicThread which allocates its storage from
+ * given memory resource.
+ *
+ * Helper thread has higher priority than the main thread, so each sample includes one execution of helper thread.
+ *
+ * \param [out] samples is a range of samples that will be filled
+ * \param [in] memoryResource is a reference to MemoryResource from which storage of threads will be allocated
+ *
+ * \return true if the benchmark succeeded, false otherwise
+ */
+
+bool spawnAndJoin(const SamplesRange samples, MemoryResource& memoryResource)
+{
+	const auto priority = static_cast<uint8_t>(ThisThread::getPriority() + 1);
+	for (auto& sample : samples)
+	{
+		const auto start = getCycleCount();
+		{
+			auto helperThread = makeAndStartDynamicThread(memoryResource, {helperThreadStackSize, priority}, []() {});
+			if (helperThread.join() != 0)
+				return false;
+		}
+		sample = getCycleCount() - start;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Measures the cost of creating, starting, joining and destroying DynamicThread with default memory resource.
+ *
+ * \param [out] samples is a range of samples that will be filled
+ *
+ * \return true if the benchmark succeeded, false otherwise
+ */
+
+bool spawnAndJoinWithDefaultResource(const SamplesRange samples)
+{
+	return spawnAndJoin(samples, getNewDeleteMemoryResource());
+}
+
+/**
+ * \brief Measures the cost of creating, starting, joining and destroying DynamicThread with RecyclingMemoryResource,
+ * which reuses storage of previous thread.
+ *
+ * \param [out] samples is a range of samples that will be filled
+ *
+ * \return true if the benchmark succeeded, false otherwise
+ */
+
+bool spawnAndJoinWithRecyclingResource(const SamplesRange samples)
+{
+	// stack, storage for signals and internal thread object
+	RecyclingMemoryResource recyclingMemoryResource {getNewDeleteMemoryResource(), 3};
+
+	// warm-up - fill the cache with storage of one thread
+	uint32_t warmUpSample;
+	if (spawnAndJoin(SamplesRange{warmUpSample}, recyclingMemoryResource) == false)
+		return false;
+
+	return spawnAndJoin(samples, recyclingMemoryResource);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// array with all benchmarks of thread switching
+const Benchmark threadBenchmarks_[]
+{
+		{"getCycleCount() overhead", cycleCounterOverhead},
+		{"forced context switch", forcedContextSwitch},
+		{"yield() to thread", yieldToThread},
+		{"spawn and join DynamicThread", spawnAndJoinWithDefaultResource},
+		{"spawn and join DynamicThread with recycled storage", spawnAndJoinWithRecyclingResource},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const BenchmarkGroup threadBenchmarks {"Thread", BenchmarkRange{threadBenchmarks_}};
+
+}	// namespace benchmark
+
+}	// namespace distortos
@@ -336,6 +336,7 @@ CONFIG_ARCHITECTURE_FLAGS="-mcpu=cortex-m4 -mthumb -mfloat-abi=hard -mfpu=fpv4-s
 # ARMv7-M architecture options
 #
 CONFIG_ARCHITECTURE_ARMV7_M_KERNEL_BASEPRI=0
+# CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE is not set
 # CONFIG_ARCHITECTURE_ARM_CORTEX_M3 is not set
 CONFIG_ARCHITECTURE_ARM_CORTEX_M4=y
 # CONFIG_ARCHITECTURE_ARM_CORTEX_M7 is not set
@@ -348,6 +349,9 @@ CONFIG_ARCHITECTURE_INCLUDES="source/architecture/ARM/ARMv6-M-ARMv7-M/include"
 #
 CONFIG_ARCHITECTURE_FPU=y
 CONFIG_ARCHITECTURE_HAS_FPU=y
+CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS=y
+CONFIG_ARCHITECTURE_HAS_MPU=y
+CONFIG_ARCHITECTURE_STACK_GUARD_SIZE=0
 CONFIG_ARCHITECTURE_ARM=y
 # CONFIG_CHIP_HAS_LFBGA100 is not set
 # CONFIG_CHIP_HAS_LFBGA144 is not set
@@ -408,13 +412,26 @@ CONFIG_CHIP_LQFP144=y
 # CONFIG_CHIP_WLCSP143 is not set
 # CONFIG_CHIP_WLCSP168 is not set
 CONFIG_CHIP_PACKAGE="LQFP144"
+CONFIG_CHIP_HAS_PROFILER_TIMER=y
 
 #
 # Scheduler configuration
 #
 CONFIG_TICK_FREQUENCY=1000
 CONFIG_ROUND_ROBIN_FREQUENCY=10
+CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE=y
+CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE=y
+# CONFIG_TICKLESS_IDLE_ENABLE is not set
+CONFIG_IDLE_WAKE_UP_LATENCY_LIMIT=0
+CONFIG_SOFTWARE_TIMER_SORTED_LIST=y
+# CONFIG_SOFTWARE_TIMER_TIMING_WHEEL is not set
+# CONFIG_SOFTWARE_TIMER_THREAD_ENABLE is not set
 CONFIG_THREAD_DETACH_ENABLE=y
+# CONFIG_STATISTICS_RUN_TIME_ENABLE is not set
+# CONFIG_TLSF_HEAP_ENABLE is not set
+CONFIG_STACK_PAINTING_ENABLE=y
+CONFIG_STACK_PAINTING_PATTERN=0xed419f25
+# CONFIG_PROFILER_ENABLE is not set
 
 #
 # main() thread options
@@ -428,6 +445,7 @@ CONFIG_MAIN_THREAD_SIGNAL_ACTIONS=10
 #
 # Applications configuration
 #
+# CONFIG_BENCHMARK_APPLICATION_ENABLE is not set
 CONFIG_TEST_APPLICATION_ENABLE=y
 
 #
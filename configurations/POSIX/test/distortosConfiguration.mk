@@ -0,0 +1,156 @@
+#
+# Automatically generated file; DO NOT EDIT.
+# Configuration
+#
+
+#
+# Board, chip & architecture configuration
+#
+# CONFIG_CHIP_STM32 is not set
+CONFIG_CHIP_POSIX=y
+CONFIG_BOARD_CUSTOM=y
+
+#
+# Generic board options
+#
+CONFIG_BOARD_TOTAL_BUTTONS=0
+CONFIG_BOARD_TOTAL_LEDS=0
+CONFIG_BOARD="Custom"
+CONFIG_CHIP="POSIX"
+CONFIG_CHIP_INCLUDES=""
+
+#
+# Generic chip options
+#
+
+#
+# POSIX architecture options
+#
+CONFIG_TOOLCHAIN_PREFIX=""
+CONFIG_ARCHITECTURE_FLAGS=""
+CONFIG_ARCHITECTURE_POSIX_THREAD_STACK_SIZE=65536
+CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION=y
+CONFIG_ARCHITECTURE_INCLUDES="source/architecture/POSIX/include"
+
+#
+# Generic architecture options
+#
+# CONFIG_ARCHITECTURE_HAS_FPU is not set
+CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS=y
+# CONFIG_ARCHITECTURE_HAS_MPU is not set
+CONFIG_ARCHITECTURE_STACK_GUARD_SIZE=0
+# CONFIG_ARCHITECTURE_ARM is not set
+CONFIG_ARCHITECTURE_POSIX=y
+# CONFIG_CHIP_HAS_LFBGA100 is not set
+# CONFIG_CHIP_HAS_LFBGA144 is not set
+# CONFIG_CHIP_HAS_LQFP32 is not set
+# CONFIG_CHIP_HAS_LQFP48 is not set
+# CONFIG_CHIP_HAS_LQFP64 is not set
+CONFIG_CHIP_HAS_LQFP100=y
+# CONFIG_CHIP_HAS_LQFP144 is not set
+# CONFIG_CHIP_HAS_LQFP176 is not set
+# CONFIG_CHIP_HAS_LQFP208 is not set
+# CONFIG_CHIP_HAS_TFBGA64 is not set
+# CONFIG_CHIP_HAS_TFBGA216 is not set
+# CONFIG_CHIP_HAS_TSSOP20 is not set
+# CONFIG_CHIP_HAS_UFBGA64 is not set
+# CONFIG_CHIP_HAS_UFBGA100 is not set
+# CONFIG_CHIP_HAS_UFBGA144 is not set
+# CONFIG_CHIP_HAS_UFBGA169 is not set
+# CONFIG_CHIP_HAS_UFBGA176 is not set
+# CONFIG_CHIP_HAS_UFQFPN28 is not set
+# CONFIG_CHIP_HAS_UFQFPN32 is not set
+# CONFIG_CHIP_HAS_UFQFPN48 is not set
+# CONFIG_CHIP_HAS_VFQFPN36 is not set
+# CONFIG_CHIP_HAS_WLCSP25 is not set
+# CONFIG_CHIP_HAS_WLCSP36 is not set
+# CONFIG_CHIP_HAS_WLCSP49 is not set
+# CONFIG_CHIP_HAS_WLCSP64 is not set
+# CONFIG_CHIP_HAS_WLCSP81 is not set
+# CONFIG_CHIP_HAS_WLCSP90 is not set
+# CONFIG_CHIP_HAS_WLCSP143 is not set
+# CONFIG_CHIP_HAS_WLCSP168 is not set
+# CONFIG_CHIP_LFBGA100 is not set
+# CONFIG_CHIP_LFBGA144 is not set
+# CONFIG_CHIP_LQFP32 is not set
+# CONFIG_CHIP_LQFP48 is not set
+# CONFIG_CHIP_LQFP64 is not set
+# CONFIG_CHIP_LQFP100 is not set
+# CONFIG_CHIP_LQFP144 is not set
+# CONFIG_CHIP_LQFP176 is not set
+# CONFIG_CHIP_LQFP208 is not set
+# CONFIG_CHIP_TFBGA64 is not set
+# CONFIG_CHIP_TFBGA216 is not set
+# CONFIG_CHIP_TSSOP20 is not set
+# CONFIG_CHIP_UFBGA64 is not set
+# CONFIG_CHIP_UFBGA100 is not set
+# CONFIG_CHIP_UFBGA144 is not set
+# CONFIG_CHIP_UFBGA169 is not set
+# CONFIG_CHIP_UFBGA176 is not set
+# CONFIG_CHIP_UFQFPN28 is not set
+# CONFIG_CHIP_UFQFPN32 is not set
+# CONFIG_CHIP_UFQFPN48 is not set
+# CONFIG_CHIP_VFQFPN36 is not set
+# CONFIG_CHIP_WLCSP25 is not set
+# CONFIG_CHIP_WLCSP36 is not set
+# CONFIG_CHIP_WLCSP49 is not set
+# CONFIG_CHIP_WLCSP64 is not set
+# CONFIG_CHIP_WLCSP81 is not set
+# CONFIG_CHIP_WLCSP90 is not set
+# CONFIG_CHIP_WLCSP143 is not set
+# CONFIG_CHIP_WLCSP168 is not set
+CONFIG_CHIP_PACKAGE=""
+CONFIG_CHIP_HAS_PROFILER_TIMER=y
+
+#
+# Scheduler configuration
+#
+CONFIG_TICK_FREQUENCY=250
+CONFIG_ROUND_ROBIN_FREQUENCY=10
+CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE=y
+CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE=y
+CONFIG_TICKLESS_IDLE_ENABLE=y
+CONFIG_IDLE_WAKE_UP_LATENCY_LIMIT=0
+# CONFIG_SOFTWARE_TIMER_SORTED_LIST is not set
+CONFIG_SOFTWARE_TIMER_TIMING_WHEEL=y
+CONFIG_SOFTWARE_TIMER_TIMING_WHEEL_LEVELS=3
+CONFIG_SOFTWARE_TIMER_TIMING_WHEEL_SLOT_BITS=2
+CONFIG_SOFTWARE_TIMER_THREAD_ENABLE=y
+CONFIG_SOFTWARE_TIMER_THREAD_PRIORITY=255
+CONFIG_SOFTWARE_TIMER_THREAD_STACK_SIZE=1024
+CONFIG_THREAD_DETACH_ENABLE=y
+CONFIG_STATISTICS_RUN_TIME_ENABLE=y
+CONFIG_TRACE_ENABLE=y
+CONFIG_TRACE_BUFFER_EVENTS=1024
+CONFIG_PROFILER_ENABLE=y
+CONFIG_PROFILER_FREQUENCY=997
+CONFIG_PROFILER_BUFFER_SAMPLES=1024
+
+#
+# main() thread options
+#
+CONFIG_MAIN_THREAD_STACK_SIZE=4096
+CONFIG_MAIN_THREAD_PRIORITY=127
+CONFIG_MAIN_THREAD_CAN_RECEIVE_SIGNALS=y
+CONFIG_MAIN_THREAD_QUEUED_SIGNALS=10
+CONFIG_MAIN_THREAD_SIGNAL_ACTIONS=10
+
+#
+# Applications configuration
+#
+# CONFIG_BENCHMARK_APPLICATION_ENABLE is not set
+CONFIG_TEST_APPLICATION_ENABLE=y
+
+#
+# Build configuration
+#
+# CONFIG_BUILD_OPTIMIZATION_O0 is not set
+# CONFIG_BUILD_OPTIMIZATION_O1 is not set
+CONFIG_BUILD_OPTIMIZATION_O2=y
+# CONFIG_BUILD_OPTIMIZATION_O3 is not set
+# CONFIG_BUILD_OPTIMIZATION_OS is not set
+# CONFIG_BUILD_OPTIMIZATION_OG is not set
+CONFIG_DEBUGGING_INFORMATION_ENABLE=y
+CONFIG_BUILD_OPTIMIZATION="-O2"
+CONFIG_DEBUGGING_INFORMATION_COMPILATION="-g -ggdb3"
+CONFIG_DEBUGGING_INFORMATION_LINKING="-g"
@@ -2,7 +2,7 @@
  * \file
  * \brief ConditionVariable class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -43,7 +43,8 @@ public:
 	 */
 
 	constexpr ConditionVariable() :
-			blockedList_{}
+			blockedList_{},
+			mutex_{}
 	{
 
 	}
@@ -57,7 +58,8 @@ public:
 	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_cond_signal.html
 	 *
 	 * Unblocks all threads waiting on this condition variable. The notifying thread does not need to hold the same
-	 * mutex as the one held by the waiting thread(s).
+	 * mutex as the one held by the waiting thread(s). If that mutex is currently locked, waiting threads are moved
+	 * directly to the list of threads blocked on the mutex, so they are not woken up only to block again.
 	 */
 
 	void notifyAll();
@@ -71,7 +73,8 @@ public:
 	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_cond_signal.html
 	 *
 	 * Unblocks one thread waiting on this condition variable. The notifying thread does not need to hold the same
-	 * mutex as the one held by the waiting thread(s).
+	 * mutex as the one held by the waiting thread(s). If that mutex is currently locked, waiting thread is moved
+	 * directly to the list of threads blocked on the mutex, so it is not woken up only to block again.
 	 */
 
 	void notifyOne();
@@ -269,8 +272,27 @@ public:
 
 private:
 
+	/**
+	 * \brief Tries to move thread blocked on this condition variable to the list of threads blocked on mutex.
+	 *
+	 * If the mutex associated with waiting threads is locked by another thread, the thread is moved directly to the
+	 * list of threads blocked on that mutex with internal::MutexControlBlock::requeue() ("wait morphing").
+	 *
+	 * \attention interrupts must be masked
+	 *
+	 * \param [in] iterator is the iterator which points to thread blocked on this condition variable
+	 *
+	 * \return true if the thread was moved to the list of threads blocked on mutex, false if it must be unblocked
+	 */
+
+	bool requeue(internal::ThreadList::iterator iterator);
+
 	/// ThreadControlBlock objects blocked on this condition variable
 	internal::ThreadList blockedList_;
+
+	/// pointer to mutex associated with threads blocked on this condition variable (valid only if blockedList_ is not
+	/// empty), nullptr if these threads use different mutexes
+	Mutex* mutex_;
 };
 
 template<typename Predicate>
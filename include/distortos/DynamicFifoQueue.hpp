@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicFifoQueue class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,7 @@
 #define INCLUDE_DISTORTOS_DYNAMICFIFOQUEUE_HPP_
 
 #include "FifoQueue.hpp"
+#include "MemoryResource.hpp"
 
 #include "distortos/internal/memory/storageDeleter.hpp"
 
@@ -41,12 +42,27 @@ public:
 	 * \param [in] queueSize is the maximum number of elements in queue
 	 */
 
-	explicit DynamicFifoQueue(size_t queueSize);
+	explicit DynamicFifoQueue(const size_t queueSize) :
+			DynamicFifoQueue{getNewDeleteMemoryResource(), queueSize}
+	{
+
+	}
+
+	/**
+	 * \brief DynamicFifoQueue's constructor
+	 *
+	 * \param [in] memoryResource is a reference to MemoryResource from which storage for queue's contents will be
+	 * allocated
+	 * \param [in] queueSize is the maximum number of elements in queue
+	 */
+
+	DynamicFifoQueue(MemoryResource& memoryResource, size_t queueSize);
 };
 
 template<typename T>
-DynamicFifoQueue<T>::DynamicFifoQueue(const size_t queueSize) :
-		FifoQueue<T>{{new Storage[queueSize], internal::storageDeleter<Storage>}, queueSize}
+DynamicFifoQueue<T>::DynamicFifoQueue(MemoryResource& memoryResource, const size_t queueSize) :
+		FifoQueue<T>{{static_cast<Storage*>(internal::allocateStorage(memoryResource, sizeof(Storage) * queueSize)),
+				internal::storageDeleter<void>}, queueSize}
 {
 
 }
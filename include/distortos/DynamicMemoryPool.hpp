@@ -0,0 +1,55 @@
+/**
+ * \file
+ * \brief DynamicMemoryPool class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DYNAMICMEMORYPOOL_HPP_
+#define INCLUDE_DISTORTOS_DYNAMICMEMORYPOOL_HPP_
+
+#include "MemoryPool.hpp"
+#include "MemoryResource.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief DynamicMemoryPool class is a variant of MemoryPool that has dynamic storage for blocks.
+ *
+ * Storage is allocated only once, in the constructor, so allocation of blocks doesn't use the heap.
+ *
+ * \ingroup memory
+ */
+
+class DynamicMemoryPool : public MemoryPool
+{
+public:
+
+	/**
+	 * \brief DynamicMemoryPool's constructor
+	 *
+	 * \param [in] blockSize is the size of single block, bytes
+	 * \param [in] blocks is the number of blocks in the pool
+	 */
+
+	DynamicMemoryPool(size_t blockSize, size_t blocks);
+
+	/**
+	 * \brief DynamicMemoryPool's constructor
+	 *
+	 * \param [in] memoryResource is a reference to MemoryResource from which storage for blocks will be allocated
+	 * \param [in] blockSize is the size of single block, bytes
+	 * \param [in] blocks is the number of blocks in the pool
+	 */
+
+	DynamicMemoryPool(MemoryResource& memoryResource, size_t blockSize, size_t blocks);
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DYNAMICMEMORYPOOL_HPP_
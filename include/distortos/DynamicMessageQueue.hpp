@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicMessageQueue class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,7 @@
 #ifndef INCLUDE_DISTORTOS_DYNAMICMESSAGEQUEUE_HPP_
 #define INCLUDE_DISTORTOS_DYNAMICMESSAGEQUEUE_HPP_
 
+#include "MemoryResource.hpp"
 #include "MessageQueue.hpp"
 
 #include "distortos/internal/memory/storageDeleter.hpp"
@@ -44,13 +45,29 @@ public:
 	 * \param [in] queueSize is the maximum number of elements in queue
 	 */
 
-	explicit DynamicMessageQueue(size_t queueSize);
+	explicit DynamicMessageQueue(const size_t queueSize) :
+			DynamicMessageQueue{getNewDeleteMemoryResource(), queueSize}
+	{
+
+	}
+
+	/**
+	 * \brief DynamicMessageQueue's constructor
+	 *
+	 * \param [in] memoryResource is a reference to MemoryResource from which storage for queue's contents will be
+	 * allocated
+	 * \param [in] queueSize is the maximum number of elements in queue
+	 */
+
+	DynamicMessageQueue(MemoryResource& memoryResource, size_t queueSize);
 };
 
 template<typename T>
-DynamicMessageQueue<T>::DynamicMessageQueue(const size_t queueSize) :
-		MessageQueue<T>{{new EntryStorage[queueSize], internal::storageDeleter<EntryStorage>},
-				{new ValueStorage[queueSize], internal::storageDeleter<ValueStorage>}, queueSize}
+DynamicMessageQueue<T>::DynamicMessageQueue(MemoryResource& memoryResource, const size_t queueSize) :
+		MessageQueue<T>{{static_cast<EntryStorage*>(internal::allocateStorage(memoryResource,
+				sizeof(EntryStorage) * queueSize)), internal::storageDeleter<EntryStorage>},
+				{static_cast<ValueStorage*>(internal::allocateStorage(memoryResource,
+				sizeof(ValueStorage) * queueSize)), internal::storageDeleter<void>}, queueSize}
 {
 
 }
@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicRawFifoQueue class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,7 @@
 #ifndef INCLUDE_DISTORTOS_DYNAMICRAWFIFOQUEUE_HPP_
 #define INCLUDE_DISTORTOS_DYNAMICRAWFIFOQUEUE_HPP_
 
+#include "MemoryResource.hpp"
 #include "RawFifoQueue.hpp"
 
 namespace distortos
@@ -35,6 +36,17 @@ public:
 	 */
 
 	DynamicRawFifoQueue(size_t elementSize, size_t queueSize);
+
+	/**
+	 * \brief DynamicRawFifoQueue's constructor
+	 *
+	 * \param [in] memoryResource is a reference to MemoryResource from which storage for queue's contents will be
+	 * allocated
+	 * \param [in] elementSize is the size of single queue element, bytes
+	 * \param [in] queueSize is the maximum number of elements in queue
+	 */
+
+	DynamicRawFifoQueue(MemoryResource& memoryResource, size_t elementSize, size_t queueSize);
 };
 
 }	// namespace distortos
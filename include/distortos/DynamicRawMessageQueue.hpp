@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicRawMessageQueue class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,7 @@
 #ifndef INCLUDE_DISTORTOS_DYNAMICRAWMESSAGEQUEUE_HPP_
 #define INCLUDE_DISTORTOS_DYNAMICRAWMESSAGEQUEUE_HPP_
 
+#include "distortos/MemoryResource.hpp"
 #include "distortos/RawMessageQueue.hpp"
 
 namespace distortos
@@ -35,6 +36,17 @@ public:
 	 */
 
 	DynamicRawMessageQueue(size_t elementSize, size_t queueSize);
+
+	/**
+	 * \brief DynamicRawMessageQueue's constructor
+	 *
+	 * \param [in] memoryResource is a reference to MemoryResource from which storage for queue's contents will be
+	 * allocated
+	 * \param [in] elementSize is the size of single queue element, bytes
+	 * \param [in] queueSize is the maximum number of elements in queue
+	 */
+
+	DynamicRawMessageQueue(MemoryResource& memoryResource, size_t elementSize, size_t queueSize);
 };
 
 }	// namespace distortos
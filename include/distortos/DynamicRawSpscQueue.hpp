@@ -0,0 +1,54 @@
+/**
+ * \file
+ * \brief DynamicRawSpscQueue class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_DYNAMICRAWSPSCQUEUE_HPP_
+#define INCLUDE_DISTORTOS_DYNAMICRAWSPSCQUEUE_HPP_
+
+#include "MemoryResource.hpp"
+#include "RawSpscQueue.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief DynamicRawSpscQueue class is a variant of RawSpscQueue that has dynamic storage for queue's contents.
+ *
+ * \ingroup queues
+ */
+
+class DynamicRawSpscQueue : public RawSpscQueue
+{
+public:
+
+	/**
+	 * \brief DynamicRawSpscQueue's constructor
+	 *
+	 * \param [in] elementSize is the size of single queue element, bytes
+	 * \param [in] queueSize is the maximum number of elements in queue
+	 */
+
+	DynamicRawSpscQueue(size_t elementSize, size_t queueSize);
+
+	/**
+	 * \brief DynamicRawSpscQueue's constructor
+	 *
+	 * \param [in] memoryResource is a reference to MemoryResource from which storage for queue's contents will be
+	 * allocated
+	 * \param [in] elementSize is the size of single queue element, bytes
+	 * \param [in] queueSize is the maximum number of elements in queue
+	 */
+
+	DynamicRawSpscQueue(MemoryResource& memoryResource, size_t elementSize, size_t queueSize);
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_DYNAMICRAWSPSCQUEUE_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicSignalsReceiver class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,7 @@
 #ifndef INCLUDE_DISTORTOS_DYNAMICSIGNALSRECEIVER_HPP_
 #define INCLUDE_DISTORTOS_DYNAMICSIGNALSRECEIVER_HPP_
 
+#include "distortos/MemoryResource.hpp"
 #include "distortos/SignalInformationQueueWrapper.hpp"
 #include "distortos/SignalsCatcher.hpp"
 #include "distortos/SignalsReceiver.hpp"
@@ -38,6 +39,18 @@ public:
 
 	DynamicSignalsReceiver(size_t queuedSignals, size_t signalActions);
 
+	/**
+	 * \brief DynamicSignalsReceiver's constructor
+	 *
+	 * \param [in] memoryResource is a reference to MemoryResource from which storage for queued signals and
+	 * SignalAction associations will be allocated
+	 * \param [in] queuedSignals is the max number of queued signals, 0 to disable queuing of signals for this receiver
+	 * \param [in] signalActions is the max number of different SignalAction objects, 0 to disable catching of signals
+	 * for this receiver
+	 */
+
+	DynamicSignalsReceiver(MemoryResource& memoryResource, size_t queuedSignals, size_t signalActions);
+
 private:
 
 	/// internal SignalInformationQueueWrapper object
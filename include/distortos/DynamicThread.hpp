@@ -51,8 +51,14 @@ public:
 	 */
 
 	template<typename Function, typename... Args>
-	DynamicThread(size_t stackSize, bool canReceiveSignals, size_t queuedSignals, size_t signalActions,
-			uint8_t priority, SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args);
+	DynamicThread(const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
+			const size_t signalActions, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
+			Function&& function, Args&&... args) :
+			DynamicThread{getNewDeleteMemoryResource(), stackSize, canReceiveSignals, queuedSignals, signalActions,
+					priority, schedulingPolicy, std::forward<Function>(function), std::forward<Args>(args)...}
+	{
+
+	}
 
 	/**
 	 * \brief DynamicThread's constructor
@@ -74,6 +80,55 @@ public:
 
 	}
 
+	/**
+	 * \brief DynamicThread's constructor
+	 *
+	 * \tparam Function is the function that will be executed in separate thread
+	 * \tparam Args are the arguments for \a Function
+	 *
+	 * \param [in] memoryResource is a reference to MemoryResource from which stack, storage for signals and internal
+	 * thread object will be allocated
+	 * \param [in] stackSize is the size of stack, bytes
+	 * \param [in] canReceiveSignals selects whether reception of signals is enabled (true) or disabled (false) for this
+	 * thread
+	 * \param [in] queuedSignals is the max number of queued signals for this thread, relevant only if
+	 * \a canReceiveSignals == true, 0 to disable queuing of signals for this thread
+	 * \param [in] signalActions is the max number of different SignalAction objects for this thread, relevant only if
+	 * \a canReceiveSignals == true, 0 to disable catching of signals for this thread
+	 * \param [in] priority is the thread's priority, 0 - lowest, UINT8_MAX - highest
+	 * \param [in] schedulingPolicy is the scheduling policy of the thread
+	 * \param [in] function is a function that will be executed in separate thread
+	 * \param [in] args are arguments for \a function
+	 */
+
+	template<typename Function, typename... Args>
+	DynamicThread(MemoryResource& memoryResource, size_t stackSize, bool canReceiveSignals, size_t queuedSignals,
+			size_t signalActions, uint8_t priority, SchedulingPolicy schedulingPolicy, Function&& function,
+			Args&&... args);
+
+	/**
+	 * \brief DynamicThread's constructor
+	 *
+	 * \tparam Function is the function that will be executed in separate thread
+	 * \tparam Args are the arguments for \a Function
+	 *
+	 * \param [in] memoryResource is a reference to MemoryResource from which stack, storage for signals and internal
+	 * thread object will be allocated
+	 * \param [in] parameters is a DynamicThreadParameters struct with thread parameters
+	 * \param [in] function is a function that will be executed in separate thread
+	 * \param [in] args are arguments for \a function
+	 */
+
+	template<typename Function, typename... Args>
+	DynamicThread(MemoryResource& memoryResource, const DynamicThreadParameters parameters, Function&& function,
+			Args&&... args) :
+			DynamicThread{memoryResource, parameters.stackSize, parameters.canReceiveSignals, parameters.queuedSignals,
+					parameters.signalActions, parameters.priority, parameters.schedulingPolicy,
+					std::forward<Function>(function), std::forward<Args>(args)...}
+	{
+
+	}
+
 	/**
 	 * \brief DynamicThread's destructor
 	 */
@@ -141,6 +196,32 @@ public:
 
 	uint8_t getPriority() const override;
 
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	/**
+	 * \return time for which this thread was running, in units of statistics::getRunTimeFrequency(), 0 if internal
+	 * thread object was detached
+	 *
+	 * \ingroup statistics
+	 */
+
+	uint64_t getRunTime() const override;
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+
+	/**
+	 * \return max number of bytes of stack which were used by this thread (high-water mark), 0 if internal thread
+	 * object was detached
+	 *
+	 * \ingroup statistics
+	 */
+
+	size_t getStackHighWaterMark() const override;
+
+#endif	// def CONFIG_STACK_PAINTING_ENABLE
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
@@ -280,6 +361,38 @@ DynamicThread makeDynamicThread(const size_t stackSize, const bool canReceiveSig
 			std::forward<Function>(function), std::forward<Args>(args)...};
 }
 
+/**
+ * \brief Helper factory function to make DynamicThread object
+ *
+ * \tparam Function is the function that will be executed
+ * \tparam Args are the arguments for \a Function
+ *
+ * \param [in] memoryResource is a reference to MemoryResource from which stack, storage for signals and (if thread
+ * detachment is enabled) internal thread object will be allocated
+ * \param [in] stackSize is the size of stack, bytes
+ * \param [in] canReceiveSignals selects whether reception of signals is enabled (true) or disabled (false) for this
+ * thread
+ * \param [in] queuedSignals is the max number of queued signals for this thread, relevant only if
+ * \a canReceiveSignals == true, 0 to disable queuing of signals for this thread
+ * \param [in] signalActions is the max number of different SignalAction objects for this thread, relevant only if
+ * \a canReceiveSignals == true, 0 to disable catching of signals for this thread
+ * \param [in] priority is the thread's priority, 0 - lowest, UINT8_MAX - highest
+ * \param [in] schedulingPolicy is the scheduling policy of the thread
+ * \param [in] function is a function that will be executed in separate thread
+ * \param [in] args are arguments for \a function
+ *
+ * \return DynamicThread object
+ */
+
+template<typename Function, typename... Args>
+DynamicThread makeDynamicThread(MemoryResource& memoryResource, const size_t stackSize, const bool canReceiveSignals,
+		const size_t queuedSignals, const size_t signalActions, const uint8_t priority,
+		const SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args)
+{
+	return {memoryResource, stackSize, canReceiveSignals, queuedSignals, signalActions, priority, schedulingPolicy,
+			std::forward<Function>(function), std::forward<Args>(args)...};
+}
+
 /**
  * \brief Helper factory function to make DynamicThread object
  *
@@ -299,6 +412,28 @@ DynamicThread makeDynamicThread(const DynamicThreadParameters parameters, Functi
 	return {parameters, std::forward<Function>(function), std::forward<Args>(args)...};
 }
 
+/**
+ * \brief Helper factory function to make DynamicThread object
+ *
+ * \tparam Function is the function that will be executed
+ * \tparam Args are the arguments for \a Function
+ *
+ * \param [in] memoryResource is a reference to MemoryResource from which stack, storage for signals and (if thread
+ * detachment is enabled) internal thread object will be allocated
+ * \param [in] parameters is a DynamicThreadParameters struct with thread parameters
+ * \param [in] function is a function that will be executed in separate thread
+ * \param [in] args are arguments for \a function
+ *
+ * \return DynamicThread object
+ */
+
+template<typename Function, typename... Args>
+DynamicThread makeDynamicThread(MemoryResource& memoryResource, const DynamicThreadParameters parameters,
+		Function&& function, Args&&... args)
+{
+	return {memoryResource, parameters, std::forward<Function>(function), std::forward<Args>(args)...};
+}
+
 /**
  * \brief Helper factory function to make and start DynamicThread object
  *
@@ -331,6 +466,40 @@ DynamicThread makeAndStartDynamicThread(const size_t stackSize, const bool canRe
 	return thread;
 }
 
+/**
+ * \brief Helper factory function to make and start DynamicThread object
+ *
+ * \tparam Function is the function that will be executed
+ * \tparam Args are the arguments for \a Function
+ *
+ * \param [in] memoryResource is a reference to MemoryResource from which stack, storage for signals and (if thread
+ * detachment is enabled) internal thread object will be allocated
+ * \param [in] stackSize is the size of stack, bytes
+ * \param [in] canReceiveSignals selects whether reception of signals is enabled (true) or disabled (false) for this
+ * thread
+ * \param [in] queuedSignals is the max number of queued signals for this thread, relevant only if
+ * \a canReceiveSignals == true, 0 to disable queuing of signals for this thread
+ * \param [in] signalActions is the max number of different SignalAction objects for this thread, relevant only if
+ * \a canReceiveSignals == true, 0 to disable catching of signals for this thread
+ * \param [in] priority is the thread's priority, 0 - lowest, UINT8_MAX - highest
+ * \param [in] schedulingPolicy is the scheduling policy of the thread
+ * \param [in] function is a function that will be executed in separate thread
+ * \param [in] args are arguments for \a function
+ *
+ * \return DynamicThread object
+ */
+
+template<typename Function, typename... Args>
+DynamicThread makeAndStartDynamicThread(MemoryResource& memoryResource, const size_t stackSize,
+		const bool canReceiveSignals, const size_t queuedSignals, const size_t signalActions, const uint8_t priority,
+		const SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args)
+{
+	auto thread = makeDynamicThread(memoryResource, stackSize, canReceiveSignals, queuedSignals, signalActions,
+			priority, schedulingPolicy, std::forward<Function>(function), std::forward<Args>(args)...);
+	thread.start();	/// \todo make sure this never fails
+	return thread;
+}
+
 /**
  * \brief Helper factory function to make and start DynamicThread object
  *
@@ -352,16 +521,42 @@ DynamicThread makeAndStartDynamicThread(const DynamicThreadParameters parameters
 	return thread;
 }
 
+/**
+ * \brief Helper factory function to make and start DynamicThread object
+ *
+ * \tparam Function is the function that will be executed
+ * \tparam Args are the arguments for \a Function
+ *
+ * \param [in] memoryResource is a reference to MemoryResource from which stack, storage for signals and (if thread
+ * detachment is enabled) internal thread object will be allocated
+ * \param [in] parameters is a DynamicThreadParameters struct with thread parameters
+ * \param [in] function is a function that will be executed in separate thread
+ * \param [in] args are arguments for \a function
+ *
+ * \return DynamicThread object
+ */
+
+template<typename Function, typename... Args>
+DynamicThread makeAndStartDynamicThread(MemoryResource& memoryResource, const DynamicThreadParameters parameters,
+		Function&& function, Args&&... args)
+{
+	auto thread = makeDynamicThread(memoryResource, parameters, std::forward<Function>(function),
+			std::forward<Args>(args)...);
+	thread.start();	/// \todo make sure this never fails
+	return thread;
+}
+
 /// \}
 
 #ifdef CONFIG_THREAD_DETACH_ENABLE
 
 template<typename Function, typename... Args>
-DynamicThread::DynamicThread(const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
-		const size_t signalActions, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
-		Function&& function, Args&&... args) :
-		detachableThread_{new internal::DynamicThreadBase{stackSize, canReceiveSignals, queuedSignals, signalActions,
-				priority, schedulingPolicy, *this, std::forward<Function>(function), std::forward<Args>(args)...}}
+DynamicThread::DynamicThread(MemoryResource& memoryResource, const size_t stackSize, const bool canReceiveSignals,
+		const size_t queuedSignals, const size_t signalActions, const uint8_t priority,
+		const SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args) :
+		detachableThread_{new (memoryResource) internal::DynamicThreadBase{memoryResource, stackSize,
+				canReceiveSignals, queuedSignals, signalActions, priority, schedulingPolicy, *this,
+				std::forward<Function>(function), std::forward<Args>(args)...}}
 {
 
 }
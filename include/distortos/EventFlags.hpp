@@ -0,0 +1,382 @@
+/**
+ * \file
+ * \brief EventFlags class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_EVENTFLAGS_HPP_
+#define INCLUDE_DISTORTOS_EVENTFLAGS_HPP_
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+#include "distortos/TickClock.hpp"
+
+#include <utility>
+
+namespace distortos
+{
+
+/**
+ * \brief EventFlags is a synchronization primitive with a 32-bit word of flags, which can be waited for by threads.
+ *
+ * Flags may be set and cleared by threads and interrupts. Threads may wait until any (waitAny() and its variants) or
+ * all (waitAll() and its variants) of selected flags are set, optionally clearing these flags when the wait is
+ * satisfied. Each call to set() checks conditions of all waiting threads in a single pass, in the order of their
+ * current effective priorities (FIFO within the group of threads with the same priority), so when flags are cleared
+ * automatically by a thread with higher priority, they are not delivered to threads with lower priority.
+ *
+ * \ingroup synchronization
+ */
+
+class EventFlags
+{
+public:
+
+	/// type of flags
+	using Value = uint32_t;
+
+	/**
+	 * \brief EventFlags constructor
+	 *
+	 * \param [in] value is the initial value of flags, default - all flags cleared
+	 */
+
+	constexpr explicit EventFlags(const Value value = {}) :
+			blockedList_{},
+			value_{value}
+	{
+
+	}
+
+	/**
+	 * \brief EventFlags destructor
+	 *
+	 * It is safe to destroy event flags upon which no threads are currently blocked. The effect of destroying event
+	 * flags upon which other threads are currently blocked is system error.
+	 */
+
+	~EventFlags()
+	{
+
+	}
+
+	/**
+	 * \brief Clears selected flags.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] bitmask is the bitmask of flags that will be cleared
+	 *
+	 * \return value of flags before they were cleared
+	 */
+
+	Value clear(Value bitmask);
+
+	/**
+	 * \return current value of flags
+	 */
+
+	Value get() const
+	{
+		return value_;
+	}
+
+	/**
+	 * \brief Sets selected flags.
+	 *
+	 * After the flags are set, conditions of all threads waiting for these event flags are checked - threads with
+	 * satisfied conditions are unblocked and flags which they selected for automatic clearing are cleared.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] bitmask is the bitmask of flags that will be set
+	 *
+	 * \return value of flags before they were set
+	 */
+
+	Value set(Value bitmask);
+
+	/**
+	 * \brief Tries to wait until all selected flags are set.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] bitmask is the bitmask of flags that will be waited for
+	 * \param [in] autoClear selects whether the flags selected by \a bitmask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags (at the moment the wait
+	 * was satisfied, before automatic clearing); error codes:
+	 * - EAGAIN - not all selected flags are set;
+	 * - EINVAL - \a bitmask is zero;
+	 */
+
+	std::pair<int, Value> tryWaitAll(Value bitmask, bool autoClear = {});
+
+	/**
+	 * \brief Tries to wait until all selected flags are set for given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] bitmask is the bitmask of flags that will be waited for
+	 * \param [in] autoClear selects whether the flags selected by \a bitmask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags (at the moment the wait
+	 * was satisfied, before automatic clearing); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 * - ETIMEDOUT - not all selected flags were set before the specified timeout expired;
+	 */
+
+	std::pair<int, Value> tryWaitAllFor(TickClock::duration duration, Value bitmask, bool autoClear = {});
+
+	/**
+	 * \brief Tries to wait until all selected flags are set for given duration of time.
+	 *
+	 * Template variant of tryWaitAllFor(TickClock::duration duration, Value bitmask, bool autoClear).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] bitmask is the bitmask of flags that will be waited for
+	 * \param [in] autoClear selects whether the flags selected by \a bitmask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags (at the moment the wait
+	 * was satisfied, before automatic clearing); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 * - ETIMEDOUT - not all selected flags were set before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, Value> tryWaitAllFor(const std::chrono::duration<Rep, Period> duration, const Value bitmask,
+			const bool autoClear = {})
+	{
+		return tryWaitAllFor(std::chrono::duration_cast<TickClock::duration>(duration), bitmask, autoClear);
+	}
+
+	/**
+	 * \brief Tries to wait until all selected flags are set until given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] bitmask is the bitmask of flags that will be waited for
+	 * \param [in] autoClear selects whether the flags selected by \a bitmask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags (at the moment the wait
+	 * was satisfied, before automatic clearing); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 * - ETIMEDOUT - not all selected flags were set before the specified timeout expired;
+	 */
+
+	std::pair<int, Value> tryWaitAllUntil(TickClock::time_point timePoint, Value bitmask, bool autoClear = {});
+
+	/**
+	 * \brief Tries to wait until all selected flags are set until given time point.
+	 *
+	 * Template variant of tryWaitAllUntil(TickClock::time_point timePoint, Value bitmask, bool autoClear).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] bitmask is the bitmask of flags that will be waited for
+	 * \param [in] autoClear selects whether the flags selected by \a bitmask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags (at the moment the wait
+	 * was satisfied, before automatic clearing); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 * - ETIMEDOUT - not all selected flags were set before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	std::pair<int, Value> tryWaitAllUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const Value bitmask, const bool autoClear = {})
+	{
+		return tryWaitAllUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), bitmask, autoClear);
+	}
+
+	/**
+	 * \brief Tries to wait until any of selected flags is set.
+	 *
+	 * \note This function can be used from interrupt context.
+	 *
+	 * \param [in] bitmask is the bitmask of flags that will be waited for
+	 * \param [in] autoClear selects whether the flags selected by \a bitmask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags (at the moment the wait
+	 * was satisfied, before automatic clearing); error codes:
+	 * - EAGAIN - none of selected flags is set;
+	 * - EINVAL - \a bitmask is zero;
+	 */
+
+	std::pair<int, Value> tryWaitAny(Value bitmask, bool autoClear = {});
+
+	/**
+	 * \brief Tries to wait until any of selected flags is set for given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] bitmask is the bitmask of flags that will be waited for
+	 * \param [in] autoClear selects whether the flags selected by \a bitmask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags (at the moment the wait
+	 * was satisfied, before automatic clearing); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 * - ETIMEDOUT - none of selected flags was set before the specified timeout expired;
+	 */
+
+	std::pair<int, Value> tryWaitAnyFor(TickClock::duration duration, Value bitmask, bool autoClear = {});
+
+	/**
+	 * \brief Tries to wait until any of selected flags is set for given duration of time.
+	 *
+	 * Template variant of tryWaitAnyFor(TickClock::duration duration, Value bitmask, bool autoClear).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated
+	 * \param [in] bitmask is the bitmask of flags that will be waited for
+	 * \param [in] autoClear selects whether the flags selected by \a bitmask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags (at the moment the wait
+	 * was satisfied, before automatic clearing); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 * - ETIMEDOUT - none of selected flags was set before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	std::pair<int, Value> tryWaitAnyFor(const std::chrono::duration<Rep, Period> duration, const Value bitmask,
+			const bool autoClear = {})
+	{
+		return tryWaitAnyFor(std::chrono::duration_cast<TickClock::duration>(duration), bitmask, autoClear);
+	}
+
+	/**
+	 * \brief Tries to wait until any of selected flags is set until given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] bitmask is the bitmask of flags that will be waited for
+	 * \param [in] autoClear selects whether the flags selected by \a bitmask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags (at the moment the wait
+	 * was satisfied, before automatic clearing); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 * - ETIMEDOUT - none of selected flags was set before the specified timeout expired;
+	 */
+
+	std::pair<int, Value> tryWaitAnyUntil(TickClock::time_point timePoint, Value bitmask, bool autoClear = {});
+
+	/**
+	 * \brief Tries to wait until any of selected flags is set until given time point.
+	 *
+	 * Template variant of tryWaitAnyUntil(TickClock::time_point timePoint, Value bitmask, bool autoClear).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated
+	 * \param [in] bitmask is the bitmask of flags that will be waited for
+	 * \param [in] autoClear selects whether the flags selected by \a bitmask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags (at the moment the wait
+	 * was satisfied, before automatic clearing); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 * - ETIMEDOUT - none of selected flags was set before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	std::pair<int, Value> tryWaitAnyUntil(const std::chrono::time_point<TickClock, Duration> timePoint,
+			const Value bitmask, const bool autoClear = {})
+	{
+		return tryWaitAnyUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), bitmask, autoClear);
+	}
+
+	/**
+	 * \brief Waits until all selected flags are set.
+	 *
+	 * \param [in] bitmask is the bitmask of flags that will be waited for
+	 * \param [in] autoClear selects whether the flags selected by \a bitmask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags (at the moment the wait
+	 * was satisfied, before automatic clearing); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 */
+
+	std::pair<int, Value> waitAll(Value bitmask, bool autoClear = {});
+
+	/**
+	 * \brief Waits until any of selected flags is set.
+	 *
+	 * \param [in] bitmask is the bitmask of flags that will be waited for
+	 * \param [in] autoClear selects whether the flags selected by \a bitmask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags (at the moment the wait
+	 * was satisfied, before automatic clearing); error codes:
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 */
+
+	std::pair<int, Value> waitAny(Value bitmask, bool autoClear = {});
+
+	EventFlags(const EventFlags&) = delete;
+	EventFlags(EventFlags&&) = default;
+	const EventFlags& operator=(const EventFlags&) = delete;
+	EventFlags& operator=(EventFlags&&) = delete;
+
+private:
+
+	/**
+	 * \brief Implementation of all wait functions.
+	 *
+	 * \param [in] bitmask is the bitmask of flags that will be waited for
+	 * \param [in] all selects whether all (true) or any (false) of selected flags must be set to satisfy the wait
+	 * \param [in] autoClear selects whether the flags selected by \a bitmask will be cleared when the wait is satisfied
+	 * (true) or not (false)
+	 * \param [in] nonBlocking selects whether this function operates in blocking mode (false) or non-blocking mode
+	 * (true)
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated, used only if blocking mode
+	 * is selected, nullptr to block without timeout
+	 *
+	 * \return pair with return code (0 on success, error code otherwise) and value of flags (at the moment the wait
+	 * was satisfied, before automatic clearing); error codes:
+	 * - EAGAIN - wait is not satisfied and non-blocking mode was selected;
+	 * - EINTR - the wait was interrupted by an unmasked, caught signal;
+	 * - EINVAL - \a bitmask is zero;
+	 * - ETIMEDOUT - wait was not satisfied before specified \a timePoint;
+	 */
+
+	std::pair<int, Value> waitImplementation(Value bitmask, bool all, bool autoClear, bool nonBlocking,
+			const TickClock::time_point* timePoint);
+
+	/// ThreadControlBlock objects blocked on these event flags, sorted in descending order of effective priority, each
+	/// with internal::EventFlagsWaiter describing its wait
+	internal::ThreadList blockedList_;
+
+	/// current value of flags
+	Value value_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_EVENTFLAGS_HPP_
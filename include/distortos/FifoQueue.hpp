@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueue class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,7 @@
 
 #include "distortos/internal/synchronization/FifoQueueBase.hpp"
 #include "distortos/internal/synchronization/BoundQueueFunctor.hpp"
+#include "distortos/internal/synchronization/BoundQueueRangeFunctor.hpp"
 #include "distortos/internal/synchronization/CopyConstructQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MoveConstructQueueFunctor.hpp"
 #include "distortos/internal/synchronization/SwapPopQueueFunctor.hpp"
@@ -115,6 +116,29 @@ public:
 		return popInternal(semaphoreWaitFunctor, value);
 	}
 
+	/**
+	 * \brief Pops up to \a maxCount oldest elements from the queue.
+	 *
+	 * All elements are popped in one critical section. Only the wait for the first element may block, other elements
+	 * are popped only if they are immediately available.
+	 *
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the max number of elements that will be popped, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int popN(T* const values, const size_t maxCount, size_t& count)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return popNInternal(semaphoreWaitFunctor, values, maxCount, count);
+	}
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -148,6 +172,29 @@ public:
 		return pushInternal(semaphoreWaitFunctor, std::move(value));
 	}
 
+	/**
+	 * \brief Pushes up to \a maxCount elements to the queue.
+	 *
+	 * All elements are pushed in one critical section. Only the wait for the first free slot may block, other
+	 * elements are pushed only if there are free slots immediately available.
+	 *
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] maxCount is the max number of elements that will be pushed, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pushN(const T* const values, const size_t maxCount, size_t& count)
+	{
+		const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+		return pushNInternal(semaphoreWaitFunctor, values, maxCount, count);
+	}
+
 #if DISTORTOS_FIFOQUEUE_EMPLACE_SUPPORTED == 1 || DOXYGEN == 1
 
 	/**
@@ -325,6 +372,130 @@ public:
 		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), value);
 	}
 
+	/**
+	 * \brief Tries to pop up to \a maxCount oldest elements from the queue.
+	 *
+	 * All elements are popped in one critical section. Only the wait for the first element may block, other elements
+	 * are popped only if they are immediately available.
+	 *
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the max number of elements that will be popped, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPopN(T* const values, const size_t maxCount, size_t& count)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return popNInternal(semaphoreTryWaitFunctor, values, maxCount, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a maxCount oldest elements from the queue for a given duration of time.
+	 *
+	 * All elements are popped in one critical section. Only the wait for the first element may block, other elements
+	 * are popped only if they are immediately available.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping any element
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the max number of elements that will be popped, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPopNFor(const TickClock::duration duration, T* const values, const size_t maxCount, size_t& count)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return popNInternal(semaphoreTryWaitForFunctor, values, maxCount, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a maxCount oldest elements from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopNFor(TickClock::duration, T*, size_t, size_t&).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping any element
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the max number of elements that will be popped, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPopNFor(const std::chrono::duration<Rep, Period> duration, T* const values, const size_t maxCount,
+			size_t& count)
+	{
+		return tryPopNFor(std::chrono::duration_cast<TickClock::duration>(duration), values, maxCount, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a maxCount oldest elements from the queue until a given time point.
+	 *
+	 * All elements are popped in one critical section. Only the wait for the first element may block, other elements
+	 * are popped only if they are immediately available.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping any element
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the max number of elements that will be popped, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPopNUntil(const TickClock::time_point timePoint, T* const values, const size_t maxCount, size_t& count)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return popNInternal(semaphoreTryWaitUntilFunctor, values, maxCount, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a maxCount oldest elements from the queue until a given time point.
+	 *
+	 * Template variant of tryPopNUntil(TickClock::time_point, T*, size_t, size_t&).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping any element
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the max number of elements that will be popped, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	int tryPopNUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T* const values,
+			const size_t maxCount, size_t& count)
+	{
+		return tryPopNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), values, maxCount, count);
+	}
+
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
 	 *
@@ -478,6 +649,131 @@ public:
 		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), std::move(value));
 	}
 
+	/**
+	 * \brief Tries to push up to \a maxCount elements to the queue.
+	 *
+	 * All elements are pushed in one critical section. Only the wait for the first free slot may block, other
+	 * elements are pushed only if there are free slots immediately available.
+	 *
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] maxCount is the max number of elements that will be pushed, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPushN(const T* const values, const size_t maxCount, size_t& count)
+	{
+		const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+		return pushNInternal(semaphoreTryWaitFunctor, values, maxCount, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a maxCount elements to the queue for a given duration of time.
+	 *
+	 * All elements are pushed in one critical section. Only the wait for the first free slot may block, other
+	 * elements are pushed only if there are free slots immediately available.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing any element
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] maxCount is the max number of elements that will be pushed, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPushNFor(const TickClock::duration duration, const T* const values, const size_t maxCount, size_t& count)
+	{
+		const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+		return pushNInternal(semaphoreTryWaitForFunctor, values, maxCount, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a maxCount elements to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushNFor(TickClock::duration, const T*, size_t, size_t&).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing any element
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] maxCount is the max number of elements that will be pushed, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPushNFor(const std::chrono::duration<Rep, Period> duration, const T* const values, const size_t maxCount,
+			size_t& count)
+	{
+		return tryPushNFor(std::chrono::duration_cast<TickClock::duration>(duration), values, maxCount, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a maxCount elements to the queue until a given time point.
+	 *
+	 * All elements are pushed in one critical section. Only the wait for the first free slot may block, other
+	 * elements are pushed only if there are free slots immediately available.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing any element
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] maxCount is the max number of elements that will be pushed, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPushNUntil(const TickClock::time_point timePoint, const T* const values, const size_t maxCount,
+			size_t& count)
+	{
+		const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+		return pushNInternal(semaphoreTryWaitUntilFunctor, values, maxCount, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a maxCount elements to the queue until a given time point.
+	 *
+	 * Template variant of tryPushNUntil(TickClock::time_point, const T*, size_t, size_t&).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing any element
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] maxCount is the max number of elements that will be pushed, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	int tryPushNUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const T* const values,
+			const size_t maxCount, size_t& count)
+	{
+		return tryPushNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), values, maxCount, count);
+	}
+
 	/**
 	 * \brief Tries to push the element to the queue until a given time point.
 	 *
@@ -598,6 +894,25 @@ private:
 
 	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T& value);
 
+	/**
+	 * \brief Pops up to \a maxCount oldest elements from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] values is a pointer to array of objects that will be used to return popped values, their contents
+	 * are swapped with the values in the queue's storage and destructed when no longer needed
+	 * \param [in] maxCount is the max number of elements that will be popped, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int popNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T* values, size_t maxCount, size_t& count);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -629,6 +944,26 @@ private:
 
 	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T&& value);
 
+	/**
+	 * \brief Pushes up to \a maxCount elements to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] values is a pointer to array of objects that will be pushed, values in queue's storage are
+	 * copy-constructed
+	 * \param [in] maxCount is the max number of elements that will be pushed, size of \a values array
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pushNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T* values, size_t maxCount,
+			size_t& count);
+
 	/// contained internal::FifoQueueBase object which implements whole functionality
 	internal::FifoQueueBase fifoQueueBase_;
 };
@@ -663,6 +998,24 @@ int FifoQueue<T>::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFun
 	return fifoQueueBase_.pop(waitSemaphoreFunctor, swapPopQueueFunctor);
 }
 
+template<typename T>
+int FifoQueue<T>::popNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, T* const values,
+		const size_t maxCount, size_t& count)
+{
+	const auto swapPopQueueRangeFunctor = internal::makeBoundQueueRangeFunctor(
+			[values](void* const storage, const size_t index, const size_t rangeCount)
+			{
+				const auto swappedValues = reinterpret_cast<T*>(storage);
+				for (size_t i {}; i < rangeCount; ++i)
+				{
+					using std::swap;
+					swap(values[index + i], swappedValues[i]);
+					swappedValues[i].~T();
+				}
+			});
+	return fifoQueueBase_.popN(waitSemaphoreFunctor, swapPopQueueRangeFunctor, maxCount, count);
+}
+
 template<typename T>
 int FifoQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T& value)
 {
@@ -677,6 +1030,20 @@ int FifoQueue<T>::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFu
 	return fifoQueueBase_.push(waitSemaphoreFunctor, moveConstructQueueFunctor);
 }
 
+template<typename T>
+int FifoQueue<T>::pushNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const T* const values,
+		const size_t maxCount, size_t& count)
+{
+	const auto copyConstructQueueRangeFunctor = internal::makeBoundQueueRangeFunctor(
+			[values](void* const storage, const size_t index, const size_t rangeCount)
+			{
+				const auto constructedValues = reinterpret_cast<T*>(storage);
+				for (size_t i {}; i < rangeCount; ++i)
+					new (&constructedValues[i]) T{values[index + i]};
+			});
+	return fifoQueueBase_.pushN(waitSemaphoreFunctor, copyConstructQueueRangeFunctor, maxCount, count);
+}
+
 }	// namespace distortos
 
 #endif	// INCLUDE_DISTORTOS_FIFOQUEUE_HPP_
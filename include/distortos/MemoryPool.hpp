@@ -0,0 +1,278 @@
+/**
+ * \file
+ * \brief MemoryPool class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_MEMORYPOOL_HPP_
+#define INCLUDE_DISTORTOS_MEMORYPOOL_HPP_
+
+#include "distortos/Semaphore.hpp"
+
+#include <memory>
+
+#include <climits>
+#include <cstddef>
+
+namespace distortos
+{
+
+/**
+ * \brief MemoryPool class is a pool of memory blocks with fixed size.
+ *
+ * Allocation and deallocation take constant time - free blocks are kept on a singly linked list, which is stored in the
+ * free blocks themselves, and allocated blocks are marked in a bitmap (one bit per block), so free() can reject blocks
+ * which are not allocated (including double free). Interrupts are masked only for the duration of a single list
+ * operation. Number of free blocks
+ * is tracked with a Semaphore, so allocation may block (with optional timeout) when the pool is empty.
+ *
+ * tryAllocate() and free() may be used from interrupt context.
+ *
+ * \ingroup memory
+ */
+
+class MemoryPool
+{
+public:
+
+	/// type of single word of bitmap with allocated blocks
+	using BitmapWord = unsigned int;
+
+	/// unique_ptr (with deleter) to storage for bitmap with allocated blocks
+	using BitmapStorageUniquePointer = std::unique_ptr<BitmapWord[], void(&)(BitmapWord*)>;
+
+	/// unique_ptr (with deleter) to storage
+	using StorageUniquePointer = std::unique_ptr<void, void(&)(void*)>;
+
+	/// alignment of each block, bytes
+	constexpr static size_t alignment {alignof(std::max_align_t)};
+
+	/// number of bits in single word of bitmap with allocated blocks
+	constexpr static size_t bitsPerBitmapWord {sizeof(BitmapWord) * CHAR_BIT};
+
+	/**
+	 * \brief MemoryPool's constructor
+	 *
+	 * \param [in] bitmapStorageUniquePointer is a rvalue reference to BitmapStorageUniquePointer with storage for
+	 * bitmap with allocated blocks (sufficiently large for getBitmapWords(blocks) words) and appropriate deleter
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for blocks
+	 * (sufficiently large for \a blocks, each getAdjustedBlockSize(blockSize) bytes long, aligned to \a alignment) and
+	 * appropriate deleter
+	 * \param [in] blockSize is the requested size of single block, bytes
+	 * \param [in] blocks is the number of blocks in storage
+	 */
+
+	MemoryPool(BitmapStorageUniquePointer&& bitmapStorageUniquePointer, StorageUniquePointer&& storageUniquePointer,
+			size_t blockSize, size_t blocks);
+
+	/**
+	 * \brief Allocates one block from the pool.
+	 *
+	 * If the pool is empty, the calling thread blocks until a block is freed.
+	 *
+	 * \param [out] block is a reference to pointer which will be used to return allocated block
+	 *
+	 * \return zero if block was allocated successfully, error code otherwise:
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int allocate(void*& block);
+
+	/**
+	 * \brief Returns one block to the pool.
+	 *
+	 * \param [in] block is a pointer to block which will be returned to the pool, it must have been allocated from this
+	 * pool
+	 *
+	 * \return zero if block was returned successfully, error code otherwise:
+	 * - EINVAL - \a block doesn't point to the beginning of any block of this pool or it is not allocated (for example
+	 * it was already freed);
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int free(void* block);
+
+	/**
+	 * \param [in] blockSize is the requested size of single block, bytes
+	 *
+	 * \return \a blockSize rounded up to the multiple of \a alignment (but not less than \a alignment)
+	 */
+
+	constexpr static size_t getAdjustedBlockSize(const size_t blockSize)
+	{
+		return blockSize != 0 ? (blockSize + alignment - 1) / alignment * alignment : alignment;
+	}
+
+	/**
+	 * \param [in] blocks is the number of blocks in the pool
+	 *
+	 * \return number of words in bitmap with allocated blocks
+	 */
+
+	constexpr static size_t getBitmapWords(const size_t blocks)
+	{
+		return (blocks + bitsPerBitmapWord - 1) / bitsPerBitmapWord;
+	}
+
+	/**
+	 * \return size of single block, bytes
+	 */
+
+	size_t getBlockSize() const
+	{
+		return blockSize_;
+	}
+
+	/**
+	 * \return total number of blocks in the pool
+	 */
+
+	size_t getCapacity() const
+	{
+		return blocks_;
+	}
+
+	/**
+	 * \return maximum number of blocks which were allocated at the same time since the pool was constructed
+	 */
+
+	size_t getMaxUsedCount() const
+	{
+		return maxUsedCount_;
+	}
+
+	/**
+	 * \return number of currently allocated blocks
+	 */
+
+	size_t getUsedCount() const
+	{
+		return usedCount_;
+	}
+
+	/**
+	 * \brief Tries to allocate one block from the pool.
+	 *
+	 * \param [out] block is a reference to pointer which will be used to return allocated block
+	 *
+	 * \return zero if block was allocated successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryAllocate(void*& block);
+
+	/**
+	 * \brief Tries to allocate one block from the pool for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without allocating the block
+	 * \param [out] block is a reference to pointer which will be used to return allocated block
+	 *
+	 * \return zero if block was allocated successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryAllocateFor(TickClock::duration duration, void*& block);
+
+	/**
+	 * \brief Tries to allocate one block from the pool for a given duration of time.
+	 *
+	 * Template variant of tryAllocateFor(TickClock::duration duration, void*& block).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without allocating the block
+	 * \param [out] block is a reference to pointer which will be used to return allocated block
+	 *
+	 * \return zero if block was allocated successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryAllocateFor(const std::chrono::duration<Rep, Period> duration, void*& block)
+	{
+		return tryAllocateFor(std::chrono::duration_cast<TickClock::duration>(duration), block);
+	}
+
+	/**
+	 * \brief Tries to allocate one block from the pool until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without allocating the block
+	 * \param [out] block is a reference to pointer which will be used to return allocated block
+	 *
+	 * \return zero if block was allocated successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryAllocateUntil(TickClock::time_point timePoint, void*& block);
+
+	/**
+	 * \brief Tries to allocate one block from the pool until a given time point.
+	 *
+	 * Template variant of tryAllocateUntil(TickClock::time_point timePoint, void*& block).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without allocating the block
+	 * \param [out] block is a reference to pointer which will be used to return allocated block
+	 *
+	 * \return zero if block was allocated successfully, error code otherwise:
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryAllocateUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void*& block)
+	{
+		return tryAllocateUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), block);
+	}
+
+	MemoryPool(const MemoryPool&) = delete;
+	MemoryPool(MemoryPool&&) = delete;
+	const MemoryPool& operator=(const MemoryPool&) = delete;
+	MemoryPool& operator=(MemoryPool&&) = delete;
+
+private:
+
+	/**
+	 * \brief Takes the first block from the list of free blocks.
+	 *
+	 * \pre Semaphore with the number of free blocks was successfully decremented by the caller.
+	 *
+	 * \return pointer to allocated block
+	 */
+
+	void* takeBlock();
+
+	/// semaphore with the number of free blocks
+	Semaphore freeBlocksSemaphore_;
+
+	/// storage for bitmap with allocated blocks, bit is set when the block is allocated
+	BitmapStorageUniquePointer bitmapStorageUniquePointer_;
+
+	/// storage for blocks
+	StorageUniquePointer storageUniquePointer_;
+
+	/// pointer to the first free block, each free block contains pointer to the next one
+	void* freeList_;
+
+	/// size of single block, bytes
+	size_t blockSize_;
+
+	/// total number of blocks
+	size_t blocks_;
+
+	/// number of currently allocated blocks
+	size_t usedCount_;
+
+	/// maximum number of blocks which were allocated at the same time
+	size_t maxUsedCount_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_MEMORYPOOL_HPP_
@@ -0,0 +1,131 @@
+/**
+ * \file
+ * \brief MemoryResource class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_MEMORYRESOURCE_HPP_
+#define INCLUDE_DISTORTOS_MEMORYRESOURCE_HPP_
+
+#include <cstddef>
+
+namespace distortos
+{
+
+/**
+ * \brief MemoryResource class is an interface for source of memory used by Dynamic* objects.
+ *
+ * Similar to std::pmr::memory_resource - http://en.cppreference.com/w/cpp/memory/memory_resource
+ *
+ * Concrete resources (for example based on MemoryPool, TlsfHeap or a simple arena in fast memory region) implement
+ * doAllocate() and doDeallocate(). Dynamic* objects constructed with a reference to MemoryResource allocate all of
+ * their storage from it and return it there when they are destroyed, so the resource must outlive all such objects.
+ *
+ * Unlike std::pmr::memory_resource, allocation failure is reported by returning nullptr, as exceptions are not used.
+ *
+ * \ingroup memory
+ */
+
+class MemoryResource
+{
+public:
+
+	/**
+	 * \brief MemoryResource's constructor
+	 */
+
+	constexpr MemoryResource()
+	{
+
+	}
+
+	/**
+	 * \brief Allocates storage from the resource.
+	 *
+	 * \param [in] size is the size of requested storage, bytes
+	 * \param [in] alignment is the required alignment of storage, bytes, must be a power of 2
+	 *
+	 * \return pointer to allocated storage, nullptr if storage could not be allocated
+	 */
+
+	void* allocate(const size_t size, const size_t alignment = alignof(std::max_align_t))
+	{
+		return doAllocate(size, alignment);
+	}
+
+	/**
+	 * \brief Returns storage to the resource.
+	 *
+	 * \param [in] storage is a pointer to storage previously allocated from this resource
+	 * \param [in] size is the size of \a storage, must be equal to the value used during allocation, bytes
+	 * \param [in] alignment is the alignment of \a storage, must be equal to the value used during allocation, bytes
+	 */
+
+	void deallocate(void* const storage, const size_t size, const size_t alignment = alignof(std::max_align_t))
+	{
+		doDeallocate(storage, size, alignment);
+	}
+
+	MemoryResource(const MemoryResource&) = delete;
+	MemoryResource(MemoryResource&&) = delete;
+	const MemoryResource& operator=(const MemoryResource&) = delete;
+	MemoryResource& operator=(MemoryResource&&) = delete;
+
+protected:
+
+	/**
+	 * \brief MemoryResource's destructor
+	 *
+	 * Objects are never destroyed via pointer or reference to MemoryResource, so the destructor doesn't need to be
+	 * virtual.
+	 */
+
+	~MemoryResource() = default;
+
+private:
+
+	/**
+	 * \brief Allocates storage from the resource.
+	 *
+	 * \param [in] size is the size of requested storage, bytes
+	 * \param [in] alignment is the required alignment of storage, bytes, a power of 2
+	 *
+	 * \return pointer to allocated storage, nullptr if storage could not be allocated
+	 */
+
+	virtual void* doAllocate(size_t size, size_t alignment) = 0;
+
+	/**
+	 * \brief Returns storage to the resource.
+	 *
+	 * \param [in] storage is a pointer to storage previously allocated from this resource
+	 * \param [in] size is the size of \a storage, bytes
+	 * \param [in] alignment is the alignment of \a storage, bytes
+	 */
+
+	virtual void doDeallocate(void* storage, size_t size, size_t alignment) = 0;
+};
+
+/**
+ * \brief Gets memory resource which uses global operator new and operator delete.
+ *
+ * Similar to std::pmr::new_delete_resource() - http://en.cppreference.com/w/cpp/memory/new_delete_resource
+ *
+ * This resource is used by all Dynamic* objects constructed without explicit MemoryResource. Alignment greater than
+ * alignof(std::max_align_t) is not supported.
+ *
+ * \return reference to memory resource which uses global operator new and operator delete
+ *
+ * \ingroup memory
+ */
+
+MemoryResource& getNewDeleteMemoryResource();
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_MEMORYRESOURCE_HPP_
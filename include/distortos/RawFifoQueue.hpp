@@ -2,7 +2,7 @@
  * \file
  * \brief RawFifoQueue class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -45,6 +45,35 @@ public:
 
 	RawFifoQueue(StorageUniquePointer&& storageUniquePointer, size_t elementSize, size_t maxElements);
 
+	/**
+	 * \brief Commits the element written in place to the slot reserved with reservePush() (or one of its variants),
+	 * making it available for popping.
+	 *
+	 * \param [in] storage is a pointer to storage for element, obtained from reservePush() or one of its variants
+	 *
+	 * \return zero if element was committed successfully, error code otherwise:
+	 * - EINVAL - \a storage is not the one obtained from last reservePush() or it was already committed;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commitPush(const void* storage);
+
+	/**
+	 * \brief Reserves the oldest (first) element of the queue, so that it can be read in place.
+	 *
+	 * The element is removed from the queue, but its slot is not reused until the element is released with
+	 * releasePop(). Only one element may be reserved at a time. Elements popped with other functions while the
+	 * reservation is active don't free their slots until the reservation is released.
+	 *
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop() or one of its variants;
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int peekPop(const void*& storage);
+
 	/**
 	 * \brief Pops the oldest (first) element from the queue.
 	 *
@@ -78,6 +107,25 @@ public:
 		return pop(&buffer, sizeof(buffer));
 	}
 
+	/**
+	 * \brief Pops up to \a size / \a elementSize oldest elements from the queue.
+	 *
+	 * All elements are popped in one critical section. Only the wait for the first element may block, other elements
+	 * are popped only if they are immediately available.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int popN(void* buffer, size_t size, size_t& count);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -111,6 +159,135 @@ public:
 		return push(&data, sizeof(data));
 	}
 
+	/**
+	 * \brief Pushes up to \a size / \a elementSize elements to the queue.
+	 *
+	 * All elements are pushed in one critical section. Only the wait for the first free slot may block, other
+	 * elements are pushed only if there are free slots immediately available.
+	 *
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::wait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pushN(const void* data, size_t size, size_t& count);
+
+	/**
+	 * \brief Releases the element reserved with peekPop() (or one of its variants), making its slot available for
+	 * pushing.
+	 *
+	 * \param [in] storage is a pointer to storage with element, obtained from peekPop() or one of its variants
+	 *
+	 * \return zero if element was released successfully, error code otherwise:
+	 * - EINVAL - \a storage is not the one obtained from last peekPop() or it was already released;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int releasePop(const void* storage);
+
+	/**
+	 * \brief Reserves free slot in the queue, so that the element can be written in place.
+	 *
+	 * The element is not available for popping until it is committed with commitPush(). Only one slot may be reserved
+	 * at a time. Elements pushed with other functions while the reservation is active are not available for popping
+	 * until the reservation is committed.
+	 *
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush() or one of its variants;
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int reservePush(void*& storage);
+
+	/**
+	 * \brief Tries to reserve the oldest (first) element of the queue.
+	 *
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop() or one of its variants;
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryPeekPop(const void*& storage);
+
+	/**
+	 * \brief Tries to reserve the oldest (first) element of the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the element
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryPeekPopFor(TickClock::duration duration, const void*& storage);
+
+	/**
+	 * \brief Tries to reserve the oldest (first) element of the queue for a given duration of time.
+	 *
+	 * Template variant of tryPeekPopFor(TickClock::duration, const void*&).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the element
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPeekPopFor(const std::chrono::duration<Rep, Period> duration, const void*& storage)
+	{
+		return tryPeekPopFor(std::chrono::duration_cast<TickClock::duration>(duration), storage);
+	}
+
+	/**
+	 * \brief Tries to reserve the oldest (first) element of the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the element
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPeekPopUntil(TickClock::time_point timePoint, const void*& storage);
+
+	/**
+	 * \brief Tries to reserve the oldest (first) element of the queue until a given time point.
+	 *
+	 * Template variant of tryPeekPopUntil(TickClock::time_point, const void*&).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the element
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryPeekPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const void*& storage)
+	{
+		return tryPeekPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), storage);
+	}
+
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue.
 	 *
@@ -205,6 +382,118 @@ public:
 		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), &buffer, sizeof(buffer));
 	}
 
+	/**
+	 * \brief Tries to pop up to \a size / \a elementSize oldest elements from the queue.
+	 *
+	 * All elements are popped in one critical section. Only the wait for the first element may block, other elements
+	 * are popped only if they are immediately available.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPopN(void* buffer, size_t size, size_t& count);
+
+	/**
+	 * \brief Tries to pop up to \a size / \a elementSize oldest elements from the queue for a given duration of time.
+	 *
+	 * All elements are popped in one critical section. Only the wait for the first element may block, other elements
+	 * are popped only if they are immediately available.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPopNFor(TickClock::duration duration, void* buffer, size_t size, size_t& count);
+
+	/**
+	 * \brief Tries to pop up to \a size / \a elementSize oldest elements from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopNFor(TickClock::duration, void*, size_t, size_t&).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPopNFor(const std::chrono::duration<Rep, Period> duration, void* const buffer, const size_t size,
+			size_t& count)
+	{
+		return tryPopNFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size, count);
+	}
+
+	/**
+	 * \brief Tries to pop up to \a size / \a elementSize oldest elements from the queue until a given time point.
+	 *
+	 * All elements are popped in one critical section. Only the wait for the first element may block, other elements
+	 * are popped only if they are immediately available.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPopNUntil(TickClock::time_point timePoint, void* buffer, size_t size, size_t& count);
+
+	/**
+	 * \brief Tries to pop up to \a size / \a elementSize oldest elements from the queue until a given time point.
+	 *
+	 * Template variant of tryPopNUntil(TickClock::time_point, void*, size_t, size_t&).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping any element
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	int tryPopNUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void* const buffer,
+			const size_t size, size_t& count)
+	{
+		return tryPopNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size, count);
+	}
+
 	/**
 	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
 	 *
@@ -358,6 +647,118 @@ public:
 		return tryPushFor(std::chrono::duration_cast<TickClock::duration>(duration), &data, sizeof(data));
 	}
 
+	/**
+	 * \brief Tries to push up to \a size / \a elementSize elements to the queue.
+	 *
+	 * All elements are pushed in one critical section. Only the wait for the first free slot may block, other
+	 * elements are pushed only if there are free slots immediately available.
+	 *
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWait();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPushN(const void* data, size_t size, size_t& count);
+
+	/**
+	 * \brief Tries to push up to \a size / \a elementSize elements to the queue for a given duration of time.
+	 *
+	 * All elements are pushed in one critical section. Only the wait for the first free slot may block, other
+	 * elements are pushed only if there are free slots immediately available.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPushNFor(TickClock::duration duration, const void* data, size_t size, size_t& count);
+
+	/**
+	 * \brief Tries to push up to \a size / \a elementSize elements to the queue for a given duration of time.
+	 *
+	 * Template variant of tryPushNFor(TickClock::duration, const void*, size_t, size_t&).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPushNFor(const std::chrono::duration<Rep, Period> duration, const void* const data, const size_t size,
+			size_t& count)
+	{
+		return tryPushNFor(std::chrono::duration_cast<TickClock::duration>(duration), data, size, count);
+	}
+
+	/**
+	 * \brief Tries to push up to \a size / \a elementSize elements to the queue until a given time point.
+	 *
+	 * All elements are pushed in one critical section. Only the wait for the first free slot may block, other
+	 * elements are pushed only if there are free slots immediately available.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int tryPushNUntil(TickClock::time_point timePoint, const void* data, size_t size, size_t& count);
+
+	/**
+	 * \brief Tries to push up to \a size / \a elementSize elements to the queue until a given time point.
+	 *
+	 * Template variant of tryPushNUntil(TickClock::time_point, const void*, size_t, size_t&).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without pushing any element
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	template<typename Duration>
+	int tryPushNUntil(const std::chrono::time_point<TickClock, Duration> timePoint, const void* const data,
+			const size_t size, size_t& count)
+	{
+		return tryPushNUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), data, size, count);
+	}
+
 	/**
 	 * \brief Tries to push the element to the queue until a given time point.
 	 *
@@ -418,6 +819,87 @@ public:
 		return tryPushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), &data, sizeof(data));
 	}
 
+	/**
+	 * \brief Tries to reserve free slot in the queue.
+	 *
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush() or one of its variants;
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryReservePush(void*& storage);
+
+	/**
+	 * \brief Tries to reserve free slot in the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryReservePushFor(TickClock::duration duration, void*& storage);
+
+	/**
+	 * \brief Tries to reserve free slot in the queue for a given duration of time.
+	 *
+	 * Template variant of tryReservePushFor(TickClock::duration, void*&).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryReservePushFor(const std::chrono::duration<Rep, Period> duration, void*& storage)
+	{
+		return tryReservePushFor(std::chrono::duration_cast<TickClock::duration>(duration), storage);
+	}
+
+	/**
+	 * \brief Tries to reserve free slot in the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryReservePushUntil(TickClock::time_point timePoint, void*& storage);
+
+	/**
+	 * \brief Tries to reserve free slot in the queue until a given time point.
+	 *
+	 * Template variant of tryReservePushUntil(TickClock::time_point, void*&).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryReservePushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void*& storage)
+	{
+		return tryReservePushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), storage);
+	}
+
 private:
 
 	/**
@@ -437,6 +919,25 @@ private:
 
 	int popInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer, size_t size);
 
+	/**
+	 * \brief Pops up to \a size / \a elementSize oldest elements from the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] buffer is a pointer to buffer for popped elements
+	 * \param [in] size is the size of \a buffer, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int popNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* buffer, size_t size, size_t& count);
+
 	/**
 	 * \brief Pushes the element to the queue.
 	 *
@@ -454,6 +955,26 @@ private:
 
 	int pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* data, size_t size);
 
+	/**
+	 * \brief Pushes up to \a size / \a elementSize elements to the queue.
+	 *
+	 * Internal version - builds the Functor object.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] data is a pointer to data that will be pushed to RawFifoQueue
+	 * \param [in] size is the size of \a data, bytes - must be a non-zero multiple of the \a elementSize attribute of
+	 * RawFifoQueue
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EMSGSIZE - \a size is not a non-zero multiple of the \a elementSize attribute of RawFifoQueue;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pushNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* data, size_t size,
+			size_t& count);
+
 	/// contained internal::FifoQueueBase object which implements base functionality
 	internal::FifoQueueBase fifoQueueBase_;
 };
@@ -2,7 +2,7 @@
  * \file
  * \brief RawMessageQueue class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -65,6 +65,36 @@ public:
 	RawMessageQueue(EntryStorageUniquePointer&& entryStorageUniquePointer,
 			ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements);
 
+	/**
+	 * \brief Commits the element written in place to the slot reserved with reservePush() (or one of its variants),
+	 * making it available for popping.
+	 *
+	 * \param [in] priority is the priority of new element
+	 * \param [in] storage is a pointer to storage for element, obtained from reservePush() or one of its variants
+	 *
+	 * \return zero if element was committed successfully, error code otherwise:
+	 * - EINVAL - \a storage is not the one obtained from last reservePush() or it was already committed;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commitPush(uint8_t priority, const void* storage);
+
+	/**
+	 * \brief Reserves the oldest element with highest priority, so that it can be read in place.
+	 *
+	 * The element is removed from the queue, but its slot is not reused until the element is released with
+	 * releasePop(). Only one element may be reserved at a time.
+	 *
+	 * \param [out] priority is a reference to variable that will be used to return priority of reserved element
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop() or one of its variants;
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int peekPop(uint8_t& priority, const void*& storage);
+
 	/**
 	 * \brief Pops oldest element with highest priority from the queue.
 	 *
@@ -144,6 +174,121 @@ public:
 		return push(priority, &data, sizeof(data));
 	}
 
+	/**
+	 * \brief Releases the element reserved with peekPop() (or one of its variants), making its slot available for
+	 * pushing.
+	 *
+	 * \param [in] storage is a pointer to storage with element, obtained from peekPop() or one of its variants
+	 *
+	 * \return zero if element was released successfully, error code otherwise:
+	 * - EINVAL - \a storage is not the one obtained from last peekPop() or it was already released;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int releasePop(const void* storage);
+
+	/**
+	 * \brief Reserves free slot in the queue, so that the element can be written in place.
+	 *
+	 * The element is not available for popping until it is committed with commitPush(). Only one slot may be reserved
+	 * at a time.
+	 *
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush() or one of its variants;
+	 * - error codes returned by Semaphore::wait();
+	 */
+
+	int reservePush(void*& storage);
+
+	/**
+	 * \brief Tries to reserve the oldest element with highest priority.
+	 *
+	 * \param [out] priority is a reference to variable that will be used to return priority of reserved element
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop() or one of its variants;
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryPeekPop(uint8_t& priority, const void*& storage);
+
+	/**
+	 * \brief Tries to reserve the oldest element with highest priority for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the element
+	 * \param [out] priority is a reference to variable that will be used to return priority of reserved element
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryPeekPopFor(TickClock::duration duration, uint8_t& priority, const void*& storage);
+
+	/**
+	 * \brief Tries to reserve the oldest element with highest priority for a given duration of time.
+	 *
+	 * Template variant of tryPeekPopFor(TickClock::duration, uint8_t&, const void*&).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the element
+	 * \param [out] priority is a reference to variable that will be used to return priority of reserved element
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPeekPopFor(const std::chrono::duration<Rep, Period> duration, uint8_t& priority, const void*& storage)
+	{
+		return tryPeekPopFor(std::chrono::duration_cast<TickClock::duration>(duration), priority, storage);
+	}
+
+	/**
+	 * \brief Tries to reserve the oldest element with highest priority until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the element
+	 * \param [out] priority is a reference to variable that will be used to return priority of reserved element
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryPeekPopUntil(TickClock::time_point timePoint, uint8_t& priority, const void*& storage);
+
+	/**
+	 * \brief Tries to reserve the oldest element with highest priority until a given time point.
+	 *
+	 * Template variant of tryPeekPopUntil(TickClock::time_point, uint8_t&, const void*&).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the element
+	 * \param [out] priority is a reference to variable that will be used to return priority of reserved element
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryPeekPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, uint8_t& priority,
+			const void*& storage)
+	{
+		return tryPeekPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), priority, storage);
+	}
+
 	/**
 	 * \brief Tries to pop the oldest element with highest priority from the queue.
 	 *
@@ -502,6 +647,87 @@ public:
 				sizeof(data));
 	}
 
+	/**
+	 * \brief Tries to reserve free slot in the queue.
+	 *
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush() or one of its variants;
+	 * - error codes returned by Semaphore::tryWait();
+	 */
+
+	int tryReservePush(void*& storage);
+
+	/**
+	 * \brief Tries to reserve free slot in the queue for a given duration of time.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	int tryReservePushFor(TickClock::duration duration, void*& storage);
+
+	/**
+	 * \brief Tries to reserve free slot in the queue for a given duration of time.
+	 *
+	 * Template variant of tryReservePushFor(TickClock::duration, void*&).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitFor();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryReservePushFor(const std::chrono::duration<Rep, Period> duration, void*& storage)
+	{
+		return tryReservePushFor(std::chrono::duration_cast<TickClock::duration>(duration), storage);
+	}
+
+	/**
+	 * \brief Tries to reserve free slot in the queue until a given time point.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	int tryReservePushUntil(TickClock::time_point timePoint, void*& storage);
+
+	/**
+	 * \brief Tries to reserve free slot in the queue until a given time point.
+	 *
+	 * Template variant of tryReservePushUntil(TickClock::time_point, void*&).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without reserving the slot
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush() or one of its variants;
+	 * - error codes returned by Semaphore::tryWaitUntil();
+	 */
+
+	template<typename Duration>
+	int tryReservePushUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void*& storage)
+	{
+		return tryReservePushUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), storage);
+	}
+
 private:
 
 	/**
@@ -0,0 +1,432 @@
+/**
+ * \file
+ * \brief RawSpscQueue class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_RAWSPSCQUEUE_HPP_
+#define INCLUDE_DISTORTOS_RAWSPSCQUEUE_HPP_
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+#include "distortos/TickClock.hpp"
+
+#include <memory>
+
+namespace distortos
+{
+
+/**
+ * \brief RawSpscQueue class is a lock-free FIFO queue for one producer and one consumer, optimized for binary
+ * serializable types (like POD types).
+ *
+ * The producer - interrupt handler or thread - uses tryPush(), which never blocks and never masks interrupts, unless
+ * the queue was empty before the push, in which case interrupts are masked for a moment to check whether the consumer
+ * is blocked and to unblock it. The consumer - thread - uses tryPop(), which is wait-free, or pop() (and its other
+ * variants), which blocks when the queue is empty.
+ *
+ * Distinction between empty and full queue is possible because most significant bits of read and write positions are
+ * used as single-bit counters of wrap-arounds, so all slots of storage can be used.
+ *
+ * Only one producer and only one consumer may use the object at a time, otherwise the behavior is undefined.
+ *
+ * \ingroup queues
+ */
+
+class RawSpscQueue
+{
+public:
+
+	/// unique_ptr (with deleter) to storage
+	using StorageUniquePointer = std::unique_ptr<void, void(&)(void*)>;
+
+	/**
+	 * \brief RawSpscQueue's constructor
+	 *
+	 * \param [in] storageUniquePointer is a rvalue reference to StorageUniquePointer with storage for queue elements
+	 * (sufficiently large for \a maxElements, each \a elementSize bytes long) and appropriate deleter
+	 * \param [in] elementSize is the size of single queue element, bytes
+	 * \param [in] maxElements is the number of elements in storage memory block, must be less than or equal to
+	 * SIZE_MAX / 2
+	 */
+
+	RawSpscQueue(StorageUniquePointer&& storageUniquePointer, size_t elementSize, size_t maxElements);
+
+	/**
+	 * \brief RawSpscQueue's destructor
+	 */
+
+	~RawSpscQueue();
+
+	/**
+	 * \brief Pops the oldest (first) element from the queue.
+	 *
+	 * \note Can be used only by the consumer thread.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Scheduler::block();
+	 */
+
+	int pop(void* buffer, size_t size);
+
+	/**
+	 * \brief Pops the oldest (first) element from the queue.
+	 *
+	 * \note Can be used only by the consumer thread.
+	 *
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - error codes returned by Scheduler::block();
+	 */
+
+	template<typename T>
+	int pop(T& buffer)
+	{
+		return pop(&buffer, sizeof(buffer));
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue.
+	 *
+	 * This function is wait-free.
+	 *
+	 * \note Can be used only by the consumer.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EAGAIN - the queue is empty;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 */
+
+	int tryPop(void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue.
+	 *
+	 * This function is wait-free.
+	 *
+	 * \note Can be used only by the consumer.
+	 *
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EAGAIN - the queue is empty;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawSpscQueue;
+	 */
+
+	template<typename T>
+	int tryPop(T& buffer)
+	{
+		return tryPop(&buffer, sizeof(buffer));
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * \note Can be used only by the consumer thread.
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the element
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - ETIMEDOUT - no element was pushed before the specified timeout expired;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	int tryPopFor(TickClock::duration duration, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * Template variant of tryPopFor(TickClock::duration, void*, size_t).
+	 *
+	 * \note Can be used only by the consumer thread.
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the element
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - ETIMEDOUT - no element was pushed before the specified timeout expired;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	template<typename Rep, typename Period>
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, void* const buffer, const size_t size)
+	{
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), buffer, size);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue for a given duration of time.
+	 *
+	 * \note Can be used only by the consumer thread.
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [in] duration is the duration after which the call will be terminated without popping the element
+	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - ETIMEDOUT - no element was pushed before the specified timeout expired;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	template<typename Rep, typename Period, typename T>
+	int tryPopFor(const std::chrono::duration<Rep, Period> duration, T& buffer)
+	{
+		return tryPopFor(std::chrono::duration_cast<TickClock::duration>(duration), &buffer, sizeof(buffer));
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * \note Can be used only by the consumer thread.
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - ETIMEDOUT - no element was pushed before the specified timeout expired;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	int tryPopUntil(TickClock::time_point timePoint, void* buffer, size_t size);
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * Template variant of tryPopUntil(TickClock::time_point, void*, size_t).
+	 *
+	 * \note Can be used only by the consumer thread.
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - ETIMEDOUT - no element was pushed before the specified timeout expired;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	template<typename Duration>
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, void* const buffer, const size_t size)
+	{
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), buffer, size);
+	}
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue until a given time point.
+	 *
+	 * \note Can be used only by the consumer thread.
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 * \tparam T is the type of data popped from the queue
+	 *
+	 * \param [in] timePoint is the time point at which the call will be terminated without popping the element
+	 * \param [out] buffer is a reference to object that will be used to return popped value
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - ETIMEDOUT - no element was pushed before the specified timeout expired;
+	 * - error codes returned by Scheduler::blockUntil();
+	 */
+
+	template<typename Duration, typename T>
+	int tryPopUntil(const std::chrono::time_point<TickClock, Duration> timePoint, T& buffer)
+	{
+		return tryPopUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint), &buffer, sizeof(buffer));
+	}
+
+	/**
+	 * \brief Tries to push the element to the queue.
+	 *
+	 * This function never blocks. Interrupts are masked only if the queue was empty before the push, to unblock the
+	 * consumer thread waiting for an element.
+	 *
+	 * \note Can be used only by the producer.
+	 *
+	 * \param [in] data is a pointer to data that will be pushed to RawSpscQueue
+	 * \param [in] size is the size of \a data, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - EAGAIN - the queue is full;
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 */
+
+	int tryPush(const void* data, size_t size);
+
+	/**
+	 * \brief Tries to push the element to the queue.
+	 *
+	 * This function never blocks. Interrupts are masked only if the queue was empty before the push, to unblock the
+	 * consumer thread waiting for an element.
+	 *
+	 * \note Can be used only by the producer.
+	 *
+	 * \tparam T is the type of data pushed to the queue
+	 *
+	 * \param [in] data is a reference to data that will be pushed to RawSpscQueue
+	 *
+	 * \return zero if element was pushed successfully, error code otherwise:
+	 * - EAGAIN - the queue is full;
+	 * - EMSGSIZE - sizeof(T) doesn't match the \a elementSize attribute of RawSpscQueue;
+	 */
+
+	template<typename T>
+	int tryPush(const T& data)
+	{
+		return tryPush(&data, sizeof(data));
+	}
+
+private:
+
+	/**
+	 * \brief Gets storage of element at given position.
+	 *
+	 * \param [in] position is the position of element, \a readPosition_ or \a writePosition_
+	 *
+	 * \return pointer to storage of element at \a position
+	 */
+
+	uint8_t* getStorage(const size_t position) const
+	{
+		return static_cast<uint8_t*>(storageUniquePointer_.get()) + (position & positionMask_) * elementSize_;
+	}
+
+	/**
+	 * \brief Increases given position by one element.
+	 *
+	 * \param [in] position is the position that will be incremented
+	 *
+	 * \return \a position incremented by one element
+	 */
+
+	size_t increasePosition(const size_t position) const
+	{
+		const auto maskedPosition = position & positionMask_;
+		const auto msb = position & msbMask_;
+		// in case of wrap-around MSB is inverted and position is 0
+		return maskedPosition + 1 != maxElements_ ? msb | (maskedPosition + 1) : msb ^ msbMask_;
+	}
+
+	/**
+	 * \brief Implementation of pop(), tryPopFor() and tryPopUntil()
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 * \param [in] size is the size of \a buffer, bytes - must be equal to the \a elementSize attribute of RawSpscQueue
+	 * \param [in] timePoint is a pointer to the time point at which the call will be terminated without popping the
+	 * element, nullptr to wait with no timeout
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EMSGSIZE - \a size doesn't match the \a elementSize attribute of RawSpscQueue;
+	 * - ETIMEDOUT - no element was pushed before the specified timeout expired;
+	 * - error codes returned by Scheduler::block() or Scheduler::blockUntil();
+	 */
+
+	int popInternal(void* buffer, size_t size, const TickClock::time_point* timePoint);
+
+	/**
+	 * \brief Tries to pop the oldest (first) element from the queue.
+	 *
+	 * Internal version with no size check.
+	 *
+	 * \param [out] buffer is a pointer to buffer for popped element
+	 *
+	 * \return zero if element was popped successfully, error code otherwise:
+	 * - EAGAIN - the queue is empty;
+	 */
+
+	int tryPopInternal(void* buffer);
+
+	/**
+	 * \brief Tests for empty queue.
+	 *
+	 * The queue is empty if read and write positions are equal, including their MSBs.
+	 *
+	 * \param [in] readPosition is the value of \a readPosition_
+	 * \param [in] writePosition is the value of \a writePosition_
+	 *
+	 * \return true if queue is empty, false otherwise
+	 */
+
+	constexpr static bool isEmpty(const size_t readPosition, const size_t writePosition)
+	{
+		return readPosition == writePosition;
+	}
+
+	/**
+	 * \brief Tests for full queue.
+	 *
+	 * The queue is full if masked read and write positions are equal, but their MSBs are different.
+	 *
+	 * \param [in] readPosition is the value of \a readPosition_
+	 * \param [in] writePosition is the value of \a writePosition_
+	 *
+	 * \return true if queue is full, false otherwise
+	 */
+
+	constexpr static bool isFull(const size_t readPosition, const size_t writePosition)
+	{
+		return (readPosition ^ writePosition) == msbMask_;
+	}
+
+	/// bitmask used to extract position from \a readPosition_ or \a writePosition_
+	constexpr static size_t positionMask_ {SIZE_MAX >> 1};
+
+	/// bitmask used to extract MSB from \a readPosition_ or \a writePosition_
+	constexpr static size_t msbMask_ {~positionMask_};
+
+	/// consumer thread blocked on this queue, there may be at most one such thread
+	internal::ThreadList blockedList_;
+
+	/// storage for queue elements
+	const StorageUniquePointer storageUniquePointer_;
+
+	/// current read position, modified only by the consumer
+	volatile size_t readPosition_;
+
+	/// current write position, modified only by the producer
+	volatile size_t writePosition_;
+
+	/// size of single queue element, bytes
+	const size_t elementSize_;
+
+	/// number of elements in storage
+	const size_t maxElements_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_RAWSPSCQUEUE_HPP_
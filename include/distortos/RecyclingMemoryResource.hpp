@@ -0,0 +1,177 @@
+/**
+ * \file
+ * \brief RecyclingMemoryResource class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_RECYCLINGMEMORYRESOURCE_HPP_
+#define INCLUDE_DISTORTOS_RECYCLINGMEMORYRESOURCE_HPP_
+
+#include "distortos/MemoryResource.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief RecyclingMemoryResource class is a MemoryResource which keeps recently deallocated blocks for reuse.
+ *
+ * Blocks returned to this resource are not passed to upstream resource immediately - up to \a maxCachedBlocks of them
+ * are kept on a list instead. Allocation with exactly the same size and alignment as one of cached blocks takes the
+ * most recently cached one, without calling upstream resource at all. Only when there is no matching block the
+ * allocation is forwarded to upstream resource.
+ *
+ * The main use case is a thread-per-request pattern with DynamicThread - all storage of such thread (stack, control
+ * block, storage for signals) has the same sizes for each spawned thread, so constructing DynamicThread objects with
+ * this resource makes the storage of terminated threads immediately available for new ones:
+ *
+ *     distortos::RecyclingMemoryResource workerMemoryResource {distortos::getNewDeleteMemoryResource(), 6};
+ *     ...
+ *     auto thread = distortos::makeAndStartDynamicThread(workerMemoryResource, {1024, 1}, worker, request);
+ *
+ * Cached blocks are kept in the blocks themselves, so each cached block must be at least as large as two pointers
+ * and a size_t - smaller blocks (and blocks with alignment lower than alignof(void*)) are always passed straight to
+ * upstream resource.
+ *
+ * All functions may be used from threads and interrupts - access to the list of cached blocks is protected with
+ * architecture::InterruptMaskingLock, upstream resource is used with interrupts unmasked.
+ *
+ * \ingroup memory
+ */
+
+class RecyclingMemoryResource : public MemoryResource
+{
+public:
+
+	/**
+	 * \brief RecyclingMemoryResource's constructor
+	 *
+	 * \param [in] upstream is a reference to MemoryResource which is used when there is no suitable cached block and
+	 * to which blocks are returned when the cache is full
+	 * \param [in] maxCachedBlocks is the max number of blocks kept in the cache, 0 disables caching
+	 */
+
+	constexpr RecyclingMemoryResource(MemoryResource& upstream, const size_t maxCachedBlocks) :
+			MemoryResource{},
+			list_{},
+			upstream_{upstream},
+			maxCachedBlocks_{maxCachedBlocks},
+			cachedBlocks_{},
+			hits_{},
+			misses_{}
+	{
+
+	}
+
+	/**
+	 * \brief RecyclingMemoryResource's destructor
+	 *
+	 * Returns all cached blocks to upstream resource.
+	 */
+
+	~RecyclingMemoryResource();
+
+	/**
+	 * \return current number of cached blocks
+	 */
+
+	size_t getCachedBlockCount() const
+	{
+		return cachedBlocks_;
+	}
+
+	/**
+	 * \return number of allocations which were satisfied with one of cached blocks
+	 */
+
+	size_t getHitCount() const
+	{
+		return hits_;
+	}
+
+	/**
+	 * \return number of allocations which were forwarded to upstream resource
+	 */
+
+	size_t getMissCount() const
+	{
+		return misses_;
+	}
+
+	/**
+	 * \return reference to upstream resource
+	 */
+
+	MemoryResource& getUpstream() const
+	{
+		return upstream_;
+	}
+
+	/**
+	 * \brief Returns all cached blocks to upstream resource.
+	 */
+
+	void release();
+
+private:
+
+	/// CachedBlock struct is placed at the beginning of each cached block
+	struct CachedBlock
+	{
+		/// pointer to next cached block, nullptr if this is the last one
+		CachedBlock* next;
+
+		/// size of block, bytes
+		size_t size;
+
+		/// alignment of block, bytes
+		size_t alignment;
+	};
+
+	/**
+	 * \brief Takes matching block from the cache or allocates storage from upstream resource.
+	 *
+	 * \param [in] size is the size of requested storage, bytes
+	 * \param [in] alignment is the required alignment of storage, bytes, a power of 2
+	 *
+	 * \return pointer to allocated storage, nullptr if storage could not be allocated
+	 */
+
+	void* doAllocate(size_t size, size_t alignment) override;
+
+	/**
+	 * \brief Puts storage into the cache or returns it to upstream resource if the cache is full.
+	 *
+	 * \param [in] storage is a pointer to storage previously allocated from this resource
+	 * \param [in] size is the size of \a storage, bytes
+	 * \param [in] alignment is the alignment of \a storage, bytes
+	 */
+
+	void doDeallocate(void* storage, size_t size, size_t alignment) override;
+
+	/// pointer to the most recently cached block, nullptr if the cache is empty
+	CachedBlock* list_;
+
+	/// reference to upstream resource
+	MemoryResource& upstream_;
+
+	/// max number of cached blocks
+	size_t maxCachedBlocks_;
+
+	/// current number of cached blocks
+	size_t cachedBlocks_;
+
+	/// number of allocations satisfied with cached blocks
+	size_t hits_;
+
+	/// number of allocations forwarded to upstream resource
+	size_t misses_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_RECYCLINGMEMORYRESOURCE_HPP_
@@ -0,0 +1,365 @@
+/**
+ * \file
+ * \brief RwLock class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_RWLOCK_HPP_
+#define INCLUDE_DISTORTOS_RWLOCK_HPP_
+
+#include "distortos/internal/synchronization/MutexControlBlock.hpp"
+
+namespace distortos
+{
+
+/**
+ * \brief RwLock is a reader-writer lock - it may be locked by many "readers" at the same time ("shared" lock) or by a
+ * single "writer" ("exclusive" lock).
+ *
+ * Similar to POSIX pthread_rwlock_t - http://pubs.opengroup.org/onlinepubs/9699919799/basedefs/pthread.h.html
+ *
+ * Writers are preferred - when a writer waits for the lock, new readers are blocked, even if the lock is currently held
+ * only by readers. Threads blocked because of the writer (either current or waiting for readers to unlock) are
+ * unblocked one by one in the order of their priorities, so a writer blocked behind a reader with higher priority may
+ * be passed only by a group of readers which preceded it. The lock is not recursive - a thread must not lock it again
+ * (in any mode) when already holding it.
+ *
+ * Readers are only counted, not tracked, which results in two restrictions:
+ * - a thread which holds the lock for reading must not try to lock it for writing - the lock cannot be "upgraded";
+ * lock() would never return, as the thread would wait for all readers to unlock, including itself, and
+ * tryLockFor() / tryLockUntil() would always time-out;
+ * - unlockShared() doesn't check whether the calling thread holds the lock for reading - it must be called only by the
+ * readers, otherwise it releases the lock of another reader.
+ *
+ * With Protocol::priorityInheritance the writer (current one or waiting for readers to unlock) inherits the priority of
+ * the highest priority thread blocked because of it, exactly like the owner of Mutex with this protocol. Readers do not
+ * inherit priority.
+ *
+ * \ingroup synchronization
+ */
+
+class RwLock
+{
+public:
+
+	/// reader-writer lock protocols - Protocol::priorityProtect is not supported and is treated as Protocol::none
+	using Protocol = internal::MutexControlBlock::Protocol;
+
+	/**
+	 * \brief RwLock constructor
+	 *
+	 * \param [in] protocol is the reader-writer lock protocol, default - Protocol::none
+	 */
+
+	constexpr explicit RwLock(const Protocol protocol = Protocol::none) :
+			controlBlock_{protocol == Protocol::priorityInheritance ? protocol : Protocol::none, {}},
+			writerBlockedList_{},
+			readers_{}
+	{
+
+	}
+
+	/**
+	 * \brief Locks the reader-writer lock for writing ("exclusive" lock).
+	 *
+	 * Similar to pthread_rwlock_wrlock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_wrlock.html
+	 *
+	 * If the lock is held by another writer or by any reader, the calling thread blocks until it can be locked.
+	 *
+	 * \attention The calling thread must not hold the lock for reading, as it would block forever.
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 */
+
+	int lock();
+
+	/**
+	 * \brief Locks the reader-writer lock for reading ("shared" lock).
+	 *
+	 * Similar to pthread_rwlock_rdlock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_rdlock.html
+	 *
+	 * If the lock is held by a writer or if a writer waits for it, the calling thread blocks until it can be locked.
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 */
+
+	int lockShared();
+
+	/**
+	 * \brief Tries to lock the reader-writer lock for writing.
+	 *
+	 * Similar to pthread_rwlock_trywrlock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_trywrlock.html
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EBUSY - the reader-writer lock could not be acquired because it was already locked;
+	 */
+
+	int tryLock();
+
+	/**
+	 * \brief Tries to lock the reader-writer lock for writing for given duration of time.
+	 *
+	 * Similar to pthread_rwlock_timedwrlock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_timedwrlock.html
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 * - ETIMEDOUT - the reader-writer lock could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to lock the reader-writer lock for writing for given duration of time.
+	 *
+	 * Template variant of tryLockFor(TickClock::duration duration).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 * - ETIMEDOUT - the reader-writer lock could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	int tryLockFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryLockFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to lock the reader-writer lock for reading.
+	 *
+	 * Similar to pthread_rwlock_tryrdlock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_tryrdlock.html
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EBUSY - the reader-writer lock could not be acquired because a writer holds it or waits for it;
+	 */
+
+	int tryLockShared();
+
+	/**
+	 * \brief Tries to lock the reader-writer lock for reading for given duration of time.
+	 *
+	 * Similar to pthread_rwlock_timedrdlock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_timedrdlock.html
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 * - ETIMEDOUT - the reader-writer lock could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockSharedFor(TickClock::duration duration);
+
+	/**
+	 * \brief Tries to lock the reader-writer lock for reading for given duration of time.
+	 *
+	 * Template variant of tryLockSharedFor(TickClock::duration duration).
+	 *
+	 * \tparam Rep is type of tick counter
+	 * \tparam Period is std::ratio type representing the tick period of the clock, seconds
+	 *
+	 * \param [in] duration is the duration after which the wait will be terminated without locking
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 * - ETIMEDOUT - the reader-writer lock could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Rep, typename Period>
+	int tryLockSharedFor(const std::chrono::duration<Rep, Period> duration)
+	{
+		return tryLockSharedFor(std::chrono::duration_cast<TickClock::duration>(duration));
+	}
+
+	/**
+	 * \brief Tries to lock the reader-writer lock for reading until given time point.
+	 *
+	 * Similar to pthread_rwlock_timedrdlock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_timedrdlock.html
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 * - ETIMEDOUT - the reader-writer lock could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockSharedUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to lock the reader-writer lock for reading until given time point.
+	 *
+	 * Template variant of tryLockSharedUntil(TickClock::time_point timePoint).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 * - ETIMEDOUT - the reader-writer lock could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	int tryLockSharedUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryLockSharedUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Tries to lock the reader-writer lock for writing until given time point.
+	 *
+	 * Similar to pthread_rwlock_timedwrlock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_timedwrlock.html
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 * - ETIMEDOUT - the reader-writer lock could not be locked before the specified timeout expired;
+	 */
+
+	int tryLockUntil(TickClock::time_point timePoint);
+
+	/**
+	 * \brief Tries to lock the reader-writer lock for writing until given time point.
+	 *
+	 * Template variant of tryLockUntil(TickClock::time_point timePoint).
+	 *
+	 * \tparam Duration is a std::chrono::duration type used to measure duration
+	 *
+	 * \param [in] timePoint is the time point at which the wait will be terminated without locking
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 * - ETIMEDOUT - the reader-writer lock could not be locked before the specified timeout expired;
+	 */
+
+	template<typename Duration>
+	int tryLockUntil(const std::chrono::time_point<TickClock, Duration> timePoint)
+	{
+		return tryLockUntil(std::chrono::time_point_cast<TickClock::duration>(timePoint));
+	}
+
+	/**
+	 * \brief Unlocks the reader-writer lock held for writing.
+	 *
+	 * Similar to pthread_rwlock_unlock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_unlock.html
+	 *
+	 * If any threads are blocked because of the writer, the lock is transferred to the one with the highest priority.
+	 *
+	 * \return zero if the calling thread successfully unlocked the reader-writer lock, error code otherwise:
+	 * - EPERM - the current thread does not hold the reader-writer lock for writing;
+	 */
+
+	int unlock();
+
+	/**
+	 * \brief Unlocks the reader-writer lock held for reading.
+	 *
+	 * Similar to pthread_rwlock_unlock() -
+	 * http://pubs.opengroup.org/onlinepubs/9699919799/functions/pthread_rwlock_unlock.html
+	 *
+	 * When the last reader unlocks, the writer waiting for readers (if any) is unblocked.
+	 *
+	 * \attention Readers are not tracked, so this function must be called only by a thread which holds the lock for
+	 * reading - otherwise the lock held by another reader is released.
+	 *
+	 * \return zero if the calling thread successfully unlocked the reader-writer lock, error code otherwise:
+	 * - EPERM - the reader-writer lock is not held for reading;
+	 */
+
+	int unlockShared();
+
+	RwLock(const RwLock&) = delete;
+	RwLock(RwLock&&) = default;
+	const RwLock& operator=(const RwLock&) = delete;
+	RwLock& operator=(RwLock&&) = delete;
+
+private:
+
+	/**
+	 * \brief Implementation of lock() and tryLockUntil().
+	 *
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated without locking, nullptr to
+	 * block without timeout
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 * - ETIMEDOUT - the reader-writer lock could not be locked before the specified timeout expired;
+	 */
+
+	int lockInternal(const TickClock::time_point* timePoint);
+
+	/**
+	 * \brief Implementation of lockShared() and tryLockSharedUntil().
+	 *
+	 * \param [in] timePoint is a pointer to time point at which the wait will be terminated without locking, nullptr to
+	 * block without timeout
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 * - ETIMEDOUT - the reader-writer lock could not be locked before the specified timeout expired;
+	 */
+
+	int lockSharedInternal(const TickClock::time_point* timePoint);
+
+	/**
+	 * \brief Tries to lock the reader-writer lock for writing, without waiting for readers to unlock.
+	 *
+	 * Internal version with no interrupt masking. When this function succeeds, current thread must still wait for all
+	 * readers to unlock.
+	 *
+	 * \return zero if the calling thread successfully became the writer, error code otherwise:
+	 * - EBUSY - the reader-writer lock could not be acquired because another writer holds it or waits for it;
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 */
+
+	int tryLockInternal();
+
+	/**
+	 * \brief Tries to lock the reader-writer lock for reading, without blocking.
+	 *
+	 * Internal version with no interrupt masking.
+	 *
+	 * \return zero if the calling thread successfully locked the reader-writer lock, error code otherwise:
+	 * - EBUSY - the reader-writer lock could not be acquired because a writer holds it or waits for it;
+	 * - EDEADLK - the current thread already holds the reader-writer lock for writing;
+	 */
+
+	int tryLockSharedInternal();
+
+	/// control block of the writer - its owner is the current writer (or the one waiting for readers to unlock), all
+	/// other threads blocked because of the writer are kept on its list of blocked threads
+	internal::MutexControlBlock controlBlock_;
+
+	/// writer (owner of controlBlock_) blocked until all readers unlock
+	internal::ThreadList writerBlockedList_;
+
+	/// number of readers which currently hold the lock
+	size_t readers_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_RWLOCK_HPP_
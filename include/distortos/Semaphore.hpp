@@ -2,7 +2,7 @@
  * \file
  * \brief Semaphore class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_SEMAPHORE_HPP_
 #define INCLUDE_DISTORTOS_SEMAPHORE_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include "distortos/internal/scheduler/ThreadList.hpp"
 
 #include "distortos/TickClock.hpp"
@@ -19,6 +21,13 @@
 namespace distortos
 {
 
+namespace internal
+{
+
+class FifoQueueBase;
+
+}	// namespace internal
+
 /**
  * \brief Semaphore is the basic synchronization primitive
  *
@@ -29,6 +38,8 @@ namespace distortos
 
 class Semaphore
 {
+	friend class internal::FifoQueueBase;
+
 public:
 
 	/// type used for semaphore's "value"
@@ -219,6 +230,42 @@ public:
 
 private:
 
+	/**
+	 * \brief Posts the semaphore \a count times at once.
+	 *
+	 * Internal version with no interrupt masking. Up to \a count threads blocked on the semaphore are unblocked, the
+	 * value of the semaphore is incremented by the remaining part of \a count.
+	 *
+	 * \param [in] count is the number of posts
+	 *
+	 * \return zero if the semaphore was posted successfully, error code otherwise:
+	 * - EOVERFLOW - the value of the semaphore would exceed max value, the semaphore was not posted at all;
+	 */
+
+	int postInternal(Value count);
+
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	/**
+	 * \brief Tries to post the semaphore using exclusive access, with no interrupt masking.
+	 *
+	 * This fast path succeeds only when no thread is blocked on the semaphore and its value is below the max value.
+	 *
+	 * \return true if the semaphore was posted, false if post() must be done with interrupt masking
+	 */
+
+	bool tryPostExclusive();
+
+	/**
+	 * \brief Tries to lock the semaphore using exclusive access, with no interrupt masking.
+	 *
+	 * \return true if the semaphore was locked, false if its value is zero
+	 */
+
+	bool tryWaitExclusive();
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	/**
 	 * \brief Internal version of tryWait().
 	 *
@@ -230,6 +277,18 @@ private:
 
 	int tryWaitInternal();
 
+	/**
+	 * \brief Locks the semaphore up to \a count times at once, without blocking.
+	 *
+	 * Internal version with no interrupt masking.
+	 *
+	 * \param [in] count is the max number of lock operations
+	 *
+	 * \return number of performed lock operations, in [0; count] range
+	 */
+
+	Value tryWaitInternal(Value count);
+
 	/// ThreadControlBlock objects blocked on this semaphore
 	internal::ThreadList blockedList_;
 
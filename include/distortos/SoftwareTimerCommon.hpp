@@ -78,6 +78,25 @@ public:
 	const SoftwareTimerCommon& operator=(const SoftwareTimerCommon&) = delete;
 	SoftwareTimerCommon& operator=(SoftwareTimerCommon&&) = delete;
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+protected:
+
+	/**
+	 * \brief SoftwareTimerCommon's constructor
+	 *
+	 * \param [in] tickInterrupt selects whether software timer's function is executed in "tick" interrupt (true) or in
+	 * software timer thread (false)
+	 */
+
+	constexpr explicit SoftwareTimerCommon(const bool tickInterrupt) :
+			softwareTimerControlBlock_{softwareTimerRunner, *this, tickInterrupt}
+	{
+
+	}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 private:
 
 	/// internal SoftwareTimerControlBlock object
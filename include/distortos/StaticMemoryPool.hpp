@@ -0,0 +1,63 @@
+/**
+ * \file
+ * \brief StaticMemoryPool class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICMEMORYPOOL_HPP_
+#define INCLUDE_DISTORTOS_STATICMEMORYPOOL_HPP_
+
+#include "MemoryPool.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticMemoryPool class is a variant of MemoryPool that has automatic storage for blocks.
+ *
+ * \tparam BlockSize is the size of single block, bytes
+ * \tparam Blocks is the number of blocks in the pool
+ *
+ * \ingroup memory
+ */
+
+template<size_t BlockSize, size_t Blocks>
+class StaticMemoryPool : public MemoryPool
+{
+public:
+
+	/// type of uninitialized storage for single block
+	using Storage = typename std::aligned_storage<getAdjustedBlockSize(BlockSize), alignment>::type;
+
+	/**
+	 * \brief StaticMemoryPool's constructor
+	 */
+
+	explicit StaticMemoryPool() :
+			MemoryPool{{bitmapStorage_.data(), internal::dummyDeleter<BitmapWord>},
+					{storage_.data(), internal::dummyDeleter<Storage>}, sizeof(*storage_.data()), storage_.size()}
+	{
+
+	}
+
+private:
+
+	/// storage for bitmap with allocated blocks
+	std::array<BitmapWord, getBitmapWords(Blocks)> bitmapStorage_;
+
+	/// storage for blocks
+	std::array<Storage, Blocks> storage_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICMEMORYPOOL_HPP_
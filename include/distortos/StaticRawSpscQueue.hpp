@@ -0,0 +1,71 @@
+/**
+ * \file
+ * \brief StaticRawSpscQueue class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_STATICRAWSPSCQUEUE_HPP_
+#define INCLUDE_DISTORTOS_STATICRAWSPSCQUEUE_HPP_
+
+#include "RawSpscQueue.hpp"
+
+#include "distortos/internal/memory/dummyDeleter.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+/**
+ * \brief StaticRawSpscQueue class is a variant of RawSpscQueue that has automatic storage for queue's contents.
+ *
+ * \tparam T is the type of data in queue
+ * \tparam QueueSize is the maximum number of elements in queue
+ *
+ * \ingroup queues
+ */
+
+template<typename T, size_t QueueSize>
+class StaticRawSpscQueue : public RawSpscQueue
+{
+public:
+
+	/// type of uninitialized storage for data
+	using Storage = typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+	/**
+	 * \brief StaticRawSpscQueue's constructor
+	 */
+
+	explicit StaticRawSpscQueue() :
+			RawSpscQueue{{storage_.data(), internal::dummyDeleter<Storage>}, sizeof(*storage_.data()), storage_.size()}
+	{
+
+	}
+
+private:
+
+	/// storage for queue's contents
+	std::array<Storage, QueueSize> storage_;
+};
+
+/**
+ * \brief StaticRawSpscQueueFromSize type alias is a variant of StaticRawSpscQueue which uses size of element (instead
+ * of type) as template argument.
+ *
+ * \tparam ElementSize is the size of single queue element, bytes
+ * \tparam QueueSize is the maximum number of elements in queue
+ */
+
+template<size_t ElementSize, size_t QueueSize>
+using StaticRawSpscQueueFromSize =
+		StaticRawSpscQueue<typename std::aligned_storage<ElementSize, ElementSize>::type, QueueSize>;
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_STATICRAWSPSCQUEUE_HPP_
@@ -15,6 +15,8 @@
 #include "distortos/StaticSignalsReceiver.hpp"
 #include "distortos/UndetachableThread.hpp"
 
+#include <functional>
+
 namespace distortos
 {
 
@@ -144,8 +146,8 @@ public:
 
 private:
 
-	/// stack buffer
-	typename std::aligned_storage<StackSize>::type stack_;
+	/// stack buffer, enlarged by the space needed for stack guard (if enabled)
+	typename std::aligned_storage<StackSize + architecture::stackGuardOverhead>::type stack_;
 };
 
 /**
@@ -205,8 +207,8 @@ public:
 
 private:
 
-	/// stack buffer
-	typename std::aligned_storage<StackSize>::type stack_;
+	/// stack buffer, enlarged by the space needed for stack guard (if enabled)
+	typename std::aligned_storage<StackSize + architecture::stackGuardOverhead>::type stack_;
 
 	/// internal StaticSignalsReceiver object
 	StaticSignalsReceiver<QueuedSignals, SignalActions> staticSignalsReceiver_;
@@ -104,6 +104,30 @@ public:
 
 	virtual uint8_t getPriority() const = 0;
 
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	/**
+	 * \return time for which this thread was running, in units of statistics::getRunTimeFrequency()
+	 *
+	 * \ingroup statistics
+	 */
+
+	virtual uint64_t getRunTime() const = 0;
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+
+	/**
+	 * \return max number of bytes of stack which were used by this thread (high-water mark)
+	 *
+	 * \ingroup statistics
+	 */
+
+	virtual size_t getStackHighWaterMark() const = 0;
+
+#endif	// def CONFIG_STACK_PAINTING_ENABLE
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
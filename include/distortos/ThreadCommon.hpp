@@ -99,6 +99,30 @@ public:
 
 	uint8_t getPriority() const override;
 
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	/**
+	 * \return time for which this thread was running, in units of statistics::getRunTimeFrequency()
+	 *
+	 * \ingroup statistics
+	 */
+
+	uint64_t getRunTime() const override;
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+
+	/**
+	 * \return max number of bytes of stack which were used by this thread (high-water mark)
+	 *
+	 * \ingroup statistics
+	 */
+
+	size_t getStackHighWaterMark() const override;
+
+#endif	// def CONFIG_STACK_PAINTING_ENABLE
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
@@ -0,0 +1,295 @@
+/**
+ * \file
+ * \brief TlsfHeap class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_TLSFHEAP_HPP_
+#define INCLUDE_DISTORTOS_TLSFHEAP_HPP_
+
+#include <array>
+#include <utility>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+/**
+ * \brief TlsfHeap class is a heap with "two-level segregated fit" allocator.
+ *
+ * Free blocks are kept on segregated lists - first level splits sizes into powers of two, second level splits each of
+ * these ranges linearly into 16 lists. Bitmaps of non-empty lists make finding a suitable free block a matter of few
+ * "count leading/trailing zeros" operations, so allocate(), deallocate() and resize() take constant time regardless of
+ * number and size of blocks. Free blocks are merged with their free physical neighbours immediately.
+ *
+ * The heap may consist of any number of separate memory regions, added with addRegion().
+ *
+ * \note The object is not synchronized - the user must provide mutual exclusion if it is used from more than one
+ * thread and/or interrupt.
+ *
+ * \ingroup memory
+ */
+
+class TlsfHeap
+{
+public:
+
+	/// statistics of heap
+	struct Statistics
+	{
+		/// total size of all regions of the heap (excluding space used by markers of their ends), bytes
+		size_t totalSize;
+
+		/// total size of free blocks (excluding their headers), bytes - the rest of \a totalSize is used by blocks and
+		/// their headers
+		size_t freeSize;
+
+		/// size of the largest free block, bytes
+		size_t largestFreeBlockSize;
+
+		/// maximum value of (\a totalSize - \a freeSize) since construction of the heap, bytes
+		size_t maxUsedSize;
+
+		/// number of free blocks
+		size_t freeBlocks;
+
+		/// number of used blocks
+		size_t usedBlocks;
+	};
+
+	/// alignment of blocks returned by allocate(), bytes
+	constexpr static size_t alignment {2 * sizeof(void*)};
+
+	/**
+	 * \brief TlsfHeap's constructor
+	 *
+	 * Constructed heap has no memory, regions must be added with addRegion().
+	 */
+
+	constexpr TlsfHeap() :
+			lists_{},
+			secondLevelBitmaps_{},
+			firstLevelBitmap_{},
+			totalSize_{},
+			freeSize_{},
+			maxUsedSize_{},
+			freeBlocks_{},
+			usedBlocks_{}
+	{
+
+	}
+
+	/**
+	 * \brief Adds memory region to the heap.
+	 *
+	 * \param [in] begin is a pointer to beginning of region
+	 * \param [in] size is the size of region, bytes
+	 *
+	 * \return true if region was added, false if it is too small to hold even one minimal block after alignment
+	 */
+
+	bool addRegion(void* begin, size_t size);
+
+	/**
+	 * \brief Allocates block.
+	 *
+	 * \param [in] size is the size of requested block, bytes
+	 *
+	 * \return pointer to allocated block (aligned to \a alignment), nullptr if block could not be allocated
+	 */
+
+	void* allocate(size_t size);
+
+	/**
+	 * \brief Allocates block with given alignment.
+	 *
+	 * \param [in] blockAlignment is the required alignment of block, bytes, must be a power of 2
+	 * \param [in] size is the size of requested block, bytes
+	 *
+	 * \return pointer to allocated block, nullptr if block could not be allocated or \a blockAlignment is invalid
+	 */
+
+	void* allocateAligned(size_t blockAlignment, size_t size);
+
+	/**
+	 * \brief Deallocates block.
+	 *
+	 * \param [in] block is a pointer to block previously allocated from this heap, nullptr is ignored
+	 */
+
+	void deallocate(void* block);
+
+	/**
+	 * \brief Gets statistics of the heap.
+	 *
+	 * \note Finding the largest free block requires traversal of one list of free blocks, so this function - unlike all
+	 * others - doesn't take constant time.
+	 *
+	 * \return statistics of the heap
+	 */
+
+	Statistics getStatistics() const;
+
+	/**
+	 * \param [in] block is a pointer to block previously allocated from this heap
+	 *
+	 * \return usable size of \a block, bytes, greater than or equal to the size requested during allocation
+	 */
+
+	static size_t getUsableSize(const void* block);
+
+	/**
+	 * \brief Tries to resize block in place.
+	 *
+	 * Block is shrunk (releasing the tail, if it is large enough) or grown (if its next physical neighbour is free and
+	 * large enough). Block is never moved.
+	 *
+	 * \param [in] block is a pointer to block previously allocated from this heap
+	 * \param [in] size is the new size of block, bytes
+	 *
+	 * \return true if block was resized, false otherwise (block is not modified)
+	 */
+
+	bool resize(void* block, size_t size);
+
+	TlsfHeap(const TlsfHeap&) = delete;
+	TlsfHeap(TlsfHeap&&) = delete;
+	const TlsfHeap& operator=(const TlsfHeap&) = delete;
+	TlsfHeap& operator=(TlsfHeap&&) = delete;
+
+private:
+
+	struct Block;
+
+	/// log2 of number of second level lists for each first level
+	constexpr static size_t secondLevelLog2 {4};
+
+	/// number of second level lists for each first level
+	constexpr static size_t secondLevelCount {1 << secondLevelLog2};
+
+	/// log2 of alignment
+	constexpr static size_t alignmentLog2 {sizeof(void*) == 8 ? 4 : sizeof(void*) == 4 ? 3 : 2};
+
+	/// log2 of size of smallest block mapped to first level greater than 0, sizes below are mapped linearly to first
+	/// level 0
+	constexpr static size_t firstLevelShift {secondLevelLog2 + alignmentLog2};
+
+	/// log2 of upper limit of block size
+	constexpr static size_t firstLevelMax {sizeof(size_t) == 8 ? 32 : 30};
+
+	/// number of first level lists
+	constexpr static size_t firstLevelCount {firstLevelMax - firstLevelShift + 1};
+
+	static_assert(alignment == 1 << alignmentLog2, "Invalid log2 of alignment!");
+	static_assert(firstLevelCount <= 32 && secondLevelCount <= 32, "Bitmaps are too small!");
+
+	/**
+	 * \param [in] size is the requested size of block, bytes
+	 *
+	 * \return \a size rounded up to the multiple of \a alignment (but not less than minimal size of block), 0 if
+	 * \a size is too large
+	 */
+
+	static size_t adjustSize(size_t size);
+
+	/**
+	 * \param [in] size is the adjusted size of block, bytes
+	 *
+	 * \return pair with indexes of first and second level of list on which free block of \a size should be kept
+	 */
+
+	static std::pair<size_t, size_t> mapInsert(size_t size);
+
+	/**
+	 * \param [in] size is the adjusted size of requested block, bytes
+	 *
+	 * \return pair with indexes of first and second level of the first list on which all free blocks are large enough
+	 * for \a size, index of first level may be out of range
+	 */
+
+	static std::pair<size_t, size_t> mapSearch(size_t size);
+
+	/**
+	 * \brief Converts block to a free block, inserts it into appropriate list and updates statistics.
+	 *
+	 * \param [in] block is a reference to block which will be inserted
+	 */
+
+	void insertFreeBlock(Block& block);
+
+	/**
+	 * \brief Merges block with its free physical neighbours and inserts the result into appropriate list.
+	 *
+	 * \param [in] block is a reference to block which will be merged and inserted, it must not be on any list
+	 */
+
+	void mergeAndInsertFreeBlock(Block& block);
+
+	/**
+	 * \brief Removes free block from its list and updates statistics.
+	 *
+	 * \param [in] block is a reference to free block which will be removed
+	 */
+
+	void removeFreeBlock(Block& block);
+
+	/**
+	 * \brief Finds free block which is large enough, removes it from its list and marks it as used.
+	 *
+	 * \param [in] size is the adjusted size of requested block, bytes
+	 *
+	 * \return pointer to found block, nullptr if there is no suitable free block
+	 */
+
+	Block* takeFreeBlock(size_t size);
+
+	/**
+	 * \brief Splits the tail of block (if it is large enough) and inserts it into appropriate list as free block.
+	 *
+	 * \param [in] block is a reference to used block which will be trimmed
+	 * \param [in] size is the adjusted size of block after trimming, bytes
+	 */
+
+	void trimBlock(Block& block, size_t size);
+
+	/**
+	 * \brief Updates maximum total size of used blocks.
+	 */
+
+	void updateMaxUsedSize();
+
+	/// lists of free blocks
+	std::array<std::array<Block*, secondLevelCount>, firstLevelCount> lists_;
+
+	/// bitmaps of non-empty second level lists, one for each first level
+	std::array<uint32_t, firstLevelCount> secondLevelBitmaps_;
+
+	/// bitmap of first levels with non-empty second level bitmaps
+	uint32_t firstLevelBitmap_;
+
+	/// total size of all regions of the heap, bytes
+	size_t totalSize_;
+
+	/// total size of free blocks, bytes
+	size_t freeSize_;
+
+	/// maximum total size of used blocks, bytes
+	size_t maxUsedSize_;
+
+	/// number of free blocks
+	size_t freeBlocks_;
+
+	/// number of used blocks
+	size_t usedBlocks_;
+};
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_TLSFHEAP_HPP_
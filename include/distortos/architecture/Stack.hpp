@@ -12,6 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_ARCHITECTURE_STACK_HPP_
 #define INCLUDE_DISTORTOS_ARCHITECTURE_STACK_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include <memory>
 
 namespace distortos
@@ -22,6 +24,16 @@ class Thread;
 namespace architecture
 {
 
+/// size of guard placed just below each stack, bytes, 0 if stack guard is not used
+constexpr size_t stackGuardSize {CONFIG_ARCHITECTURE_STACK_GUARD_SIZE};
+
+static_assert((stackGuardSize & (stackGuardSize - 1)) == 0,
+		"CONFIG_ARCHITECTURE_STACK_GUARD_SIZE must be a power of 2!");
+
+/// max number of bytes of stack's storage which may be used for stack guard and its alignment, must be added to the
+/// size of storage for each stack
+constexpr size_t stackGuardOverhead {2 * stackGuardSize};
+
 /// Stack class is an abstraction of architecture's stack
 class Stack
 {
@@ -34,8 +46,10 @@ public:
 	 * \brief Stack's constructor
 	 *
 	 * This function initializes valid architecture-specific stack in provided storage. This requires following steps:
-	 * - adjustment of storage's address to suit architecture's alignment requirements,
+	 * - adjustment of storage's address to suit architecture's alignment requirements and to leave space for stack
+	 * guard (if stackGuardSize is not 0) just below adjusted storage,
 	 * - adjustment of storage's size to suit architecture's divisibility requirements,
+	 * - painting of storage with the pattern (if CONFIG_STACK_PAINTING_ENABLE is defined) or filling it with zeroes,
 	 * - creating hardware and software stack frame in suitable place in the stack,
 	 * - calculation of stack pointer register value.
 	 *
@@ -56,8 +70,9 @@ public:
 	/**
 	 * \brief Stack's constructor
 	 *
-	 * This function adopts existing valid architecture-specific stack in provided storage. No adjustments are done,
-	 * no stack frame is created and stack pointer register's value is not calculated.
+	 * This function adopts existing valid architecture-specific stack in provided storage. No adjustments are done
+	 * (except leaving space for stack guard at the beginning of storage if stackGuardSize is not 0), no stack frame is
+	 * created and stack pointer register's value is not calculated.
 	 *
 	 * This is meant to adopt main()'s stack.
 	 *
@@ -67,12 +82,56 @@ public:
 
 	Stack(void* storage, size_t size);
 
+	/**
+	 * \brief Stack's move constructor
+	 *
+	 * \param [in] other is a rvalue reference to Stack which will be moved, its stack pointer is reset, so it doesn't
+	 * deinitialize the stack when destroyed
+	 */
+
+	Stack(Stack&& other);
+
 	/**
 	 * \brief Stack's destructor
+	 *
+	 * Releases resources acquired by architecture-specific initialization of the stack (if any).
 	 */
 
 	~Stack();
 
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+
+	/**
+	 * \brief Gets high-water mark of the stack.
+	 *
+	 * Stack is assumed to grow towards lower addresses, so the storage is scanned word-wise from its beginning, until
+	 * the first word which doesn't match the pattern used for painting is found.
+	 *
+	 * \return max number of bytes of the stack which were used since its initialization
+	 */
+
+	size_t getHighWaterMark() const;
+
+#endif	// def CONFIG_STACK_PAINTING_ENABLE
+
+	/**
+	 * \return address of stack's storage after adjustments, stack guard (if enabled) is located just below this address
+	 */
+
+	void* getAdjustedStorage() const
+	{
+		return adjustedStorage_;
+	}
+
+	/**
+	 * \return size of stack's storage after adjustments, bytes
+	 */
+
+	size_t getSize() const
+	{
+		return adjustedSize_;
+	}
+
 	/**
 	 * \brief Gets current value of stack pointer.
 	 *
@@ -96,7 +155,6 @@ public:
 	}
 
 	Stack(const Stack&) = delete;
-	Stack(Stack&&) = default;
 	const Stack& operator=(const Stack&) = delete;
 	Stack& operator=(Stack&&) = delete;
 
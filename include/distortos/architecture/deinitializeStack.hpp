@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief deinitializeStack() declaration
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \\par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_DEINITIALIZESTACK_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_DEINITIALIZESTACK_HPP_
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific stack deinitialization.
+ *
+ * This function releases all resources which were acquired by initializeStack() for the stack. It is called when the
+ * stack is destroyed, when the thread which used it will never be executed again.
+ *
+ * \param [in] stackPointer is the current value of thread's stack pointer
+ */
+
+void deinitializeStack(void* stackPointer);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_DEINITIALIZESTACK_HPP_
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief getRunTimeCounter() and getRunTimeCounterFrequency() declarations
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_GETRUNTIMECOUNTER_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_GETRUNTIMECOUNTER_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific reading of free-running high-resolution counter used for run time statistics.
+ *
+ * The counter counts up with frequency returned by getRunTimeCounterFrequency() and wraps around to 0 after reaching
+ * UINT32_MAX, so only differences between readings are meaningful.
+ *
+ * \attention This function must be called with interrupt masking enabled.
+ *
+ * \return current value of free-running high-resolution counter
+ */
+
+uint32_t getRunTimeCounter();
+
+/**
+ * \return frequency of counter read with getRunTimeCounter(), Hz
+ */
+
+uint32_t getRunTimeCounterFrequency();
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_GETRUNTIMECOUNTER_HPP_
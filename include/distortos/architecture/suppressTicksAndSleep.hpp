@@ -0,0 +1,55 @@
+/**
+ * \file
+ * \brief suppressTicksAndSleep() declaration
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_ARCHITECTURE_SUPPRESSTICKSANDSLEEP_HPP_
+#define INCLUDE_DISTORTOS_ARCHITECTURE_SUPPRESSTICKSANDSLEEP_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/**
+ * \brief Architecture-specific suppression of "tick" interrupts combined with sleep.
+ *
+ * Tick timer is reprogrammed to generate next "tick" interrupt after \a ticks ticks (or after the longest period that
+ * the timer supports, whichever is shorter) and the core is put to sleep until any interrupt. After wake-up the tick
+ * timer is restored to regular operation, keeping the original phase of ticks.
+ *
+ * If the sleep lasted for all \a ticks ticks (or for the longest supported period), the "tick" interrupt will be
+ * pending on return - it will be handled as usual once interrupt masking is disabled, accounting for the last tick.
+ * All other ticks which elapsed during sleep must be accounted for by the caller, using the returned value.
+ *
+ * \attention This function must be called with interrupt masking enabled.
+ *
+ * \param [in] ticks is the number of ticks after which "tick" interrupt is needed, values lower than 2 make the
+ * function return immediately, without any sleep
+ *
+ * \return number of complete ticks which elapsed during sleep and for which "tick" interrupt was not and will not be
+ * generated
+ */
+
+uint32_t suppressTicksAndSleep(uint32_t ticks);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
+#endif	// INCLUDE_DISTORTOS_ARCHITECTURE_SUPPRESSTICKSANDSLEEP_HPP_
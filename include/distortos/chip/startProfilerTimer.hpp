@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \brief startProfilerTimer() declaration
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_CHIP_STARTPROFILERTIMER_HPP_
+#define INCLUDE_DISTORTOS_CHIP_STARTPROFILERTIMER_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace chip
+{
+
+/**
+ * \brief Chip-specific start of profiler timer.
+ *
+ * Configures chip's profiler timer to generate periodic interrupts with given frequency. Each interrupt passes program
+ * counter of interrupted code to internal::recordProfilerSample().
+ *
+ * \param [in] frequency is the frequency of interrupts, Hz
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINVAL - \a frequency cannot be achieved with chip's profiler timer;
+ */
+
+int startProfilerTimer(uint32_t frequency);
+
+}	// namespace chip
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_CHIP_STARTPROFILERTIMER_HPP_
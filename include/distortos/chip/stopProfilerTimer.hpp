@@ -0,0 +1,33 @@
+/**
+ * \file
+ * \brief stopProfilerTimer() declaration
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_CHIP_STOPPROFILERTIMER_HPP_
+#define INCLUDE_DISTORTOS_CHIP_STOPPROFILERTIMER_HPP_
+
+namespace distortos
+{
+
+namespace chip
+{
+
+/**
+ * \brief Chip-specific stop of profiler timer.
+ *
+ * After this function returns, internal::recordProfilerSample() is no longer called.
+ */
+
+void stopProfilerTimer();
+
+}	// namespace chip
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_CHIP_STOPPROFILERTIMER_HPP_
@@ -0,0 +1,77 @@
+/**
+ * \file
+ * \brief idle namespace header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_IDLE_HPP_
+#define INCLUDE_DISTORTOS_IDLE_HPP_
+
+#include "distortos/TickClock.hpp"
+
+namespace distortos
+{
+
+namespace idle
+{
+
+/// \addtogroup idle
+/// \{
+
+/**
+ * \return wake-up latency limit - the longest acceptable wake-up latency of sleep mode entered by idle thread,
+ * microseconds
+ */
+
+uint32_t getWakeUpLatencyLimit();
+
+/**
+ * \brief Idle hook.
+ *
+ * Called by idle thread with interrupt masking enabled, each time idle thread is the only runnable thread, to put the
+ * system to sleep until any interrupt. Interrupt handlers are not executed in this function - they remain pending until
+ * idle thread disables interrupt masking after return.
+ *
+ * This function may be used to select sleep mode depending on \a sleepDuration and the limit returned by
+ * getWakeUpLatencyLimit() - for example deeper stop mode of the chip may be entered only when the system is expected to
+ * sleep long enough and wake-up latency of that mode does not exceed the limit. If "tick" interrupts are suppressed
+ * during sleep, the number of ticks that elapsed must be returned, so that tick count can be updated.
+ *
+ * \note Use of this function is optional - it may be left undefined, in which case
+ * architecture::suppressTicksAndSleep() is used if CONFIG_TICKLESS_IDLE_ENABLE is selected and \a sleepDuration is long
+ * enough, otherwise the core just waits for any interrupt with architecture::waitForInterrupt().
+ *
+ * \attention This function is executed by idle thread, which has very small stack.
+ *
+ * \param [in] sleepDuration is the duration after which the earliest active software timer expires, very long duration
+ * if no software timers are active
+ *
+ * \return number of complete ticks which elapsed during sleep and for which "tick" interrupt was not and will not be
+ * generated
+ */
+
+uint32_t hook(TickClock::duration sleepDuration) __attribute__ ((weak));
+
+/**
+ * \brief Sets wake-up latency limit.
+ *
+ * Threads or drivers which require fast response to interrupts may use this function to prevent idle thread from
+ * entering sleep modes with long wake-up latency. Initial value is CONFIG_IDLE_WAKE_UP_LATENCY_LIMIT.
+ *
+ * \param [in] wakeUpLatencyLimit is the new wake-up latency limit, microseconds
+ */
+
+void setWakeUpLatencyLimit(uint32_t wakeUpLatencyLimit);
+
+/// \}
+
+}	// namespace idle
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_IDLE_HPP_
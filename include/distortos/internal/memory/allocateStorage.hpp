@@ -0,0 +1,58 @@
+/**
+ * \file
+ * \brief allocateStorage() and deallocateStorage() declarations
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_ALLOCATESTORAGE_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_ALLOCATESTORAGE_HPP_
+
+#include <cstddef>
+
+namespace distortos
+{
+
+class MemoryResource;
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Allocates storage for Dynamic* object from memory resource.
+ *
+ * Storage is preceded by a small header with pointer to \a memoryResource and size of allocation, so
+ * deallocateStorage() (and storageDeleter()) can return it to the right resource without any additional state.
+ *
+ * \warning Allocation failure is treated the same way as failure of operator new when exceptions are disabled - the
+ * program is aborted.
+ *
+ * \param [in] memoryResource is a reference to MemoryResource from which the storage will be allocated
+ * \param [in] size is the size of requested storage, bytes
+ *
+ * \return pointer to allocated storage, aligned to alignof(std::max_align_t)
+ */
+
+void* allocateStorage(MemoryResource& memoryResource, size_t size);
+
+/**
+ * \brief Returns storage to memory resource from which it was allocated.
+ *
+ * \param [in] storage is a pointer to storage allocated with allocateStorage()
+ */
+
+void deallocateStorage(void* storage);
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_ALLOCATESTORAGE_HPP_
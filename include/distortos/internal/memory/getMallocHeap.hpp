@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief getMallocHeap() declaration
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_GETMALLOCHEAP_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_MEMORY_GETMALLOCHEAP_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_TLSF_HEAP_ENABLE
+
+namespace distortos
+{
+
+class TlsfHeap;
+
+namespace internal
+{
+
+/**
+ * \return reference to main instance of TlsfHeap used by malloc() and free()
+ */
+
+TlsfHeap& getMallocHeap();
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// def CONFIG_TLSF_HEAP_ENABLE
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_MEMORY_GETMALLOCHEAP_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief storageDeleter() definition
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_MEMORY_STORAGEDELETER_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_MEMORY_STORAGEDELETER_HPP_
 
+#include "distortos/internal/memory/allocateStorage.hpp"
+
 namespace distortos
 {
 
@@ -23,18 +25,19 @@ namespace internal
 +---------------------------------------------------------------------------------------------------------------------*/
 
 /**
- * \brief Templated deleter that can be used with std::unique_ptr and dynamic storage allocated with new T[].
+ * \brief Templated deleter that can be used with std::unique_ptr and dynamic storage allocated with allocateStorage().
+ *
+ * Storage is returned to the memory resource from which it was allocated.
  *
- * \tparam T is the real type of allocated storage
- * \tparam U is the type of \a storage pointer
+ * \tparam T is the type of \a storage pointer
  *
  * \param [in] storage is a pointer to storage that will be deleted
  */
 
-template<typename T, typename U>
-void storageDeleter(U* const storage)
+template<typename T>
+void storageDeleter(T* const storage)
 {
-	delete[] reinterpret_cast<T*>(storage);
+	deallocateStorage(storage);
 }
 
 }	// namespace internal
@@ -14,10 +14,13 @@
 
 #include "distortos/DynamicSignalsReceiver.hpp"
 #include "distortos/DynamicThreadParameters.hpp"
+#include "distortos/MemoryResource.hpp"
 #include "distortos/ThreadCommon.hpp"
 
 #include "distortos/internal/memory/storageDeleter.hpp"
 
+#include <functional>
+
 namespace distortos
 {
 
@@ -51,6 +54,8 @@ public:
 	 * \tparam Function is the function that will be executed in separate thread
 	 * \tparam Args are the arguments for \a Function
 	 *
+	 * \param [in] memoryResource is a reference to MemoryResource from which stack and storage for signals will be
+	 * allocated
 	 * \param [in] stackSize is the size of stack, bytes
 	 * \param [in] canReceiveSignals selects whether reception of signals is enabled (true) or disabled (false) for this
 	 * thread
@@ -66,9 +71,9 @@ public:
 	 */
 
 	template<typename Function, typename... Args>
-	DynamicThreadBase(size_t stackSize, bool canReceiveSignals, size_t queuedSignals, size_t signalActions,
-			uint8_t priority, SchedulingPolicy schedulingPolicy, DynamicThread& owner, Function&& function,
-			Args&&... args);
+	DynamicThreadBase(MemoryResource& memoryResource, size_t stackSize, bool canReceiveSignals, size_t queuedSignals,
+			size_t signalActions, uint8_t priority, SchedulingPolicy schedulingPolicy, DynamicThread& owner,
+			Function&& function, Args&&... args);
 
 	/**
 	 * \brief Detaches the thread.
@@ -85,6 +90,32 @@ public:
 
 	int detach() override;
 
+	/**
+	 * \brief Allocates memory for DynamicThreadBase object from memory resource.
+	 *
+	 * Before the allocation, storage of detached threads which already terminated is released (if it is possible to do
+	 * that without blocking), so that it can be reused immediately - for example by RecyclingMemoryResource - instead
+	 * of waiting for the idle thread to do the cleanup.
+	 *
+	 * \param [in] size is the size of allocated object, bytes
+	 * \param [in] memoryResource is a reference to MemoryResource from which the object will be allocated
+	 *
+	 * \return pointer to allocated memory
+	 */
+
+	static void* operator new(size_t size, MemoryResource& memoryResource);
+
+	/**
+	 * \brief Returns memory of DynamicThreadBase object to memory resource from which it was allocated.
+	 *
+	 * \param [in] storage is a pointer to memory of deleted object
+	 */
+
+	static void operator delete(void* const storage)
+	{
+		deallocateStorage(storage);
+	}
+
 #else	// !def CONFIG_THREAD_DETACH_ENABLE
 
 	/**
@@ -107,8 +138,15 @@ public:
 	 */
 
 	template<typename Function, typename... Args>
-	DynamicThreadBase(size_t stackSize, bool canReceiveSignals, size_t queuedSignals, size_t signalActions,
-			uint8_t priority, SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args);
+	DynamicThreadBase(const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
+			const size_t signalActions, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
+			Function&& function, Args&&... args) :
+			DynamicThreadBase{getNewDeleteMemoryResource(), stackSize, canReceiveSignals, queuedSignals,
+					signalActions, priority, schedulingPolicy, std::forward<Function>(function),
+					std::forward<Args>(args)...}
+	{
+
+	}
 
 	/**
 	 * \brief DynamicThreadBase's constructor
@@ -130,6 +168,55 @@ public:
 
 	}
 
+	/**
+	 * \brief DynamicThreadBase's constructor
+	 *
+	 * \tparam Function is the function that will be executed in separate thread
+	 * \tparam Args are the arguments for \a Function
+	 *
+	 * \param [in] memoryResource is a reference to MemoryResource from which stack and storage for signals will be
+	 * allocated
+	 * \param [in] stackSize is the size of stack, bytes
+	 * \param [in] canReceiveSignals selects whether reception of signals is enabled (true) or disabled (false) for this
+	 * thread
+	 * \param [in] queuedSignals is the max number of queued signals for this thread, relevant only if
+	 * \a canReceiveSignals == true, 0 to disable queuing of signals for this thread
+	 * \param [in] signalActions is the max number of different SignalAction objects for this thread, relevant only if
+	 * \a canReceiveSignals == true, 0 to disable catching of signals for this thread
+	 * \param [in] priority is the thread's priority, 0 - lowest, UINT8_MAX - highest
+	 * \param [in] schedulingPolicy is the scheduling policy of the thread
+	 * \param [in] function is a function that will be executed in separate thread
+	 * \param [in] args are arguments for \a function
+	 */
+
+	template<typename Function, typename... Args>
+	DynamicThreadBase(MemoryResource& memoryResource, size_t stackSize, bool canReceiveSignals, size_t queuedSignals,
+			size_t signalActions, uint8_t priority, SchedulingPolicy schedulingPolicy, Function&& function,
+			Args&&... args);
+
+	/**
+	 * \brief DynamicThreadBase's constructor
+	 *
+	 * \tparam Function is the function that will be executed in separate thread
+	 * \tparam Args are the arguments for \a Function
+	 *
+	 * \param [in] memoryResource is a reference to MemoryResource from which stack and storage for signals will be
+	 * allocated
+	 * \param [in] parameters is a DynamicThreadParameters struct with thread parameters
+	 * \param [in] function is a function that will be executed in separate thread
+	 * \param [in] args are arguments for \a function
+	 */
+
+	template<typename Function, typename... Args>
+	DynamicThreadBase(MemoryResource& memoryResource, const DynamicThreadParameters parameters, Function&& function,
+			Args&&... args) :
+			DynamicThreadBase{memoryResource, parameters.stackSize, parameters.canReceiveSignals,
+					parameters.queuedSignals, parameters.signalActions, parameters.priority,
+					parameters.schedulingPolicy, std::forward<Function>(function), std::forward<Args>(args)...}
+	{
+
+	}
+
 #endif	// !def CONFIG_THREAD_DETACH_ENABLE
 
 	DynamicThreadBase(const DynamicThreadBase&) = delete;
@@ -192,13 +279,14 @@ private:
 #ifdef CONFIG_THREAD_DETACH_ENABLE
 
 template<typename Function, typename... Args>
-DynamicThreadBase::DynamicThreadBase(const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
-		const size_t signalActions, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
-		DynamicThread& owner, Function&& function, Args&&... args) :
-				ThreadCommon{{{new uint8_t[stackSize], storageDeleter<uint8_t>}, stackSize, *this, run,
-						preTerminationHook, terminationHook}, priority, schedulingPolicy, nullptr,
+DynamicThreadBase::DynamicThreadBase(MemoryResource& memoryResource, const size_t stackSize,
+		const bool canReceiveSignals, const size_t queuedSignals, const size_t signalActions, const uint8_t priority,
+		const SchedulingPolicy schedulingPolicy, DynamicThread& owner, Function&& function, Args&&... args) :
+				ThreadCommon{{{allocateStorage(memoryResource, stackSize + architecture::stackGuardOverhead),
+						storageDeleter<void>}, stackSize + architecture::stackGuardOverhead, *this,
+						run, preTerminationHook, terminationHook}, priority, schedulingPolicy, nullptr,
 						canReceiveSignals == true ? &dynamicSignalsReceiver_ : nullptr},
-				dynamicSignalsReceiver_{canReceiveSignals == true ? queuedSignals : 0,
+				dynamicSignalsReceiver_{memoryResource, canReceiveSignals == true ? queuedSignals : 0,
 						canReceiveSignals == true ? signalActions : 0},
 				boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)},
 				owner_{&owner}
@@ -209,13 +297,14 @@ DynamicThreadBase::DynamicThreadBase(const size_t stackSize, const bool canRecei
 #else	// !def CONFIG_THREAD_DETACH_ENABLE
 
 template<typename Function, typename... Args>
-DynamicThreadBase::DynamicThreadBase(const size_t stackSize, const bool canReceiveSignals, const size_t queuedSignals,
-		const size_t signalActions, const uint8_t priority, const SchedulingPolicy schedulingPolicy,
-		Function&& function, Args&&... args) :
-				ThreadCommon{{{new uint8_t[stackSize], storageDeleter<uint8_t>}, stackSize, *this, run, nullptr,
-						terminationHook}, priority, schedulingPolicy, nullptr,
+DynamicThreadBase::DynamicThreadBase(MemoryResource& memoryResource, const size_t stackSize,
+		const bool canReceiveSignals, const size_t queuedSignals, const size_t signalActions, const uint8_t priority,
+		const SchedulingPolicy schedulingPolicy, Function&& function, Args&&... args) :
+				ThreadCommon{{{allocateStorage(memoryResource, stackSize + architecture::stackGuardOverhead),
+						storageDeleter<void>}, stackSize + architecture::stackGuardOverhead, *this,
+						run, nullptr, terminationHook}, priority, schedulingPolicy, nullptr,
 						canReceiveSignals == true ? &dynamicSignalsReceiver_ : nullptr},
-				dynamicSignalsReceiver_{canReceiveSignals == true ? queuedSignals : 0,
+				dynamicSignalsReceiver_{memoryResource, canReceiveSignals == true ? queuedSignals : 0,
 						canReceiveSignals == true ? signalActions : 0},
 				boundFunction_{std::bind(std::forward<Function>(function), std::forward<Args>(args)...)}
 {
@@ -0,0 +1,210 @@
+/**
+ * \file
+ * \brief RunnableThreadList class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNNABLETHREADLIST_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNNABLETHREADLIST_HPP_
+
+#include "distortos/internal/scheduler/ThreadList.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE
+
+#include <array>
+#include <utility>
+
+#endif	// def CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief RunnableThreadList class is a ThreadList used by Scheduler for threads in "runnable" state.
+ *
+ * The order of elements is identical to the one of ThreadList - descending effective priority, FIFO within the group
+ * of threads with the same effective priority.
+ *
+ * When CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE is selected, the list additionally maintains a 256-bit bitmap of
+ * priorities which have at least one thread on the list and an iterator to the last thread of each such priority. This
+ * way the position of inserted thread is found with a few CLZ instructions instead of linear search over all
+ * runnable threads, so insert(), splice(), erase(), rotate() and reposition() execute in constant time. Otherwise all
+ * these operations are just forwarded to ThreadList.
+ *
+ * \attention All modifications of this list must be done with the functions of this class - the state of the list is
+ * undefined if elements are linked or unlinked via any other means (e.g. with functions of ThreadList or by splicing
+ * them to another list).
+ */
+
+class RunnableThreadList : public ThreadList
+{
+public:
+
+	/**
+	 * \brief RunnableThreadList's constructor
+	 */
+
+	constexpr RunnableThreadList() :
+			ThreadList{}
+#ifdef CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE
+			, bitmap_{},
+			lastElements_{}
+#endif	// def CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE
+	{
+
+	}
+
+	/**
+	 * \brief Unlinks the element at \a position from the list.
+	 *
+	 * \param [in] position is an iterator of the element that will be unlinked from the list
+	 *
+	 * \return iterator of the element that was following the element which was unlinked
+	 */
+
+	iterator erase(iterator position);
+
+	/**
+	 * \brief Links the element in the list, keeping it sorted.
+	 *
+	 * The element is placed at the end of the group of elements with the same effective priority. If the element is
+	 * linked in another list, it is unlinked from it first.
+	 *
+	 * \param [in] newElement is a reference to the element that will be linked in the list
+	 *
+	 * \return iterator of \a newElement
+	 */
+
+	iterator insert(reference newElement);
+
+	/**
+	 * \brief Adjusts position of the element which changed its effective priority while being on the list.
+	 *
+	 * \param [in] position is an iterator of the element that changed its effective priority
+	 * \param [in] previousEffectivePriority is the effective priority of element before the change
+	 * \param [in] loweringBefore selects the method of ordering when lowering the priority (it must be false when the
+	 * priority is raised!):
+	 * - true - the element is moved to the head of the group of elements with the new priority,
+	 * - false - the element is moved to the tail of the group of elements with the new priority.
+	 */
+
+	void reposition(iterator position, uint8_t previousEffectivePriority, bool loweringBefore);
+
+	/**
+	 * \brief Moves the element to the end of the group of elements with the same effective priority.
+	 *
+	 * \param [in] position is an iterator of the element that will be moved
+	 */
+
+	void rotate(iterator position);
+
+	/**
+	 * \brief Transfers the element from another list to this one, keeping it sorted.
+	 *
+	 * \param [in] splicedElement is an iterator of the element that will be spliced from another list to this one
+	 */
+
+	void splice(const iterator splicedElement)
+	{
+		insert(*splicedElement);
+	}
+
+	RunnableThreadList(const RunnableThreadList&) = delete;
+	RunnableThreadList(RunnableThreadList&&) = delete;
+	const RunnableThreadList& operator=(const RunnableThreadList&) = delete;
+	RunnableThreadList& operator=(RunnableThreadList&&) = delete;
+
+#ifdef CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE
+
+private:
+
+	/// type of single word of bitmap
+	using BitmapWord = uint32_t;
+
+	/// number of bits in single word of bitmap
+	constexpr static size_t bitsPerBitmapWord {sizeof(BitmapWord) * 8};
+
+	/// number of different priorities
+	constexpr static size_t priorities {UINT8_MAX + 1};
+
+	/**
+	 * \brief Clears the bit of given priority in the bitmap.
+	 *
+	 * \param [in] priority is the priority which has no elements on the list
+	 */
+
+	void clearBit(const uint8_t priority)
+	{
+		bitmap_[priority / bitsPerBitmapWord] &= ~getBitMask(priority);
+	}
+
+	/**
+	 * \brief Finds lowest priority which has at least one element on the list and is not lower than \a priority.
+	 *
+	 * \param [in] priority is the priority from which the search is started
+	 *
+	 * \return pair with true and found priority if any was found, pair with false and undefined value otherwise
+	 */
+
+	std::pair<bool, uint8_t> findPriority(size_t priority) const;
+
+	/**
+	 * \brief Links the element in the list.
+	 *
+	 * \param [in] element is a reference to the element that will be linked in the list
+	 * \param [in] priority is the priority of \a element
+	 * \param [in] atHead selects whether the element will be placed at the head (true) or at the tail (false) of the
+	 * group of elements with the same priority
+	 *
+	 * \return iterator of \a element
+	 */
+
+	iterator link(reference element, uint8_t priority, bool atHead);
+
+	/**
+	 * \brief Unlinks the element from the list.
+	 *
+	 * \param [in] position is an iterator of the element that will be unlinked from the list
+	 * \param [in] priority is the priority with which the element was linked in the list
+	 *
+	 * \return iterator of the element that was following the element which was unlinked
+	 */
+
+	iterator unlink(iterator position, uint8_t priority);
+
+	/**
+	 * \param [in] priority is the priority for which the mask will be returned
+	 *
+	 * \return mask of the bit of given priority in its bitmap word - the highest bit of the word is used for the lowest
+	 * priority, so that CLZ instruction can be used to find the next used priority
+	 */
+
+	constexpr static BitmapWord getBitMask(const uint8_t priority)
+	{
+		return (BitmapWord{1} << (bitsPerBitmapWord - 1)) >> (priority % bitsPerBitmapWord);
+	}
+
+	/// bitmap of priorities which have at least one element on the list
+	std::array<BitmapWord, priorities / bitsPerBitmapWord> bitmap_;
+
+	/// iterators to the last element of each priority, valid only if the bit of that priority is set in bitmap_
+	std::array<iterator, priorities> lastElements_;
+
+#endif	// def CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RUNNABLETHREADLIST_HPP_
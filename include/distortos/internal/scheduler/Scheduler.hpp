@@ -12,8 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SCHEDULER_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SCHEDULER_HPP_
 
+#include "distortos/internal/scheduler/RunnableThreadList.hpp"
 #include "distortos/internal/scheduler/ThreadControlBlock.hpp"
-#include "distortos/internal/scheduler/ThreadList.hpp"
 #include "distortos/internal/scheduler/SoftwareTimerSupervisor.hpp"
 
 namespace distortos
@@ -39,6 +39,13 @@ public:
 			suspendedList_{},
 			softwareTimerSupervisor_{},
 			contextSwitchCount_{},
+			idleTickCount_{},
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+			interruptRunTime_{},
+			totalRunTime_{},
+			runTimeCounter_{},
+			interruptNesting_{},
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
 			tickCount_{}
 	{
 
@@ -118,6 +125,27 @@ public:
 
 	uint64_t getContextSwitchCount() const;
 
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	/**
+	 * \brief Marks the beginning of interrupt handler for run time statistics.
+	 *
+	 * Time elapsed since previous measurement is charged to current thread (or to interrupts, if this is a nested
+	 * interrupt) and all time until matching call to exitInterrupt() will be charged to interrupts.
+	 */
+
+	void enterInterrupt();
+
+	/**
+	 * \brief Marks the end of interrupt handler for run time statistics.
+	 *
+	 * Time elapsed since previous measurement is charged to interrupts.
+	 */
+
+	void exitInterrupt();
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
 	/**
 	 * \return reference to currently active ThreadControlBlock
 	 */
@@ -145,12 +173,52 @@ public:
 		return softwareTimerSupervisor_;
 	}
 
+	/**
+	 * \return number of "tick" interrupts which interrupted idle thread, including ticks suppressed during sleep
+	 */
+
+	uint64_t getIdleTickCount() const;
+
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	/**
+	 * \return time spent in interrupts, in units of architecture::getRunTimeCounter()
+	 */
+
+	uint64_t getInterruptRunTime();
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
 	/**
 	 * \return current value of tick count
 	 */
 
 	uint64_t getTickCount() const;
 
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	/**
+	 * \return total time since the start of scheduling, in units of architecture::getRunTimeCounter()
+	 */
+
+	uint64_t getTotalRunTime();
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	/**
+	 * \brief Puts the system to sleep until any interrupt.
+	 *
+	 * If idle thread is the only runnable thread, the system is put to sleep with idle::hook() (if it is defined),
+	 * with tickless sleep (if CONFIG_TICKLESS_IDLE_ENABLE is selected and the earliest active software timer does not
+	 * expire in the next tick) or with architecture::waitForInterrupt(). Tick count is updated with the number of
+	 * ticks that elapsed during sleep for which "tick" interrupt was suppressed. If any other thread is runnable, this
+	 * function returns immediately.
+	 *
+	 * \attention This function should be called only by idle thread.
+	 */
+
+	void idle();
+
 	/**
 	 * \brief Scheduler's initialization
 	 *
@@ -259,6 +327,35 @@ public:
 	void unblock(ThreadList::iterator iterator,
 			ThreadControlBlock::UnblockReason unblockReason = ThreadControlBlock::UnblockReason::unblockRequest);
 
+	/**
+	 * \brief Unblocks all threads from provided container, transferring them to "runnable" container.
+	 *
+	 * Threads are unblocked in the order of the container (highest priority first) and the need for context switch is
+	 * evaluated only once, after all threads are unblocked.
+	 *
+	 * \param [in] container is a reference to container with blocked threads, it is empty after the call
+	 * \param [in] unblockReason is the reason of unblocking of the threads, default -
+	 * ThreadControlBlock::UnblockReason::unblockRequest
+	 */
+
+	void unblockAll(ThreadList& container,
+			ThreadControlBlock::UnblockReason unblockReason = ThreadControlBlock::UnblockReason::unblockRequest);
+
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	/**
+	 * \brief Updates run time statistics.
+	 *
+	 * Time elapsed since previous measurement is charged to current thread or to interrupts, if an interrupt handler
+	 * is being executed.
+	 *
+	 * \attention This function must be called with interrupt masking enabled.
+	 */
+
+	void updateRunTime();
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
 	/**
 	 * \brief Yields time slot of the scheduler to next thread.
 	 */
@@ -329,7 +426,7 @@ private:
 	ThreadList::iterator currentThreadControlBlock_;
 
 	/// list of ThreadControlBlock elements in "runnable" state, sorted by priority in descending order
-	ThreadList runnableList_;
+	RunnableThreadList runnableList_;
 
 	/// list of ThreadControlBlock elements in "suspended" state, sorted by priority in descending order
 	ThreadList suspendedList_;
@@ -340,6 +437,25 @@ private:
 	/// number of context switches
 	uint64_t contextSwitchCount_;
 
+	/// number of "tick" interrupts which interrupted idle thread, including ticks suppressed during sleep
+	uint64_t idleTickCount_;
+
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	/// time spent in interrupts, in units of architecture::getRunTimeCounter()
+	uint64_t interruptRunTime_;
+
+	/// total time since the start of scheduling, in units of architecture::getRunTimeCounter()
+	uint64_t totalRunTime_;
+
+	/// value of architecture::getRunTimeCounter() at previous measurement
+	uint32_t runTimeCounter_;
+
+	/// nesting level of interrupts which are included in run time statistics
+	uint8_t interruptNesting_;
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
 	/// tick count
 	uint64_t tickCount_;
 };
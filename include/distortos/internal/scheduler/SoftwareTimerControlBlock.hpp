@@ -12,6 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERCONTROLBLOCK_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERCONTROLBLOCK_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include "distortos/internal/scheduler/SoftwareTimerListNode.hpp"
 
 namespace distortos
@@ -32,6 +34,31 @@ public:
 	/// type of runner for software timer's function
 	using FunctionRunner = void(SoftwareTimer&);
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \brief SoftwareTimerControlBlock's constructor
+	 *
+	 * \param [in] functionRunner is a reference to runner for software timer's function
+	 * \param [in] owner is a reference to SoftwareTimer object that owns this SoftwareTimerControlBlock
+	 * \param [in] tickInterrupt selects whether software timer's function is executed in "tick" interrupt (true) or in
+	 * software timer thread (false), default - false
+	 */
+
+	constexpr SoftwareTimerControlBlock(FunctionRunner& functionRunner, SoftwareTimer& owner,
+			const bool tickInterrupt = {}) :
+			SoftwareTimerListNode{},
+			period_{},
+			functionRunner_{functionRunner},
+			owner_{owner},
+			tickInterrupt_{tickInterrupt},
+			deferred_{}
+	{
+
+	}
+
+#else	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 	/**
 	 * \brief SoftwareTimerControlBlock's constructor
 	 *
@@ -48,6 +75,8 @@ public:
 
 	}
 
+#endif	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 	/**
 	 * \brief SoftwareTimerControlBlock's destructor
 	 *
@@ -59,7 +88,22 @@ public:
 		stop();
 	}
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \return true if the timer expired and waits for execution by software timer thread, false otherwise
+	 */
+
+	bool isDeferred() const
+	{
+		return deferred_;
+	}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 	/**
+	 * \note Expired software timer which waits for execution by software timer thread is still considered running.
+	 *
 	 * \return true if the timer is running, false otherwise
 	 */
 
@@ -78,6 +122,35 @@ public:
 
 	void run(SoftwareTimerSupervisor& supervisor);
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \brief Runs software timer's function in software timer thread.
+	 *
+	 * Software timer's function is executed with interrupts unmasked.
+	 *
+	 * \note this should only be called by SoftwareTimerSupervisor::runDeferred() with masked interrupts
+	 *
+	 * \param [in] supervisor is a reference to SoftwareTimerSupervisor that manages this object
+	 */
+
+	void runDeferred(SoftwareTimerSupervisor& supervisor);
+
+	/**
+	 * \brief Sets or clears the flag which marks expired software timer waiting for execution by software timer thread.
+	 *
+	 * \note this should only be called by SoftwareTimerSupervisor
+	 *
+	 * \param [in] deferred is the new value of the flag
+	 */
+
+	void setDeferred(const bool deferred)
+	{
+		deferred_ = deferred;
+	}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 	/**
 	 * \brief Starts the timer.
 	 *
@@ -117,6 +190,16 @@ private:
 
 	void stopInternal();
 
+	/**
+	 * \brief Restarts periodic software timer after execution of its function.
+	 *
+	 * Nothing is done if the timer was restarted in its function or if it is a one-shot timer.
+	 *
+	 * \param [in] supervisor is a reference to SoftwareTimerSupervisor to which this object will be added
+	 */
+
+	void restart(SoftwareTimerSupervisor& supervisor);
+
 	/// period used to restart repetitive software timer, 0 for one-shot software timers
 	TickClock::duration period_;
 
@@ -125,6 +208,17 @@ private:
 
 	/// reference to SoftwareTimer object that owns this SoftwareTimerControlBlock
 	SoftwareTimer& owner_;
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/// true if software timer's function is executed in "tick" interrupt, false if it is executed in software timer
+	/// thread
+	bool tickInterrupt_;
+
+	/// true if the timer expired and waits for execution by software timer thread, false otherwise
+	bool deferred_;
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
 };
 
 }	// namespace internal
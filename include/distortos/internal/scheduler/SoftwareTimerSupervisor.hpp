@@ -2,7 +2,7 @@
  * \file
  * \brief SoftwareTimerSupervisor class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,15 +12,54 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERSUPERVISOR_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERSUPERVISOR_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+#include "distortos/Semaphore.hpp"
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+#ifdef CONFIG_SOFTWARE_TIMER_TIMING_WHEEL
+
+#include "distortos/internal/scheduler/SoftwareTimerListNode.hpp"
+
+#include <array>
+
+#else	// !def CONFIG_SOFTWARE_TIMER_TIMING_WHEEL
+
 #include "distortos/internal/scheduler/SoftwareTimerList.hpp"
 
+#endif	// !def CONFIG_SOFTWARE_TIMER_TIMING_WHEEL
+
 namespace distortos
 {
 
 namespace internal
 {
 
-/// SoftwareTimerSupervisor class is a supervisor of software timers
+#if defined(CONFIG_SOFTWARE_TIMER_TIMING_WHEEL) || defined(CONFIG_SOFTWARE_TIMER_THREAD_ENABLE)
+
+class SoftwareTimerControlBlock;
+
+#endif	// defined(CONFIG_SOFTWARE_TIMER_TIMING_WHEEL) || defined(CONFIG_SOFTWARE_TIMER_THREAD_ENABLE)
+
+/**
+ * \brief SoftwareTimerSupervisor class is a supervisor of software timers
+ *
+ * When CONFIG_SOFTWARE_TIMER_TIMING_WHEEL is selected, active software timers are kept in a hierarchical timing wheel.
+ * Level N of the wheel has 2^CONFIG_SOFTWARE_TIMER_TIMING_WHEEL_SLOT_BITS slots, each covering the range of
+ * 2^(N * CONFIG_SOFTWARE_TIMER_TIMING_WHEEL_SLOT_BITS) ticks. Software timer is linked in the slot of the lowest level
+ * which can hold its expiration time point, so starting and stopping it takes constant time. When the range of a slot
+ * begins, all software timers from this slot are moved to lower levels - eventually each of them reaches level 0, where
+ * each slot corresponds to exactly one tick. Software timers with the same expiration time point are executed in the
+ * order in which they were started, just like with the sorted list. Otherwise active software timers are kept on a
+ * list sorted by expiration time point.
+ *
+ * When CONFIG_SOFTWARE_TIMER_THREAD_ENABLE is selected, expired software timers which are not marked for execution in
+ * "tick" interrupt are moved to the list of deferred software timers, which is emptied by software timer thread.
+ */
+
 class SoftwareTimerSupervisor
 {
 public:
@@ -30,7 +69,18 @@ public:
 	 */
 
 	constexpr SoftwareTimerSupervisor() :
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+			deferredList_{},
+			semaphore_{0, 1},
+			deferredCount_{},
+			maxDeferredCount_{},
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+#ifdef CONFIG_SOFTWARE_TIMER_TIMING_WHEEL
+			wheel_(),
+			currentTick_{}
+#else	// !def CONFIG_SOFTWARE_TIMER_TIMING_WHEEL
 			activeList_{}
+#endif	// !def CONFIG_SOFTWARE_TIMER_TIMING_WHEEL
 	{
 
 	}
@@ -43,6 +93,61 @@ public:
 
 	void add(SoftwareTimerControlBlock& softwareTimerControlBlock);
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \brief Removes expired SoftwareTimerControlBlock from the list of deferred software timers, effectively stopping
+	 * the software timer before its function is executed by software timer thread.
+	 *
+	 * \note this should only be called by SoftwareTimerControlBlock with masked interrupts
+	 *
+	 * \param [in] softwareTimerControlBlock is the SoftwareTimerControlBlock being removed
+	 */
+
+	void cancelDeferred(SoftwareTimerControlBlock& softwareTimerControlBlock);
+
+	/**
+	 * \brief Adds expired SoftwareTimerControlBlock to the list of deferred software timers and wakes software timer
+	 * thread.
+	 *
+	 * \note this should only be called by SoftwareTimerControlBlock::run() in "tick" interrupt
+	 *
+	 * \param [in] softwareTimerControlBlock is the SoftwareTimerControlBlock being deferred
+	 */
+
+	void defer(SoftwareTimerControlBlock& softwareTimerControlBlock);
+
+	/**
+	 * \return current number of expired software timers waiting for execution by software timer thread
+	 */
+
+	size_t getDeferredCount() const
+	{
+		return deferredCount_;
+	}
+
+	/**
+	 * \return maximal number of expired software timers waiting for execution by software timer thread
+	 */
+
+	size_t getMaxDeferredCount() const
+	{
+		return maxDeferredCount_;
+	}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \note When CONFIG_SOFTWARE_TIMER_TIMING_WHEEL is selected, the returned value may be earlier than the actual
+	 * expiration time point - for software timers which are not yet on level 0 of the wheel, the time point at which
+	 * they will be moved to lower level is returned.
+	 *
+	 * \return time point of the earliest expiration of active software timers, TickClock::time_point::max() if no
+	 * software timers are active
+	 */
+
+	TickClock::time_point getNextTimePoint() const;
+
 	/**
 	 * \brief Handler of "tick" interrupt.
 	 *
@@ -53,10 +158,86 @@ public:
 
 	void tickInterruptHandler(TickClock::time_point timePoint);
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/**
+	 * \brief Waits for expired software timers and executes their functions.
+	 *
+	 * \note this should only be called by software timer thread
+	 */
+
+	void runDeferred();
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 private:
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	/// unsorted intrusive list of software timers (software timer control blocks)
+	using DeferredList =
+			estd::IntrusiveList<SoftwareTimerListNode, &SoftwareTimerListNode::node, SoftwareTimerControlBlock>;
+
+	/// list of expired software timers waiting for execution by software timer thread
+	DeferredList deferredList_;
+
+	/// semaphore used to wake software timer thread
+	Semaphore semaphore_;
+
+	/// current number of expired software timers waiting for execution by software timer thread
+	size_t deferredCount_;
+
+	/// maximal number of expired software timers waiting for execution by software timer thread
+	size_t maxDeferredCount_;
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+#ifdef CONFIG_SOFTWARE_TIMER_TIMING_WHEEL
+
+	/// unsorted intrusive list of software timers (software timer control blocks), used as a slot of the wheel
+	using Slot = estd::IntrusiveList<SoftwareTimerListNode, &SoftwareTimerListNode::node, SoftwareTimerControlBlock>;
+
+	/// base 2 logarithm of number of slots in each level of the wheel
+	constexpr static size_t slotBits {CONFIG_SOFTWARE_TIMER_TIMING_WHEEL_SLOT_BITS};
+
+	/// number of slots in each level of the wheel
+	constexpr static size_t slotsPerLevel {1 << slotBits};
+
+	/// number of levels of the wheel
+	constexpr static size_t levels {CONFIG_SOFTWARE_TIMER_TIMING_WHEEL_LEVELS};
+
+	static_assert(slotBits * levels < sizeof(TickClock::rep) * 8, "Invalid configuration of timing wheel!");
+
+	/**
+	 * \brief Moves all software timers from the slot of given level which begins at current tick to lower levels.
+	 *
+	 * \param [in] level is the level of the wheel, must be greater than 0
+	 */
+
+	void cascade(size_t level);
+
+	/**
+	 * \brief Selects the slot of the wheel in which software timer should be linked.
+	 *
+	 * \param [in] tick is the tick in which the software timer will be executed, must not be earlier than current tick
+	 *
+	 * \return reference to slot in which software timer executed in \a tick should be linked
+	 */
+
+	Slot& getSlot(TickClock::rep tick);
+
+	/// levels of the wheel, each with slots of software timers
+	std::array<std::array<Slot, slotsPerLevel>, levels> wheel_;
+
+	/// last tick that was handled by tickInterruptHandler()
+	TickClock::rep currentTick_;
+
+#else	// !def CONFIG_SOFTWARE_TIMER_TIMING_WHEEL
+
 	/// list of active software timers (waiting for execution)
 	SoftwareTimerList activeList_;
+
+#endif	// !def CONFIG_SOFTWARE_TIMER_TIMING_WHEEL
 };
 
 }	// namespace internal
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadControlBlock class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -32,6 +32,7 @@ class SignalsReceiver;
 namespace internal
 {
 
+struct EventFlagsWaiter;
 class SignalsReceiverControlBlock;
 class ThreadList;
 class ThreadGroupControlBlock;
@@ -81,6 +82,23 @@ public:
 
 	~ThreadControlBlock();
 
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	/**
+	 * \brief Adds time to run time of thread.
+	 *
+	 * \attention This function should be called only by Scheduler.
+	 *
+	 * \param [in] runTime is the time that will be added, in units of architecture::getRunTimeCounter()
+	 */
+
+	void addRunTime(const uint32_t runTime)
+	{
+		runTime_ += runTime;
+	}
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
 	/**
 	 * \brief Hook function executed when thread is added to scheduler.
 	 *
@@ -110,6 +128,16 @@ public:
 		unblockFunctor_ = unblockFunctor;
 	}
 
+	/**
+	 * \return pointer to EventFlagsWaiter describing the wait of this thread, valid only when the thread is blocked on
+	 * EventFlags
+	 */
+
+	EventFlagsWaiter* getEventFlagsWaiter() const
+	{
+		return eventFlagsWaiter_;
+	}
+
 	/**
 	 * \return pointer to list that has this object
 	 */
@@ -128,6 +156,16 @@ public:
 		return ownedProtocolMutexList_;
 	}
 
+	/**
+	 * \return pointer to ThreadGroupControlBlock with which this object is associated, nullptr if it was not yet
+	 * started
+	 */
+
+	ThreadGroupControlBlock* getThreadGroupControlBlock() const
+	{
+		return threadGroupControlBlock_;
+	}
+
 	/**
 	 * \return reference to Thread object that owns this ThreadControlBlock
 	 */
@@ -146,6 +184,19 @@ public:
 		return roundRobinQuantum_;
 	}
 
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	/**
+	 * \return run time of thread, in units of architecture::getRunTimeCounter()
+	 */
+
+	uint64_t getRunTime() const
+	{
+		return runTime_;
+	}
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
 	/**
 	 * \return scheduling policy of the thread
 	 */
@@ -174,6 +225,15 @@ public:
 		return stack_;
 	}
 
+	/**
+	 * \return const reference to internal Stack object
+	 */
+
+	const architecture::Stack& getStack() const
+	{
+		return stack_;
+	}
+
 	/**
 	 * \return current state of object
 	 */
@@ -183,6 +243,18 @@ public:
 		return state_;
 	}
 
+	/**
+	 * \brief Sets the EventFlagsWaiter describing the wait of this thread.
+	 *
+	 * \param [in] eventFlagsWaiter is a pointer to EventFlagsWaiter, which must be valid as long as the thread is
+	 * blocked on EventFlags
+	 */
+
+	void setEventFlagsWaiter(EventFlagsWaiter* const eventFlagsWaiter)
+	{
+		eventFlagsWaiter_ = eventFlagsWaiter;
+	}
+
 	/**
 	 * \brief Sets the list that has this object.
 	 *
@@ -235,14 +307,17 @@ public:
 	/**
 	 * \brief Hook function called when context is switched to this thread.
 	 *
-	 * Sets global _impure_ptr (from newlib) to thread's \a reent_ member variable.
+	 * Sets global _impure_ptr (from newlib) to thread's \a reent_ member variable. Does nothing if the C library is not
+	 * newlib.
 	 *
 	 * \attention This function should be called only by Scheduler::switchContext().
 	 */
 
 	void switchedToHook()
 	{
+#ifdef _NEWLIB_VERSION
 		_impure_ptr = &reent_;
+#endif	// def _NEWLIB_VERSION
 	}
 
 	/**
@@ -283,6 +358,7 @@ private:
 	 *
 	 * \attention list_ must not be nullptr
 	 *
+	 * \param [in] previousEffectivePriority is the effective priority of thread before the change
 	 * \param [in] loweringBefore selects the method of ordering when lowering the priority (it must be false when the
 	 * priority is raised!):
 	 * - true - the thread is moved to the head of the group of threads with the new priority, this is accomplished by
@@ -290,7 +366,7 @@ private:
 	 * - false - the thread is moved to the tail of the group of threads with the new priority.
 	 */
 
-	void reposition(bool loweringBefore);
+	void reposition(uint8_t previousEffectivePriority, bool loweringBefore);
 
 	/// internal stack object
 	architecture::Stack stack_;
@@ -304,6 +380,10 @@ private:
 	/// pointer to MutexControlBlock (with PriorityInheritance protocol) that blocks this thread
 	const MutexControlBlock* priorityInheritanceMutexControlBlock_;
 
+	/// pointer to EventFlagsWaiter describing the wait of this thread, valid only when the thread is blocked on
+	/// EventFlags
+	EventFlagsWaiter* eventFlagsWaiter_;
+
 	/// pointer to list that has this object
 	ThreadList* list_;
 
@@ -316,9 +396,20 @@ private:
 	/// pointer to SignalsReceiverControlBlock object for this thread, nullptr if this thread cannot receive signals
 	SignalsReceiverControlBlock* signalsReceiverControlBlock_;
 
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	/// run time of thread, in units of architecture::getRunTimeCounter()
+	uint64_t runTime_;
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+#ifdef _NEWLIB_VERSION
+
 	/// newlib's _reent structure with thread-specific data
 	_reent reent_;
 
+#endif	// def _NEWLIB_VERSION
+
 	/// round-robin quantum
 	RoundRobinQuantum roundRobinQuantum_;
 
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadGroupControlBlock class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -27,6 +27,9 @@ class ThreadGroupControlBlock
 {
 public:
 
+	/// intrusive list of threads (thread control blocks)
+	using List = estd::IntrusiveList<ThreadListNode, &ThreadListNode::threadGroupNode, ThreadControlBlock>;
+
 	/**
 	 * \brief ThreadGroupControlBlock's constructor
 	 */
@@ -45,10 +48,16 @@ public:
 
 	void add(ThreadControlBlock& threadControlBlock);
 
-private:
+	/**
+	 * \return const reference to list of threads (thread control blocks) in this group
+	 */
 
-	/// intrusive list of threads (thread control blocks)
-	using List = estd::IntrusiveList<ThreadListNode, &ThreadListNode::threadGroupNode, ThreadControlBlock>;
+	const List& getThreadList() const
+	{
+		return threadList_;
+	}
+
+private:
 
 	/// list of threads (thread control blocks) in this group
 	List threadList_;
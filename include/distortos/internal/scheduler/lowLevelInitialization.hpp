@@ -2,7 +2,7 @@
  * \file
  * \brief internal::lowLevelInitialization() declaration
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_LOWLEVELINITIALIZATION_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_LOWLEVELINITIALIZATION_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 namespace distortos
 {
 
@@ -28,8 +30,9 @@ namespace internal
  * 1. Initializes main instance of system's Scheduler;
  * 2. Initializes main thread with its group;
  * 3. Starts idle thread;
- * 4. Initializes main instance of Mutex used for malloc() and free() locking;
- * 5. Initializes main instance of DeferredThreadDeleter (only if CONFIG_THREAD_DETACH_ENABLE option is enabled);
+ * 4. Initializes software timer thread (only if CONFIG_SOFTWARE_TIMER_THREAD_ENABLE option is enabled);
+ * 5. Initializes main instance of Mutex used for malloc() and free() locking;
+ * 6. Initializes main instance of DeferredThreadDeleter (only if CONFIG_THREAD_DETACH_ENABLE option is enabled);
  *
  * This function is called before constructors for global and static objects from __libc_init_array() via address in
  * distortosPreinitArray[].
@@ -37,6 +40,22 @@ namespace internal
 
 void lowLevelInitialization();
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/**
+ * \brief Starts software timer thread.
+ *
+ * Software timer thread usually has higher priority than main thread, so it cannot be started before the scheduling is
+ * started.
+ *
+ * This function is called after architecture::startScheduling() via address in distortosPreinitArray[]. If the thread
+ * cannot be started, the program is aborted.
+ */
+
+void startSoftwareTimerThread();
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 }	// namespace internal
 
 }	// namespace distortos
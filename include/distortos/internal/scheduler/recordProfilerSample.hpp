@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \brief recordProfilerSample() declaration
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RECORDPROFILERSAMPLE_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RECORDPROFILERSAMPLE_HPP_
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief Records single sample of statistical profiler.
+ *
+ * Sample consists of \a programCounter and the address of current thread.
+ *
+ * \attention This function must be called only from the interrupt of chip's profiler timer. It may be executed with
+ * priority higher than the priority of kernel, so it doesn't use any locks - the buffer for samples is a
+ * single-producer, single-consumer ring buffer.
+ *
+ * \param [in] programCounter is the program counter of code interrupted by profiler timer
+ */
+
+void recordProfilerSample(uintptr_t programCounter);
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_RECORDPROFILERSAMPLE_HPP_
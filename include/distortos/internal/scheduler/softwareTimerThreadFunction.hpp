@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief softwareTimerThreadFunction() declaration
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERTHREADFUNCTION_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERTHREADFUNCTION_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief Software timer thread's function
+ *
+ * Executes functions of expired software timers handed over by "tick" interrupt.
+ */
+
+void softwareTimerThreadFunction();
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_SOFTWARETIMERTHREADFUNCTION_HPP_
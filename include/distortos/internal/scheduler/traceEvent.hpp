@@ -0,0 +1,73 @@
+/**
+ * \file
+ * \brief traceEvent() definition
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEEVENT_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEEVENT_HPP_
+
+#include "distortos/trace.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+#ifdef CONFIG_TRACE_ENABLE
+
+/**
+ * \brief Records trace event.
+ *
+ * \param [in] type is the type of event
+ * \param [in] object is the identifier of object related to the event
+ * \param [in] argument is the additional argument
+ */
+
+inline void traceEvent(const trace::EventType type, const uint32_t object, const uint8_t argument = {})
+{
+	trace::record(type, object, argument);
+}
+
+#else	// !def CONFIG_TRACE_ENABLE
+
+/**
+ * \brief Records trace event - empty version used when CONFIG_TRACE_ENABLE is not defined, so tracing has no cost at
+ * all.
+ */
+
+inline void traceEvent(trace::EventType, uint32_t, uint8_t = {})
+{
+
+}
+
+#endif	// !def CONFIG_TRACE_ENABLE
+
+/**
+ * \brief Records trace event - overload for objects identified by their address.
+ *
+ * \param [in] type is the type of event
+ * \param [in] object is a pointer to object related to the event
+ * \param [in] argument is the additional argument
+ */
+
+inline void traceEvent(const trace::EventType type, const void* const object, const uint8_t argument = {})
+{
+	traceEvent(type, static_cast<uint32_t>(reinterpret_cast<uintptr_t>(object)), argument);
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SCHEDULER_TRACEEVENT_HPP_
@@ -0,0 +1,93 @@
+/**
+ * \file
+ * \brief BoundQueueRangeFunctor class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_BOUNDQUEUERANGEFUNCTOR_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_BOUNDQUEUERANGEFUNCTOR_HPP_
+
+#include "distortos/internal/synchronization/QueueRangeFunctor.hpp"
+
+#include <utility>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief BoundQueueRangeFunctor is a type-erased QueueRangeFunctor which calls its bound functor to execute actions on
+ * a range of elements in queue's storage
+ *
+ * \tparam F is the type of bound functor, it will be called with <em>void*</em>, <em>size_t</em> and <em>size_t</em>
+ * as arguments
+ */
+
+template<typename F>
+class BoundQueueRangeFunctor : public QueueRangeFunctor
+{
+public:
+
+	/**
+	 * \brief BoundQueueRangeFunctor's constructor
+	 *
+	 * \param [in] boundFunctor is a rvalue reference to bound functor which will be used to move-construct internal
+	 * bound functor
+	 */
+
+	constexpr explicit BoundQueueRangeFunctor(F&& boundFunctor) :
+			boundFunctor_{std::move(boundFunctor)}
+	{
+
+	}
+
+	/**
+	 * \brief Calls the bound functor which will execute some action on a range of elements in queue's storage (like
+	 * copy-constructing, swapping, destroying, ...)
+	 *
+	 * \param [in,out] storage is a pointer to storage with/for first element of the range
+	 * \param [in] index is the index of first element of the range in the whole transferred sequence
+	 * \param [in] count is the number of elements in the range
+	 */
+
+	void operator()(void* const storage, const size_t index, const size_t count) const override
+	{
+		boundFunctor_(storage, index, count);
+	}
+
+private:
+
+	/// bound functor
+	F boundFunctor_;
+};
+
+/**
+ * \brief Helper factory function to make BoundQueueRangeFunctor object with deduced template arguments
+ *
+ * \tparam F is the type of bound functor, it will be called with <em>void*</em>, <em>size_t</em> and <em>size_t</em>
+ * as arguments
+ *
+ * \param [in] boundFunctor is a rvalue reference to bound functor which will be used to move-construct internal bound
+ * functor
+ *
+ * \return BoundQueueRangeFunctor object with deduced template arguments
+ */
+
+template<typename F>
+constexpr BoundQueueRangeFunctor<F> makeBoundQueueRangeFunctor(F&& boundFunctor)
+{
+	return BoundQueueRangeFunctor<F>{std::move(boundFunctor)};
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_BOUNDQUEUERANGEFUNCTOR_HPP_
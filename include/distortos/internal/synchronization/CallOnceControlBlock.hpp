@@ -2,7 +2,7 @@
  * \file
  * \brief CallOnceControlBlock class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,10 +12,12 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_CALLONCECONTROLBLOCK_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_CALLONCECONTROLBLOCK_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include "estd/invoke.hpp"
 #include "estd/TypeErasedFunctor.hpp"
 
-#include <sys/features.h>
+#include <cstdint>	// __GNUC_PREREQ() is defined by C library headers
 
 namespace distortos
 {
@@ -142,6 +144,32 @@ private:
 
 	void callOnceImplementation(const Functor& functor);
 
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	/**
+	 * \brief Tries to claim execution of the function using exclusive access, with no interrupt masking.
+	 *
+	 * \param [in] blockedList is a reference to list on which threads calling callOnce() during execution of the
+	 * function will be blocked
+	 *
+	 * \return true if execution was claimed by current thread, false if the function was already executed or is being
+	 * executed by another thread
+	 */
+
+	bool tryClaimExclusive(ThreadList& blockedList);
+
+	/**
+	 * \brief Tries to release the list of blocked threads after execution of the function using exclusive access, with
+	 * no interrupt masking.
+	 *
+	 * \return true if the list was released, false if some threads are blocked on it and must be unblocked with
+	 * interrupt masking
+	 */
+
+	bool tryReleaseExclusive();
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	/// pointer to stack-allocated list of ThreadControlBlock objects blocked on associated OnceFlag
 	ThreadList* blockedList_;
 
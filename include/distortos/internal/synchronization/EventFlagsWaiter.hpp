@@ -0,0 +1,78 @@
+/**
+ * \file
+ * \brief EventFlagsWaiter struct header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_EVENTFLAGSWAITER_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_EVENTFLAGSWAITER_HPP_
+
+#include "distortos/EventFlags.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief EventFlagsWaiter struct describes a thread which waits for EventFlags.
+ *
+ * Object is placed on the stack of waiting thread, pointer to it is saved in ThreadControlBlock of this thread, so
+ * EventFlags::set() can reach it in constant time from the list of blocked threads.
+ */
+
+struct EventFlagsWaiter
+{
+	/**
+	 * \brief EventFlagsWaiter's constructor
+	 *
+	 * \param [in] bitmaskk is the bitmask of flags that are waited for
+	 * \param [in] alll selects whether all (true) or any (false) of selected flags must be set to satisfy the wait
+	 * \param [in] autoClearr selects whether the flags selected by \a bitmaskk will be cleared when the wait is
+	 * satisfied (true) or not (false)
+	 */
+
+	constexpr EventFlagsWaiter(const EventFlags::Value bitmaskk, const bool alll, const bool autoClearr) :
+			bitmask{bitmaskk},
+			value{},
+			all{alll},
+			autoClear{autoClearr}
+	{
+
+	}
+
+	/**
+	 * \param [in] valuee is the value of flags
+	 *
+	 * \return true if the wait is satisfied by \a valuee, false otherwise
+	 */
+
+	constexpr bool isSatisfied(const EventFlags::Value valuee) const
+	{
+		return all == true ? (valuee & bitmask) == bitmask : (valuee & bitmask) != 0;
+	}
+
+	/// bitmask of flags that are waited for
+	const EventFlags::Value bitmask;
+
+	/// value of flags at the moment the wait was satisfied, before automatic clearing
+	EventFlags::Value value;
+
+	/// selects whether all (true) or any (false) of selected flags must be set to satisfy the wait
+	const bool all;
+
+	/// selects whether the flags selected by bitmask will be cleared when the wait is satisfied
+	const bool autoClear;
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_EVENTFLAGSWAITER_HPP_
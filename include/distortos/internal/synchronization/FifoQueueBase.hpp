@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueueBase class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -15,6 +15,7 @@
 #include "distortos/Semaphore.hpp"
 
 #include "distortos/internal/synchronization/QueueFunctor.hpp"
+#include "distortos/internal/synchronization/QueueRangeFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreFunctor.hpp"
 
 #include <memory>
@@ -50,6 +51,21 @@ public:
 
 	~FifoQueueBase();
 
+	/**
+	 * \brief Commits element reserved with reservePush(), making it available for popping.
+	 *
+	 * \param [in] storage is a pointer to storage for element, obtained from reservePush()
+	 *
+	 * \return zero if element was committed successfully, error code otherwise:
+	 * - EINVAL - \a storage is not the one obtained from last reservePush() or it was already committed;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commitPush(const void* const storage)
+	{
+		return commitRelease(storage, pushReservation_, deferredPopSemaphorePosts_, popSemaphore_);
+	}
+
 	/**
 	 * \return size of single queue element, bytes
 	 */
@@ -59,6 +75,24 @@ public:
 		return elementSize_;
 	}
 
+	/**
+	 * \brief Implementation of peekPop() using type-erased functor
+	 *
+	 * Reserves the oldest (first) element of the queue, so that it can be read in place. The element is removed from
+	 * the queue, but its slot is not reused until the element is released with releasePop(). Only one element may be
+	 * reserved with peekPop() at a time. Elements popped with pop() while the reservation is active don't free their
+	 * slots until the reservation is released.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop();
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int peekPop(const SemaphoreFunctor& waitSemaphoreFunctor, const void*& storage);
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
@@ -73,7 +107,34 @@ public:
 
 	int pop(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor)
 	{
-		return popPush(waitSemaphoreFunctor, functor, popSemaphore_, pushSemaphore_, readPosition_);
+		return popPush(waitSemaphoreFunctor, functor, popSemaphore_, pushSemaphore_, readPosition_, popReservation_,
+				deferredPushSemaphorePosts_);
+	}
+
+	/**
+	 * \brief Implementation of popN() using type-erased functor
+	 *
+	 * Pops up to \a maxCount oldest elements from the queue in one critical section. Only the wait for the first
+	 * element may block, all other elements are popped only if they are immediately available. Semaphore guarding
+	 * "push" functions is posted once for all popped elements.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [in] functor is a reference to QueueRangeFunctor which will execute actions related to popping - it will
+	 * be called once for each contiguous range of popped elements (at most twice)
+	 * \param [in] maxCount is the max number of elements that will be popped
+	 * \param [out] count is a reference to variable that will be used to return number of popped elements
+	 *
+	 * \return zero if at least one element was popped successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int popN(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueRangeFunctor& functor, const size_t maxCount,
+			size_t& count)
+	{
+		return popPushN(waitSemaphoreFunctor, functor, maxCount, count, popSemaphore_, pushSemaphore_, readPosition_,
+				popReservation_, deferredPushSemaphorePosts_);
 	}
 
 	/**
@@ -90,11 +151,102 @@ public:
 
 	int push(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor)
 	{
-		return popPush(waitSemaphoreFunctor, functor, pushSemaphore_, popSemaphore_, writePosition_);
+		return popPush(waitSemaphoreFunctor, functor, pushSemaphore_, popSemaphore_, writePosition_, pushReservation_,
+				deferredPopSemaphorePosts_);
+	}
+
+	/**
+	 * \brief Implementation of pushN() using type-erased functor
+	 *
+	 * Pushes up to \a maxCount elements to the queue in one critical section. Only the wait for the first free slot
+	 * may block, all other elements are pushed only if there are free slots immediately available. Semaphore guarding
+	 * "pop" functions is posted once for all pushed elements.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [in] functor is a reference to QueueRangeFunctor which will execute actions related to pushing - it will
+	 * be called once for each contiguous range of free slots (at most twice)
+	 * \param [in] maxCount is the max number of elements that will be pushed
+	 * \param [out] count is a reference to variable that will be used to return number of pushed elements
+	 *
+	 * \return zero if at least one element was pushed successfully, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int pushN(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueRangeFunctor& functor, const size_t maxCount,
+			size_t& count)
+	{
+		return popPushN(waitSemaphoreFunctor, functor, maxCount, count, pushSemaphore_, popSemaphore_, writePosition_,
+				pushReservation_, deferredPopSemaphorePosts_);
+	}
+
+	/**
+	 * \brief Releases element reserved with peekPop(), making its slot available for pushing.
+	 *
+	 * \param [in] storage is a pointer to storage with element, obtained from peekPop()
+	 *
+	 * \return zero if element was released successfully, error code otherwise:
+	 * - EINVAL - \a storage is not the one obtained from last peekPop() or it was already released;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int releasePop(const void* const storage)
+	{
+		return commitRelease(storage, popReservation_, deferredPushSemaphorePosts_, pushSemaphore_);
+	}
+
+	/**
+	 * \brief Implementation of reservePush() using type-erased functor
+	 *
+	 * Reserves free slot in the queue, so that the element can be written in place. The element is not available for
+	 * popping until it is committed with commitPush(). Only one slot may be reserved with reservePush() at a time.
+	 * Elements pushed with push() while the reservation is active are not available for popping until the reservation
+	 * is committed.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush();
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int reservePush(const SemaphoreFunctor& waitSemaphoreFunctor, void*& storage)
+	{
+		return reserve(waitSemaphoreFunctor, pushSemaphore_, writePosition_, pushReservation_, storage);
 	}
 
 private:
 
+	/**
+	 * \brief Advances position in the storage by given number of elements, wrapping around at the end of storage.
+	 *
+	 * \param [in,out] position is a reference to position that will be advanced, \a readPosition_ or \a writePosition_
+	 * \param [in] count is the number of elements by which \a position will be advanced, must not be greater than the
+	 * number of elements in storage, default - 1
+	 */
+
+	void advance(void*& position, size_t count = 1) const;
+
+	/**
+	 * \brief Implementation of commitPush() and releasePop()
+	 *
+	 * \param [in] storage is a pointer to storage obtained from reservePush() or peekPop()
+	 * \param [in,out] reservation is a reference to pointer to reserved storage, \a pushReservation_ for commitPush(),
+	 * \a popReservation_ for releasePop()
+	 * \param [in,out] deferredPosts is a reference to number of deferred posts of \a postSemaphore, \a
+	 * deferredPopSemaphorePosts_ for commitPush(), \a deferredPushSemaphorePosts_ for releasePop()
+	 * \param [in] postSemaphore is a reference to semaphore that will be posted, \a popSemaphore_ for commitPush(), \a
+	 * pushSemaphore_ for releasePop()
+	 *
+	 * \return zero if operation was successful, error code otherwise:
+	 * - EINVAL - \a storage doesn't match \a reservation;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commitRelease(const void* storage, void*& reservation, size_t& deferredPosts, Semaphore& postSemaphore);
+
 	/**
 	 * \brief Implementation of pop() and push() using type-erased functor
 	 *
@@ -107,6 +259,10 @@ private:
 	 * for pop(), \a popSemaphore_ for push()
 	 * \param [in] storage is a reference to appropriate pointer to storage, which will be passed to \a functor, \a
 	 * readPosition_ for pop(), \a writePosition_ for push()
+	 * \param [in] reservation is a pointer to storage reserved by peekPop() or reservePush(), \a popReservation_ for
+	 * pop(), \a pushReservation_ for push() - if it is not nullptr, post of \a postSemaphore is deferred
+	 * \param [in,out] deferredPosts is a reference to number of deferred posts of \a postSemaphore, \a
+	 * deferredPushSemaphorePosts_ for pop(), \a deferredPopSemaphorePosts_ for push()
 	 *
 	 * \return zero if operation was successful, error code otherwise:
 	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
@@ -114,7 +270,56 @@ private:
 	 */
 
 	int popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor, Semaphore& waitSemaphore,
-			Semaphore& postSemaphore, void*& storage);
+			Semaphore& postSemaphore, void*& storage, const void* reservation, size_t& deferredPosts);
+
+	/**
+	 * \brief Implementation of popN() and pushN() using type-erased functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a waitSemaphore
+	 * \param [in] functor is a reference to QueueRangeFunctor which will execute actions related to popping/pushing -
+	 * it will be called once for each contiguous range of elements/slots
+	 * \param [in] maxCount is the max number of elements that will be popped/pushed
+	 * \param [out] count is a reference to variable that will be used to return number of popped/pushed elements
+	 * \param [in] waitSemaphore is a reference to semaphore that will be waited for, \a popSemaphore_ for popN(), \a
+	 * pushSemaphore_ for pushN()
+	 * \param [in] postSemaphore is a reference to semaphore that will be posted after the operation, \a pushSemaphore_
+	 * for popN(), \a popSemaphore_ for pushN()
+	 * \param [in] storage is a reference to appropriate pointer to storage, \a readPosition_ for popN(), \a
+	 * writePosition_ for pushN()
+	 * \param [in] reservation is a pointer to storage reserved by peekPop() or reservePush(), \a popReservation_ for
+	 * popN(), \a pushReservation_ for pushN() - if it is not nullptr, posts of \a postSemaphore are deferred
+	 * \param [in,out] deferredPosts is a reference to number of deferred posts of \a postSemaphore, \a
+	 * deferredPushSemaphorePosts_ for popN(), \a deferredPopSemaphorePosts_ for pushN()
+	 *
+	 * \return zero if operation was successful, error code otherwise:
+	 * - EINVAL - \a maxCount is zero;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int popPushN(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueRangeFunctor& functor, size_t maxCount,
+			size_t& count, Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage, const void* reservation,
+			size_t& deferredPosts);
+
+	/**
+	 * \brief Implementation of peekPop() and reservePush() using type-erased functor
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a waitSemaphore
+	 * \param [in] waitSemaphore is a reference to semaphore that will be waited for, \a popSemaphore_ for peekPop(),
+	 * \a pushSemaphore_ for reservePush()
+	 * \param [in,out] position is a reference to appropriate pointer to storage, \a readPosition_ for peekPop(), \a
+	 * writePosition_ for reservePush()
+	 * \param [in,out] reservation is a reference to pointer to reserved storage, \a popReservation_ for peekPop(), \a
+	 * pushReservation_ for reservePush()
+	 * \param [out] storage is a reference to variable that will be used to return pointer to reserved storage
+	 *
+	 * \return zero if operation was successful, error code otherwise:
+	 * - EBUSY - \a reservation is already active;
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int reserve(const SemaphoreFunctor& waitSemaphoreFunctor, Semaphore& waitSemaphore, void*& position,
+			void*& reservation, void*& storage);
 
 	/// semaphore guarding access to "pop" functions - its value is equal to the number of available elements
 	Semaphore popSemaphore_;
@@ -134,6 +339,18 @@ private:
 	/// pointer to first free slot available for writing
 	void* writePosition_;
 
+	/// pointer to element reserved with peekPop(), nullptr if no element is reserved
+	void* popReservation_;
+
+	/// pointer to slot reserved with reservePush(), nullptr if no slot is reserved
+	void* pushReservation_;
+
+	/// number of posts of \a popSemaphore_ deferred until slot reserved with reservePush() is committed
+	size_t deferredPopSemaphorePosts_;
+
+	/// number of posts of \a pushSemaphore_ deferred until element reserved with peekPop() is released
+	size_t deferredPushSemaphorePosts_;
+
 	/// size of single queue element, bytes
 	const size_t elementSize_;
 };
@@ -2,7 +2,7 @@
  * \file
  * \brief MessageQueueBase class header
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -19,8 +19,17 @@
 
 #include "estd/SortedIntrusiveForwardList.hpp"
 
+#include "distortos/distortosConfiguration.h"
+
 #include <memory>
 
+#ifdef CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+
+#include <array>
+#include <utility>
+
+#endif	// def CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+
 namespace distortos
 {
 
@@ -46,6 +55,10 @@ public:
 				node{},
 				priority{priorityy},
 				storage{storagee}
+#ifdef CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+				, nextLastEntry{},
+				lastEntriesBucket{}
+#endif	// def CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
 		{
 
 		}
@@ -58,6 +71,18 @@ public:
 
 		/// storage for the entry
 		void* storage;
+
+#ifdef CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+
+		/// next entry in the same bucket of last entries of their priorities, valid only if this entry is the last one
+		/// with its priority in EntryList
+		Entry* nextLastEntry;
+
+		/// first entry in the bucket of last entries of their priorities with index equal to the index of this entry in
+		/// the storage, used only by EntryList
+		Entry* lastEntriesBucket;
+
+#endif	// def CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
 	};
 
 	/// type of uninitialized storage for Entry
@@ -105,11 +130,169 @@ public:
 		}
 	};
 
-	/// type of entry list
-	using EntryList = estd::SortedIntrusiveForwardList<DescendingPriority, Entry, &Entry::node>;
+	/// type of sorted list of entries
+	using SortedEntryList = estd::SortedIntrusiveForwardList<DescendingPriority, Entry, &Entry::node>;
 
 	/// type of free entry list
-	using FreeEntryList = EntryList::UnsortedIntrusiveForwardList;
+	using FreeEntryList = SortedEntryList::UnsortedIntrusiveForwardList;
+
+	/**
+	 * \brief EntryList class is a list of entries available for popping.
+	 *
+	 * The order of entries is descending priority, FIFO within the group of entries with the same priority.
+	 *
+	 * When CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE is selected, the list additionally maintains a 256-bit bitmap of
+	 * priorities which have at least one entry on the list and a pointer to the last entry of each such priority, so
+	 * splice_after() doesn't search linearly for the insert position. These pointers are kept in the entries - last
+	 * entries are hashed by their priority to min(number of entries, 256) buckets, so each bucket holds at most 16 of
+	 * them. Otherwise all operations are just forwarded to SortedEntryList.
+	 */
+
+	class EntryList
+	{
+	public:
+
+#ifdef CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+
+		/**
+		 * \brief EntryList's constructor
+		 *
+		 * \param [in] entries is a pointer to first element of array with all entries of the queue, their
+		 * Entry::lastEntriesBucket members are used as buckets
+		 * \param [in] maxEntries is the number of elements in \a entries array
+		 */
+
+		constexpr EntryList(Entry* const entries, const size_t maxEntries) :
+				list_{},
+				bitmap_{},
+				entries_{entries},
+				buckets_{maxEntries < priorities ? maxEntries : priorities}
+		{
+
+		}
+
+#else	// !def CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+
+		/**
+		 * \brief EntryList's constructor
+		 */
+
+		constexpr EntryList() :
+				list_{}
+		{
+
+		}
+
+#endif	// !def CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+
+		/**
+		 * \return reference to first entry on the list - the oldest one with the highest priority
+		 */
+
+		Entry& front()
+		{
+			return list_.front();
+		}
+
+		/**
+		 * \brief Transfers the entry from another list to this one, keeping it sorted.
+		 *
+		 * The entry is placed at the end of the group of entries with the same priority.
+		 *
+		 * \param [in] beforeSplicedEntry is an iterator of the entry preceding the one which will be spliced from
+		 * another list to this one
+		 */
+
+		void splice_after(FreeEntryList::iterator beforeSplicedEntry);
+
+		/**
+		 * \brief Transfers first entry of this list to another list.
+		 *
+		 * \param [in] position is an iterator of the entry in another list after which the entry will be linked
+		 */
+
+		void spliceFrontAfter(FreeEntryList::iterator position);
+
+		EntryList(const EntryList&) = delete;
+		EntryList(EntryList&&) = delete;
+		const EntryList& operator=(const EntryList&) = delete;
+		EntryList& operator=(EntryList&&) = delete;
+
+	private:
+
+#ifdef CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+
+		/// type of single word of bitmap
+		using BitmapWord = uint32_t;
+
+		/// number of bits in single word of bitmap
+		constexpr static size_t bitsPerBitmapWord {sizeof(BitmapWord) * 8};
+
+		/// number of different priorities
+		constexpr static size_t priorities {UINT8_MAX + 1};
+
+		/**
+		 * \brief Finds lowest priority which has at least one entry on the list and is not lower than \a priority.
+		 *
+		 * \param [in] priority is the priority from which the search is started
+		 *
+		 * \return pair with true and found priority if any was found, pair with false and undefined value otherwise
+		 */
+
+		std::pair<bool, uint8_t> findPriority(size_t priority) const;
+
+		/**
+		 * \brief Finds link to the last entry with given priority in its bucket.
+		 *
+		 * \param [in] priority is the priority of searched entry, it must have at least one entry on the list
+		 *
+		 * \return reference to pointer which points to the last entry with \a priority
+		 */
+
+		Entry*& findLastEntryLink(uint8_t priority) const;
+
+		/**
+		 * \param [in] priority is the priority for which the bucket will be returned
+		 *
+		 * \return reference to bucket of last entries which holds the last entry with \a priority
+		 */
+
+		Entry*& getBucket(const uint8_t priority) const
+		{
+			return entries_[priority % buckets_].lastEntriesBucket;
+		}
+
+		/**
+		 * \param [in] priority is the priority for which the mask will be returned
+		 *
+		 * \return mask of the bit of given priority in its bitmap word - the highest bit of the word is used for the
+		 * lowest priority, so that CLZ instruction can be used to find the next used priority
+		 */
+
+		constexpr static BitmapWord getBitMask(const uint8_t priority)
+		{
+			return (BitmapWord{1} << (bitsPerBitmapWord - 1)) >> (priority % bitsPerBitmapWord);
+		}
+
+		/// list of entries, order is maintained with the help of bitmap_ and buckets of last entries
+		FreeEntryList list_;
+
+		/// bitmap of priorities which have at least one entry on the list
+		std::array<BitmapWord, priorities / bitsPerBitmapWord> bitmap_;
+
+		/// pointer to first element of array with all entries of the queue
+		Entry* entries_;
+
+		/// number of buckets of last entries
+		size_t buckets_;
+
+#else	// !def CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+
+		/// list of entries
+		SortedEntryList list_;
+
+#endif	// !def CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+	};
 
 	/**
 	 * \brief InternalFunctor is a type-erased interface for functors which execute common code of pop() and push()
@@ -144,6 +327,37 @@ public:
 
 	~MessageQueueBase();
 
+	/**
+	 * \brief Commits element written in place to the slot reserved with reservePush(), making it available for popping.
+	 *
+	 * \param [in] priority is the priority of new element
+	 * \param [in] storage is a pointer to storage for element, obtained from reservePush()
+	 *
+	 * \return zero if element was committed successfully, error code otherwise:
+	 * - EINVAL - \a storage is not the one obtained from last reservePush() or it was already committed;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int commitPush(uint8_t priority, const void* storage);
+
+	/**
+	 * \brief Implementation of peekPop() using type-erased functor
+	 *
+	 * Reserves the oldest element with highest priority, so that it can be read in place. The element is removed from
+	 * the queue, but its slot is not reused until the element is released with releasePop(). Only one element may be
+	 * reserved with peekPop() at a time.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a popSemaphore_
+	 * \param [out] priority is a reference to variable that will be used to return priority of reserved element
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage with element
+	 *
+	 * \return zero if element was reserved successfully, error code otherwise:
+	 * - EBUSY - another element is already reserved with peekPop();
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int peekPop(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t& priority, const void*& storage);
+
 	/**
 	 * \brief Implementation of pop() using type-erased functor
 	 *
@@ -174,6 +388,34 @@ public:
 
 	int push(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t priority, const QueueFunctor& functor);
 
+	/**
+	 * \brief Releases element reserved with peekPop(), making its slot available for pushing.
+	 *
+	 * \param [in] storage is a pointer to storage with element, obtained from peekPop()
+	 *
+	 * \return zero if element was released successfully, error code otherwise:
+	 * - EINVAL - \a storage is not the one obtained from last peekPop() or it was already released;
+	 * - error codes returned by Semaphore::post();
+	 */
+
+	int releasePop(const void* storage);
+
+	/**
+	 * \brief Implementation of reservePush() using type-erased functor
+	 *
+	 * Reserves free slot in the queue, so that the element can be written in place. The element is not available for
+	 * popping until it is committed with commitPush(). Only one slot may be reserved with reservePush() at a time.
+	 *
+	 * \param [in] waitSemaphoreFunctor is a reference to SemaphoreFunctor which will be executed with \a pushSemaphore_
+	 * \param [out] storage is a reference to variable that will be used to return pointer to storage for element
+	 *
+	 * \return zero if slot was reserved successfully, error code otherwise:
+	 * - EBUSY - another slot is already reserved with reservePush();
+	 * - error codes returned by \a waitSemaphoreFunctor's operator() call;
+	 */
+
+	int reservePush(const SemaphoreFunctor& waitSemaphoreFunctor, void*& storage);
+
 private:
 
 	/**
@@ -212,6 +454,12 @@ private:
 
 	/// list of "free" entries
 	FreeEntryList freeEntryList_;
+
+	/// list with entry reserved with peekPop(), empty if there is no reservation
+	FreeEntryList popReservedEntryList_;
+
+	/// list with entry reserved with reservePush(), empty if there is no reservation
+	FreeEntryList pushReservedEntryList_;
 };
 
 }	// namespace internal
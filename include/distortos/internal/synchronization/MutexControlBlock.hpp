@@ -2,7 +2,7 @@
  * \file
  * \brief MutexControlBlock class header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,6 +12,8 @@
 #ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MUTEXCONTROLBLOCK_HPP_
 #define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_MUTEXCONTROLBLOCK_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
 #include "distortos/internal/scheduler/ThreadList.hpp"
 
 #include "distortos/internal/synchronization/MutexListNode.hpp"
@@ -66,6 +68,33 @@ public:
 
 	int block();
 
+	/**
+	 * \brief Blocks current thread on condition variable associated with this mutex.
+	 *
+	 * While the thread is blocked, it may be moved to blockedList_ with requeue().
+	 *
+	 * \param [in] conditionVariableBlockedList is a reference to list of threads blocked on condition variable
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - values returned by Scheduler::block();
+	 */
+
+	int blockOnConditionVariable(ThreadList& conditionVariableBlockedList) const;
+
+	/**
+	 * \brief Blocks current thread with timeout on condition variable associated with this mutex.
+	 *
+	 * While the thread is blocked, it may be moved to blockedList_ with requeue().
+	 *
+	 * \param [in] conditionVariableBlockedList is a reference to list of threads blocked on condition variable
+	 * \param [in] timePoint is the time point at which the thread will be unblocked (if not already unblocked)
+	 *
+	 * \return 0 on success, error code otherwise:
+	 * - values returned by Scheduler::blockUntil();
+	 */
+
+	int blockOnConditionVariableUntil(ThreadList& conditionVariableBlockedList, TickClock::time_point timePoint) const;
+
 	/**
 	 * \brief Blocks current thread with timeout, transferring it to blockedList_.
 	 *
@@ -126,6 +155,38 @@ public:
 
 	void lock();
 
+	/**
+	 * \brief Moves thread blocked on condition variable to blockedList_ ("wait morphing").
+	 *
+	 * The thread is moved only if the mutex is locked by another thread and if the thread would be allowed to lock the
+	 * mutex (its priority is not higher than priority ceiling). Such thread would be unblocked by notification only to
+	 * block on the mutex immediately after that, requeuing saves two context switches. The lock is later transferred
+	 * to the thread directly with unlockOrTransferLock().
+	 *
+	 * \param [in] iterator is the iterator which points to thread blocked on condition variable with
+	 * blockOnConditionVariable() or blockOnConditionVariableUntil() of this object
+	 *
+	 * \return true if the thread was moved to blockedList_, false otherwise
+	 */
+
+	bool requeue(ThreadList::iterator iterator);
+
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	/**
+	 * \brief Tries to lock the mutex using exclusive access, with no interrupt masking.
+	 *
+	 * This fast path is used only for mutexes with Protocol::none, as locking of mutexes with other protocols modifies
+	 * the list of mutexes owned by the thread.
+	 *
+	 * \return true if the mutex was unlocked and is now locked by current thread, false if locking must be done with
+	 * interrupt masking
+	 */
+
+	bool tryLockExclusive();
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	/**
 	 * \brief Performs unlocking or transfer of lock from current owner to next thread on the list.
 	 *
@@ -0,0 +1,43 @@
+/**
+ * \file
+ * \brief QueueRangeFunctor class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_QUEUERANGEFUNCTOR_HPP_
+#define INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_QUEUERANGEFUNCTOR_HPP_
+
+#include "estd/TypeErasedFunctor.hpp"
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+/**
+ * \brief QueueRangeFunctor is a type-erased interface for functors which execute some action on a range of contiguous
+ * elements in queue's storage (like copy-constructing, swapping, destroying, ...).
+ *
+ * The functor will be called by queue internals with three arguments - \a storage - which is a pointer to storage
+ * with/for first element of the range, \a index - which is the index of this element in the whole transferred sequence
+ * and \a count - which is the number of elements in the range
+ */
+
+class QueueRangeFunctor : public estd::TypeErasedFunctor<void(void*, size_t, size_t)>
+{
+
+};
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_INTERNAL_SYNCHRONIZATION_QUEUERANGEFUNCTOR_HPP_
@@ -0,0 +1,138 @@
+/**
+ * \file
+ * \brief profiler namespace header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_PROFILER_HPP_
+#define INCLUDE_DISTORTOS_PROFILER_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace profiler
+{
+
+/// \addtogroup profiler
+/// \{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single sample of statistical profiler
+struct Sample
+{
+	/// program counter of interrupted code
+	uintptr_t programCounter;
+
+	/// address of Thread which was running when the sample was taken
+	uintptr_t thread;
+};
+
+/// header of binary profile dump, which should be written before all samples
+struct Header
+{
+	/// magic value - "DPRF" in little-endian byte order
+	uint32_t magic;
+
+	/// version of binary format of profile
+	uint16_t version;
+
+	/// size of single sample, bytes
+	uint16_t sampleSize;
+
+	/// sampling frequency, Hz
+	uint32_t frequency;
+
+	/// reserved, always 0
+	uint32_t reserved;
+
+	/// run-time address of getHeader(), used by host tools to find the load address of relocatable images
+	uint64_t referenceAddress;
+};
+
+static_assert(sizeof(Header) == 24, "Invalid size of profiler::Header!");
+
+#ifdef CONFIG_PROFILER_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \return number of samples which were dropped because the buffer was full
+ */
+
+uint32_t getDroppedSampleCount();
+
+/**
+ * \return header of binary profile dump
+ */
+
+Header getHeader();
+
+/**
+ * \brief Reads and removes samples from the buffer.
+ *
+ * Only whole samples are read. Binary profile dump consists of Header followed by all data read with this function,
+ * for example:
+ *
+ *     const auto header = distortos::profiler::getHeader();
+ *     serialPort.write(&header, sizeof(header));
+ *     uint8_t buffer[256];
+ *     size_t size;
+ *     while ((size = distortos::profiler::read(buffer, sizeof(buffer))) != 0)
+ *         serialPort.write(buffer, size);
+ *
+ * Such dump can be converted to flat and per-thread profiles with scripts/convertProfileToText.py.
+ *
+ * This function may be used while the profiler is running, but it must not be used by more than one thread at a time.
+ *
+ * \param [out] buffer is a pointer to buffer for samples
+ * \param [in] size is the size of \a buffer, bytes
+ *
+ * \return number of bytes written to \a buffer, multiple of sizeof(Sample), 0 if the buffer is empty
+ */
+
+size_t read(void* buffer, size_t size);
+
+/**
+ * \brief Starts the profiler.
+ *
+ * Chip's profiler timer is configured to generate interrupts with CONFIG_PROFILER_FREQUENCY frequency. Each interrupt
+ * records single sample. When the buffer is full, new samples are dropped and counted - see getDroppedSampleCount().
+ *
+ * \return 0 on success, error code otherwise:
+ * - EINVAL - CONFIG_PROFILER_FREQUENCY cannot be achieved with chip's profiler timer;
+ */
+
+int start();
+
+/**
+ * \brief Stops the profiler.
+ *
+ * Samples which were already recorded remain in the buffer.
+ */
+
+void stop();
+
+#endif	// def CONFIG_PROFILER_ENABLE
+
+/// \}
+
+}	// namespace profiler
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_PROFILER_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief statistics namespace header
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -12,11 +12,20 @@
 #ifndef INCLUDE_DISTORTOS_STATISTICS_HPP_
 #define INCLUDE_DISTORTOS_STATISTICS_HPP_
 
+#include "distortos/distortosConfiguration.h"
+
+#include "distortos/TlsfHeap.hpp"
+
+#include "estd/ContiguousRange.hpp"
+
+#include <cstddef>
 #include <cstdint>
 
 namespace distortos
 {
 
+class Thread;
+
 namespace statistics
 {
 
@@ -29,6 +38,136 @@ namespace statistics
 
 uint64_t getContextSwitchCount();
 
+/**
+ * \brief Gets number of "tick" interrupts which interrupted idle thread.
+ *
+ * Ticks for which "tick" interrupt was suppressed during sleep of idle thread are also included. Load of the CPU in any
+ * period can be estimated as 1 - (idle tick count / tick count), with both values being the difference of readings
+ * taken at the beginning and at the end of the period.
+ *
+ * \return number of "tick" interrupts which interrupted idle thread
+ */
+
+uint64_t getIdleTickCount();
+
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+/**
+ * \brief Marks the beginning of interrupt handler for run time statistics.
+ *
+ * Time until matching call to exitInterrupt() will be charged to interrupts instead of the interrupted thread. "Tick"
+ * interrupt is always included in run time statistics, other interrupt handlers may use this function and
+ * exitInterrupt() to be included too. Calls may be nested.
+ */
+
+void enterInterrupt();
+
+/**
+ * \brief Marks the end of interrupt handler for run time statistics.
+ *
+ * \attention Each call must be matched with preceding call to enterInterrupt().
+ */
+
+void exitInterrupt();
+
+/**
+ * \brief Gets time for which idle thread was running.
+ *
+ * Load of the CPU in any period is 1 - (idle run time / total run time), with both values being the difference of
+ * readings taken at the beginning and at the end of the period.
+ *
+ * \return time for which idle thread was running, in units of getRunTimeFrequency()
+ */
+
+uint64_t getIdleRunTime();
+
+/**
+ * \return time spent in interrupts included in run time statistics, in units of getRunTimeFrequency()
+ */
+
+uint64_t getInterruptRunTime();
+
+/**
+ * \return frequency of units in which run time is measured, Hz
+ */
+
+uint32_t getRunTimeFrequency();
+
+/**
+ * \return total time since the start of scheduling, in units of getRunTimeFrequency()
+ */
+
+uint64_t getTotalRunTime();
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/**
+ * \return maximal number of expired software timers which were waiting for execution by software timer thread at the
+ * same time
+ */
+
+size_t getMaxSoftwareTimerBacklog();
+
+/**
+ * \return current number of expired software timers waiting for execution by software timer thread
+ */
+
+size_t getSoftwareTimerBacklog();
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+
+/// StackUsage struct describes usage of stack of single thread
+struct StackUsage
+{
+	/// pointer to thread - for DynamicThread this is its internal thread object
+	const Thread* thread;
+
+	/// size of stack, bytes
+	size_t stackSize;
+
+	/// max number of bytes of stack which were used by thread (high-water mark)
+	size_t stackHighWaterMark;
+};
+
+/**
+ * \brief Gets usage of stacks of all threads in the group of current thread.
+ *
+ * All threads which were started are reported - including main() thread, idle thread and threads which already
+ * terminated, but were not yet destroyed. Threads which were created but not yet started don't belong to any group, so
+ * they are not reported.
+ *
+ * \note Interrupts are masked during traversal of the list of threads and scanning of their stacks.
+ *
+ * \param [out] stackUsages is a range into which usage of stacks of threads will be written
+ *
+ * \return total number of threads in the group - if it is greater than the size of \a stackUsages, only the first
+ * threads were written
+ */
+
+size_t getStackUsage(estd::ContiguousRange<StackUsage> stackUsages);
+
+#endif	// def CONFIG_STACK_PAINTING_ENABLE
+
+#ifdef CONFIG_TLSF_HEAP_ENABLE
+
+/**
+ * \brief Gets statistics of the heap used by malloc().
+ *
+ * Fragmentation of the heap may be estimated as 1 - (size of the largest free block / total size of free blocks).
+ *
+ * \note Interrupts are masked during traversal of the list of the largest free blocks.
+ *
+ * \return statistics of the heap used by malloc()
+ */
+
+TlsfHeap::Statistics getHeapStatistics();
+
+#endif	// def CONFIG_TLSF_HEAP_ENABLE
+
 /// \}
 
 }	// namespace statistics
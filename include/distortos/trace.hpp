@@ -0,0 +1,199 @@
+/**
+ * \file
+ * \brief trace namespace header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef INCLUDE_DISTORTOS_TRACE_HPP_
+#define INCLUDE_DISTORTOS_TRACE_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace trace
+{
+
+/// \addtogroup trace
+/// \{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of trace event, values are a part of binary format of trace and must not be changed
+enum class EventType : uint8_t
+{
+	/// context switch, object is the Thread which was switched to
+	contextSwitch,
+	/// thread was blocked, object is the Thread, argument is ThreadState describing the reason of blocking
+	threadBlock,
+	/// thread was unblocked, object is the Thread, argument is the reason of unblocking - 0 - unblock request,
+	/// 1 - timeout, 2 - signal
+	threadUnblock,
+	/// Semaphore was successfully posted with Semaphore::post(), object is the Semaphore
+	semaphorePost,
+	/// Semaphore was successfully decremented by one of its wait functions, object is the Semaphore
+	semaphoreWait,
+	/// Mutex was successfully locked by one of its lock functions, object is the Mutex
+	mutexLock,
+	/// Mutex was successfully unlocked with Mutex::unlock(), object is the Mutex
+	mutexUnlock,
+	/// element was pushed to queue, object is internal part of queue, argument is the number of elements
+	queuePush,
+	/// element was popped from queue, object is internal part of queue, argument is the number of elements
+	queuePop,
+	/// software timer expired and its function is executed (or deferred), object is the SoftwareTimer
+	softwareTimerExpiry,
+	/// entry to interrupt handler, object is the identifier of interrupt
+	interruptEnter,
+	/// exit from interrupt handler, object is the identifier of interrupt
+	interruptExit,
+	/// application-defined event, recorded with record()
+	user,
+};
+
+/// binary trace event
+struct Event
+{
+	/// low 32 bits of architecture's run time counter at the moment of recording
+	uint32_t timestamp;
+
+	/// low 32 bits of the address of object related to the event or an identifier, depending on \a type
+	uint32_t object;
+
+	/// type of event
+	EventType type;
+
+	/// additional argument, meaning depends on \a type
+	uint8_t argument;
+
+	/// reserved, always 0
+	uint16_t reserved;
+};
+
+static_assert(sizeof(Event) == 12, "Invalid size of trace::Event!");
+
+/// header of binary trace dump, which should be written before all events
+struct Header
+{
+	/// magic value - "DTRC" in little-endian byte order
+	uint32_t magic;
+
+	/// version of binary format of trace
+	uint16_t version;
+
+	/// size of single event, bytes
+	uint16_t eventSize;
+
+	/// frequency of timestamps, Hz
+	uint32_t frequency;
+
+	/// reserved, always 0
+	uint32_t reserved;
+};
+
+static_assert(sizeof(Header) == 16, "Invalid size of trace::Header!");
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// identifier of "tick" interrupt used in EventType::interruptEnter and EventType::interruptExit events
+constexpr uint32_t tickInterruptIdentifier {UINT32_MAX};
+
+#ifdef CONFIG_TRACE_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Records entry to interrupt handler.
+ *
+ * "Tick" interrupt is always traced, other interrupt handlers may use this function and exitInterrupt() to be included
+ * too.
+ *
+ * \param [in] identifier is the identifier of interrupt, for example its number
+ */
+
+void enterInterrupt(uint32_t identifier);
+
+/**
+ * \brief Records exit from interrupt handler.
+ *
+ * \param [in] identifier is the identifier of interrupt, same as the one used with matching enterInterrupt()
+ */
+
+void exitInterrupt(uint32_t identifier);
+
+/**
+ * \return number of events which were dropped because the buffer was full
+ */
+
+uint32_t getDroppedEventCount();
+
+/**
+ * \return header of binary trace dump
+ */
+
+Header getHeader();
+
+/**
+ * \brief Reads and removes events from the buffer.
+ *
+ * Only whole events are read. Binary trace dump consists of Header followed by all data read with this function, for
+ * example:
+ *
+ *     const auto header = distortos::trace::getHeader();
+ *     serialPort.write(&header, sizeof(header));
+ *     uint8_t buffer[240];
+ *     size_t size;
+ *     while ((size = distortos::trace::read(buffer, sizeof(buffer))) != 0)
+ *         serialPort.write(buffer, size);
+ *
+ * Such dump can be converted to Chrome/Perfetto JSON format with scripts/convertTraceToJson.py.
+ *
+ * Events are recorded with interrupts masked, so this function may be used concurrently with recording, but it must
+ * not be used by more than one thread at a time.
+ *
+ * \param [out] buffer is a pointer to buffer for events
+ * \param [in] size is the size of \a buffer, bytes
+ *
+ * \return number of bytes written to \a buffer, multiple of sizeof(Event), 0 if the buffer is empty
+ */
+
+size_t read(void* buffer, size_t size);
+
+/**
+ * \brief Records an event.
+ *
+ * This function may be used by application to record EventType::user events.
+ *
+ * If the buffer is full, the event is dropped and counted - see getDroppedEventCount().
+ *
+ * \param [in] type is the type of event
+ * \param [in] object is the object related to the event or an identifier
+ * \param [in] argument is the additional argument
+ */
+
+void record(EventType type, uint32_t object, uint8_t argument = {});
+
+#endif	// def CONFIG_TRACE_ENABLE
+
+/// \}
+
+}	// namespace trace
+
+}	// namespace distortos
+
+#endif	// INCLUDE_DISTORTOS_TRACE_HPP_
@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+
+#
+# file: convertProfileToText.py
+#
+# author: Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+
+"""Converts binary dump of distortos statistical profiler (profiler::Header followed by data read with
+profiler::read()) to flat and per-thread profiles, using ELF file of the application to symbolize the samples
+
+usage: convertProfileToText.py [--toolchain-prefix prefix] application.elf input.bin
+"""
+
+import argparse
+import bisect
+import collections
+import struct
+import subprocess
+
+# format of profiler::Header
+headerFormat = '<IHHIIQ'
+# magic value of profiler::Header
+headerMagic = 0x46525044
+# supported version of binary format of profile
+formatVersion = 1
+# mangled name of distortos::profiler::getHeader(), address of which is in profiler::Header
+referenceSymbol = '_ZN9distortos8profiler9getHeaderEv'
+
+def readSymbols(nm, elf):
+	"""Reads function symbols from ELF file, returns sorted list of (address, size, name) tuples"""
+	output = subprocess.check_output([nm, '--defined-only', '--print-size', '--numeric-sort', elf],
+			universal_newlines=True)
+	symbols = []
+	for line in output.splitlines():
+		fields = line.split(None, 3)
+		if len(fields) == 4 and fields[2] in 'tTwW':
+			symbols.append((int(fields[0], 16), int(fields[1], 16), fields[3]))
+	return symbols
+
+def demangle(cxxfilt, names):
+	"""Demangles list of names, returns dictionary mapping mangled names to demangled ones"""
+	output = subprocess.check_output([cxxfilt], input='\n'.join(names), universal_newlines=True)
+	return dict(zip(names, output.splitlines()))
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+	parser.add_argument('--toolchain-prefix', default='', help='prefix of nm and c++filt, e.g. arm-none-eabi-')
+	parser.add_argument('elf', help='ELF file of the application')
+	parser.add_argument('input', help='binary profile dump')
+	arguments = parser.parse_args()
+
+	with open(arguments.input, 'rb') as inputFile:
+		data = inputFile.read()
+
+	magic, version, sampleSize, frequency, _, referenceAddress = struct.unpack_from(headerFormat, data)
+	if magic != headerMagic:
+		raise SystemExit('Invalid magic value of profile header')
+	if version != formatVersion:
+		raise SystemExit('Unsupported version of profile format - {}'.format(version))
+	if sampleSize not in (8, 16):
+		raise SystemExit('Invalid size of sample - {}'.format(sampleSize))
+	sampleFormat = '<II' if sampleSize == 8 else '<QQ'
+
+	symbols = readSymbols(arguments.toolchain_prefix + 'nm', arguments.elf)
+	addresses = [symbol[0] for symbol in symbols]
+	# difference between run-time and link-time addresses - non-zero only for relocatable (e.g. PIE) images
+	bias = 0
+	for address, _, name in symbols:
+		if name == referenceSymbol:
+			bias = referenceAddress - address
+			break
+
+	def symbolize(programCounter):
+		linkTimeAddress = programCounter - bias
+		index = bisect.bisect_right(addresses, linkTimeAddress | 1) - 1
+		if index >= 0:
+			address, size, name = symbols[index]
+			if linkTimeAddress < (address & ~1) + max(size, 1):
+				return name
+		return '0x{:x}'.format(programCounter)
+
+	flatProfile = collections.Counter()
+	threadProfiles = collections.defaultdict(collections.Counter)
+	for offset in range(struct.calcsize(headerFormat), len(data) - sampleSize + 1, sampleSize):
+		programCounter, thread = struct.unpack_from(sampleFormat, data, offset)
+		function = symbolize(programCounter)
+		flatProfile[function] += 1
+		threadProfiles[thread][function] += 1
+
+	names = demangle(arguments.toolchain_prefix + 'c++filt', list(flatProfile))
+	totalSamples = sum(flatProfile.values())
+
+	def printProfile(title, profile):
+		samples = sum(profile.values())
+		print('{} - {} samples, {:.3f} s'.format(title, samples, samples / frequency))
+		print('{:>8} {:>7}  {}'.format('samples', '%', 'function'))
+		for function, count in profile.most_common():
+			print('{:>8} {:>6.2f}%  {}'.format(count, 100 * count / samples, names.get(function, function)))
+		print('')
+
+	printProfile('Flat profile', flatProfile)
+	for thread, profile in sorted(threadProfiles.items(), key=lambda item: -sum(item[1].values())):
+		printProfile('Thread 0x{:x} ({:.2f}% of all samples)'.format(thread,
+				100 * sum(profile.values()) / totalSamples), profile)
+
+if __name__ == '__main__':
+	main()
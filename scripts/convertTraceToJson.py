@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+
+#
+# file: convertTraceToJson.py
+#
+# author: Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+
+"""Converts binary dump of distortos trace (trace::Header followed by data read with trace::read()) to Chrome/Perfetto
+JSON format, which can be opened in chrome://tracing or https://ui.perfetto.dev
+
+usage: convertTraceToJson.py input.bin [output.json]
+"""
+
+import json
+import struct
+import sys
+
+# format of trace::Header
+headerFormat = '<IHHII'
+# format of trace::Event
+eventFormat = '<IIBBH'
+# magic value of trace::Header
+headerMagic = 0x43525444
+# supported version of binary format of trace
+formatVersion = 1
+
+# names of trace::EventType values
+eventTypes = ['contextSwitch', 'threadBlock', 'threadUnblock', 'semaphorePost', 'semaphoreWait', 'mutexLock',
+		'mutexUnlock', 'queuePush', 'queuePop', 'softwareTimerExpiry', 'interruptEnter', 'interruptExit', 'user']
+# names of ThreadState values, used for threadBlock events
+threadStates = ['created', 'runnable', 'terminated', 'sleeping', 'blockedOnSemaphore', 'suspended', 'blockedOnMutex',
+		'blockedOnConditionVariable', 'waitingForSignal', 'blockedOnOnceFlag', 'detached', 'blockedOnSpscQueue',
+		'blockedOnEventFlags', 'blockedOnRwLock']
+# names of reasons of unblocking, used for threadUnblock events
+unblockReasons = ['unblockRequest', 'timeout', 'signal']
+
+# process identifier used for all events
+processId = 1
+# thread identifier of "interrupts" track
+interruptsTrackId = 0
+# identifier of "tick" interrupt - trace::tickInterruptIdentifier
+tickInterruptIdentifier = 0xffffffff
+
+def getName(names, value):
+	return names[value] if value < len(names) else str(value)
+
+def convert(data):
+	magic, version, eventSize, frequency, _ = struct.unpack_from(headerFormat, data)
+	if magic != headerMagic:
+		raise ValueError('Invalid magic value of trace header')
+	if version != formatVersion:
+		raise ValueError('Unsupported version of trace format - {}'.format(version))
+	if eventSize < struct.calcsize(eventFormat) or frequency == 0:
+		raise ValueError('Invalid trace header')
+
+	traceEvents = []
+	threads = set()
+	currentThread = None
+	previousTimestamp = None
+	timestamp = 0
+
+	for offset in range(struct.calcsize(headerFormat), len(data) - eventSize + 1, eventSize):
+		rawTimestamp, item, eventType, argument, _ = struct.unpack_from(eventFormat, data, offset)
+
+		# timestamps are low 32 bits of free-running counter - unwrap them
+		if previousTimestamp is not None:
+			timestamp += (rawTimestamp - previousTimestamp) & 0xffffffff
+		previousTimestamp = rawTimestamp
+		ts = timestamp * 1000000 / frequency
+		name = getName(eventTypes, eventType)
+
+		if name == 'contextSwitch':
+			if currentThread is not None:
+				traceEvents.append({'name': 'running', 'ph': 'E', 'pid': processId, 'tid': currentThread, 'ts': ts})
+			currentThread = item
+			threads.add(item)
+			traceEvents.append({'name': 'running', 'ph': 'B', 'pid': processId, 'tid': currentThread, 'ts': ts})
+		elif name in ('interruptEnter', 'interruptExit'):
+			interrupt = 'tick' if item == tickInterruptIdentifier else 'interrupt {}'.format(item)
+			traceEvents.append({'name': interrupt, 'ph': 'B' if name == 'interruptEnter' else 'E', 'pid': processId,
+					'tid': interruptsTrackId, 'ts': ts})
+		else:
+			args = {'object': '0x{:08x}'.format(item), 'argument': argument}
+			tid = currentThread if currentThread is not None else interruptsTrackId
+			if name == 'threadBlock':
+				args['state'] = getName(threadStates, argument)
+				tid = item
+			elif name == 'threadUnblock':
+				args['reason'] = getName(unblockReasons, argument)
+				tid = item
+			if name in ('threadBlock', 'threadUnblock'):
+				threads.add(item)
+			traceEvents.append({'name': name, 'ph': 'i', 's': 't', 'pid': processId, 'tid': tid, 'ts': ts,
+					'args': args})
+
+	if currentThread is not None:
+		traceEvents.append({'name': 'running', 'ph': 'E', 'pid': processId, 'tid': currentThread,
+				'ts': timestamp * 1000000 / frequency})
+
+	traceEvents.append({'name': 'process_name', 'ph': 'M', 'pid': processId, 'args': {'name': 'distortos'}})
+	traceEvents.append({'name': 'thread_name', 'ph': 'M', 'pid': processId, 'tid': interruptsTrackId,
+			'args': {'name': 'interrupts'}})
+	for thread in sorted(threads):
+		traceEvents.append({'name': 'thread_name', 'ph': 'M', 'pid': processId, 'tid': thread,
+				'args': {'name': 'thread 0x{:08x}'.format(thread)}})
+
+	return {'traceEvents': traceEvents, 'displayTimeUnit': 'ns'}
+
+def main():
+	if len(sys.argv) not in (2, 3):
+		sys.exit(__doc__)
+
+	with open(sys.argv[1], 'rb') as inputFile:
+		trace = convert(inputFile.read())
+
+	if len(sys.argv) == 3:
+		with open(sys.argv[2], 'w') as outputFile:
+			json.dump(trace, outputFile)
+	else:
+		json.dump(trace, sys.stdout)
+
+if __name__ == '__main__':
+	main()
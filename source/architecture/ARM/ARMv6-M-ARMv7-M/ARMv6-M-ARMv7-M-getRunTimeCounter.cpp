@@ -0,0 +1,77 @@
+/**
+ * \file
+ * \brief getRunTimeCounter() and getRunTimeCounterFrequency() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/getRunTimeCounter.hpp"
+
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+#include "ARMv6-M-ARMv7-M-SysTick.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#ifdef __ARM_ARCH_6M__
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#endif	// def __ARM_ARCH_6M__
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+#ifdef __ARM_ARCH_6M__
+
+uint32_t getRunTimeCounter()
+{
+	// ARMv6-M has no cycle counter - the counter is derived from tick count and current value of SysTick
+	uint32_t value = SysTick->VAL;
+	auto tickCount = internal::getScheduler().getTickCount();
+	// SysTick already reloaded, but "tick" interrupt was not handled yet?
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)
+	{
+		value = SysTick->VAL;
+		++tickCount;
+	}
+
+	return tickCount * sysTickPeriod + (sysTickPeriod - 1 - value);
+}
+
+uint32_t getRunTimeCounterFrequency()
+{
+	return sysTickDivideBy8 == false ? chip::ahbFrequency : chip::ahbFrequency / 8;
+}
+
+#else	// !def __ARM_ARCH_6M__
+
+uint32_t getRunTimeCounter()
+{
+	return DWT->CYCCNT;
+}
+
+uint32_t getRunTimeCounterFrequency()
+{
+	return chip::ahbFrequency;
+}
+
+#endif	// !def __ARM_ARCH_6M__
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
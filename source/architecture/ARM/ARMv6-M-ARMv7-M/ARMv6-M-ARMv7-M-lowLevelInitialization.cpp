@@ -2,7 +2,7 @@
  * \file
  * \brief lowLevelInitialization() implementation for ARMv6-M and ARMv7-M
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,11 @@
 
 #include "distortos/architecture/lowLevelInitialization.hpp"
 
+#include "ARMv7-M-stackGuard.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
 #include "distortos/chip/CMSIS-proxy.h"
 
 namespace distortos
@@ -28,6 +33,17 @@ void lowLevelInitialization()
 #if __FPU_PRESENT == 1 && __FPU_USED == 1
 	SCB->CPACR |= (3 << 10 * 2) | (3 << 11 * 2);	// full access to CP10 and CP11
 #endif	// __FPU_PRESENT == 1 && __FPU_USED == 1
+
+#if defined(CONFIG_STATISTICS_RUN_TIME_ENABLE) && !defined(__ARM_ARCH_6M__)
+	// DWT's cycle counter is used by architecture::getRunTimeCounter()
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+#endif	// defined(CONFIG_STATISTICS_RUN_TIME_ENABLE) && !defined(__ARM_ARCH_6M__)
+
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+	// main() thread is already the current thread of the scheduler
+	initializeStackGuard(internal::getScheduler().getCurrentThreadControlBlock().getStack());
+#endif	// def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
 }
 
 }	// namespace architecture
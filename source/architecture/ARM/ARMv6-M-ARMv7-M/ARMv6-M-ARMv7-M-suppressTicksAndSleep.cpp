@@ -0,0 +1,124 @@
+/**
+ * \file
+ * \brief suppressTicksAndSleep() implementation for ARMv6-M and ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/suppressTicksAndSleep.hpp"
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+#include "ARMv6-M-ARMv7-M-SysTick.hpp"
+
+#include "distortos/architecture/waitForInterrupt.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Restarts stopped SysTick, so that next "tick" interrupt is generated after \a cycles SysTick clock cycles and
+ * all following "tick" interrupts are generated with regular period.
+ *
+ * \param [in] ctrl is the value of SysTick's CTRL register with cleared ENABLE bit
+ * \param [in] cycles is the number of SysTick clock cycles after which next "tick" interrupt will be generated, must
+ * be in [2; maxSysTickPeriod] range
+ */
+
+void restartSysTick(const uint32_t ctrl, const uint32_t cycles)
+{
+	SysTick->LOAD = cycles - 1;
+	SysTick->VAL = 0;
+	// when clocked from core clock, SysTick loads the new value immediately instead of at next edge of slower clock, so
+	// it is safe to write "regular" reload value right after that
+	SysTick->CTRL = ctrl | SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_ENABLE_Msk;
+	SysTick->LOAD = sysTickPeriod - 1;
+	SysTick->CTRL = ctrl | SysTick_CTRL_ENABLE_Msk;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint32_t suppressTicksAndSleep(const uint32_t ticks)
+{
+	constexpr uint32_t maxSuppressedTicks {maxSysTickPeriod / sysTickPeriod};
+	const auto expectedTicks = std::min(ticks, maxSuppressedTicks);
+	if (expectedTicks < 2)
+		return 0;
+
+	const auto ctrl = SysTick->CTRL & ~(SysTick_CTRL_ENABLE_Msk | SysTick_CTRL_COUNTFLAG_Msk);
+	SysTick->CTRL = ctrl;	// stop SysTick
+
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)	// "tick" interrupt is already pending?
+	{
+		SysTick->CTRL = ctrl | SysTick_CTRL_ENABLE_Msk;
+		return 0;
+	}
+
+	// cycles left in current tick - the number of cycles "lost" while SysTick is stopped is not compensated
+	const uint32_t initialValue = SysTick->VAL;
+	const auto currentTickCycles = initialValue != 0 ? initialValue : 1;
+	const auto sleepCycles = currentTickCycles + (expectedTicks - 1) * sysTickPeriod;
+	restartSysTick(ctrl, sleepCycles);
+
+	waitForInterrupt();
+
+	SysTick->CTRL = ctrl;	// stop SysTick
+	const uint32_t value = SysTick->VAL;
+
+	if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0)	// whole sleep period elapsed?
+	{
+		// pending "tick" interrupt accounts for the last tick, SysTick was already reloaded with "regular" period
+		const auto elapsedCycles = sysTickPeriod - 1 - value;
+		const auto cycles = sysTickPeriod - elapsedCycles;
+		restartSysTick(ctrl, cycles >= 2 ? cycles : sysTickPeriod);
+		return expectedTicks - 1;
+	}
+
+	// sleep was interrupted before the end - calculate how many tick boundaries were crossed
+	const auto elapsedCycles = sleepCycles - 1 - value;
+	uint32_t elapsedTicks {};
+	auto cycles = currentTickCycles - elapsedCycles;
+	if (elapsedCycles >= currentTickCycles)
+	{
+		const auto afterFirstTickCycles = elapsedCycles - currentTickCycles;
+		elapsedTicks = 1 + afterFirstTickCycles / sysTickPeriod;
+		cycles = sysTickPeriod - afterFirstTickCycles % sysTickPeriod;
+	}
+	// too close to next tick boundary - treat it as already crossed and let the handler account for it
+	if (cycles < 2)
+	{
+		SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+		cycles = std::min(cycles + sysTickPeriod, maxSysTickPeriod);
+	}
+
+	restartSysTick(ctrl, cycles);
+	return elapsedTicks;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
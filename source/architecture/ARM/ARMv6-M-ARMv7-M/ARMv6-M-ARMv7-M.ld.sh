@@ -64,6 +64,7 @@ memoryEntries=
 memorySizes=
 dataArrayEntries=
 bssArrayEntries=
+heapArrayEntries=
 sectionEntries=
 sectionSizes=
 
@@ -94,6 +95,9 @@ LONG(ADDR(.${memoryName}.data) + SIZEOF(.${memoryName}.data));\n"
 	bssArrayEntries="$bssArrayEntries\
 \t\tLONG(ADDR(.${memoryName}.bss)); LONG(ADDR(.${memoryName}.bss) + SIZEOF(.${memoryName}.bss));\n"
 
+	heapArrayEntries="$heapArrayEntries\
+\t\tLONG(ADDR(.${memoryName}.noinit) + SIZEOF(.${memoryName}.noinit)); LONG(__${memoryName}_end);\n"
+
 	sectionEntries="$sectionEntries\
 	.${memoryName}.bss :
 	{
@@ -277,6 +281,23 @@ cat<<EOF
 
 		/* end of sub-section: bss_array */
 
+		/* sub-section: heap_array */
+
+		. = ALIGN(4);
+		PROVIDE(__heap_array_start = .);
+
+		LONG(__heap_start); LONG(__heap_end);
+EOF
+
+printf "%b" "$heapArrayEntries"
+
+cat<<EOF
+
+		. = ALIGN(4);
+		PROVIDE(__heap_array_end = .);
+
+		/* end of sub-section: heap_array */
+
 		/* sub-sections: init, preinit_array, init_array and fini_array */
 
 		KEEP(*(.init));
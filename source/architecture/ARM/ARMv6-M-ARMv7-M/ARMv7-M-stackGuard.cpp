@@ -0,0 +1,55 @@
+/**
+ * \file
+ * \brief Definitions of functions used for MPU stack guard for ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ARMv7-M-stackGuard.hpp"
+
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// value of MPU_RASR register for stack guard - region is enabled, no access, non-executable, size is 2^(SIZE + 1)
+constexpr uint32_t stackGuardRasr {MPU_RASR_XN_Msk | ((__builtin_ctz(stackGuardSize) - 1) << MPU_RASR_SIZE_Pos) |
+		MPU_RASR_ENABLE_Msk};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void initializeStackGuard(const Stack& stack)
+{
+	MPU->RNR = stackGuardMpuRegion;
+	MPU->RASR = {};	// disable the region before it is moved
+	setStackGuard(stack);
+	MPU->RASR = stackGuardRasr;
+	MPU->CTRL = MPU_CTRL_PRIVDEFENA_Msk | MPU_CTRL_ENABLE_Msk;
+	SCB->SHCSR |= SCB_SHCSR_MEMFAULTENA_Msk;
+	__DSB();
+	__ISB();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
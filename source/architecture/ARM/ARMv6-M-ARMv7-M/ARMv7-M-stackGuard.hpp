@@ -0,0 +1,78 @@
+/**
+ * \file
+ * \brief Declarations of functions used for MPU stack guard for ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV7_M_STACKGUARD_HPP_
+#define SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV7_M_STACKGUARD_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+#include "distortos/architecture/Stack.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#if !defined(__MPU_PRESENT) || __MPU_PRESENT != 1
+#error "MPU stack guard requires MPU!"
+#endif	// !defined(__MPU_PRESENT) || __MPU_PRESENT != 1
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/// number of MPU region used for stack guard - the highest region available in all ARMv7-M MPUs, which has priority
+/// over regions 0-6
+constexpr uint8_t stackGuardMpuRegion {7};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Initializes MPU stack guard.
+ *
+ * Configures MPU region used for stack guard as no-access and non-executable, places it just below \a stack, enables
+ * MPU (with default memory map used as background region for privileged accesses) and MemManage fault.
+ *
+ * \param [in] stack is a reference to stack of current thread
+ */
+
+void initializeStackGuard(const Stack& stack);
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Moves MPU stack guard just below \a stack.
+ *
+ * Only base address of MPU region is written - its attributes and size were already set by initializeStackGuard(), so
+ * this function is cheap enough to be used during each context switch.
+ *
+ * \param [in] stack is a reference to stack of thread which is going to be executed
+ */
+
+inline void setStackGuard(const Stack& stack)
+{
+	const auto guard = reinterpret_cast<uint32_t>(stack.getAdjustedStorage()) - stackGuardSize;
+	MPU->RBAR = guard | MPU_RBAR_VALID_Msk | stackGuardMpuRegion;
+	__DSB();
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+#endif	// SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_ARMV7_M_STACKGUARD_HPP_
@@ -14,6 +14,9 @@ ifeq ($(or $(CONFIG_ARCHITECTURE_ARMV6_M),$(CONFIG_ARCHITECTURE_ARMV7_M)),y)
 #-----------------------------------------------------------------------------------------------------------------------
 
 ASFLAGS_$(d)ARMv6-M-ARMv7-M-Reset_Handler.S := -D__USES_TWO_STACKS -D__USES_CXX
+ifeq ($(CONFIG_STACK_PAINTING_ENABLE),y)
+ASFLAGS_$(d)ARMv6-M-ARMv7-M-Reset_Handler.S += -D__STACK_PAINTING_PATTERN=$(CONFIG_STACK_PAINTING_PATTERN)
+endif	# eq ($(CONFIG_STACK_PAINTING_ENABLE),y)
 
 CXXFLAGS_$(d) := $(CXXFLAGS_$(d)) $(STANDARD_INCLUDES)
 CXXFLAGS_$(d) := $(CXXFLAGS_$(d)) $(ARCHITECTURE_INCLUDES)
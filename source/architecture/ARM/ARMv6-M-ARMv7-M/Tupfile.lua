@@ -10,6 +10,10 @@
 if CONFIG_ARCHITECTURE_ARMV6_M == "y" or CONFIG_ARCHITECTURE_ARMV7_M == "y" then
 
 	ASFLAGS["ARMv6-M-ARMv7-M-Reset_Handler.S"] = "-D__USES_TWO_STACKS -D__USES_CXX"
+	if CONFIG_STACK_PAINTING_ENABLE == "y" then
+		ASFLAGS["ARMv6-M-ARMv7-M-Reset_Handler.S"] = ASFLAGS["ARMv6-M-ARMv7-M-Reset_Handler.S"] ..
+				" -D__STACK_PAINTING_PATTERN=" .. CONFIG_STACK_PAINTING_PATTERN
+	end	-- if CONFIG_STACK_PAINTING_ENABLE == "y" then
 
 	CXXFLAGS += STANDARD_INCLUDES
 	CXXFLAGS += ARCHITECTURE_INCLUDES
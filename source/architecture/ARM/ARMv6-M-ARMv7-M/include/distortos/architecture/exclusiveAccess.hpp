@@ -0,0 +1,93 @@
+/**
+ * \file
+ * \brief Exclusive access functions for ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_EXCLUSIVEACCESS_HPP_
+#define SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_EXCLUSIVEACCESS_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Clears the exclusive monitor, abandoning exclusive access started with loadExclusive().
+ */
+
+inline void clearExclusive()
+{
+	asm volatile ("clrex" ::: "memory");
+}
+
+/**
+ * \brief Loads the value of object and marks its address for exclusive access.
+ *
+ * The local exclusive monitor is cleared on each exception entry and return, so storeExclusive() fails if an interrupt
+ * or a context switch happened after loadExclusive(). On single-core system this makes the whole sequence from
+ * loadExclusive() to successful storeExclusive() atomic - all values which are read between these two calls are
+ * guaranteed to be unchanged when the store succeeds.
+ *
+ * \tparam T is the type of object, its size must be 4 bytes
+ *
+ * \param [in] object is a reference to object which will be loaded
+ *
+ * \return value of \a object
+ */
+
+template<typename T>
+inline T loadExclusive(T& object)
+{
+	static_assert(sizeof(T) == sizeof(uint32_t), "Only 32-bit objects can be accessed exclusively!");
+
+	T value;
+	asm volatile ("ldrex	%[value], %[object]" : [value] "=r" (value) : [object] "Q" (object) : "memory");
+	return value;
+}
+
+/**
+ * \brief Stores new value of object if the exclusive access started with loadExclusive() was not interrupted.
+ *
+ * \tparam T is the type of object, its size must be 4 bytes
+ *
+ * \param [out] object is a reference to object which will be stored
+ * \param [in] value is the new value of \a object
+ *
+ * \return true if the store succeeded, false if exclusive access was lost and the whole sequence must be repeated
+ */
+
+template<typename T>
+inline bool storeExclusive(T& object, const T value)
+{
+	static_assert(sizeof(T) == sizeof(uint32_t), "Only 32-bit objects can be accessed exclusively!");
+
+	uint32_t failed;
+	asm volatile ("strex	%[failed], %[value], %[object]" : [failed] "=&r" (failed), [object] "=Q" (object) :
+			[value] "r" (value) : "memory");
+	return failed == 0;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+#endif	// SOURCE_ARCHITECTURE_ARM_ARMV6_M_ARMV7_M_INCLUDE_DISTORTOS_ARCHITECTURE_EXCLUSIVEACCESS_HPP_
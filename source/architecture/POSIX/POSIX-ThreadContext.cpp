@@ -0,0 +1,92 @@
+/**
+ * \file
+ * \brief ThreadContext-related functions' implementation for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "POSIX-ThreadContext.hpp"
+
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
+#include <algorithm>
+#include <new>
+
+#include <csignal>
+#include <cstdlib>
+
+#include <sys/mman.h>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// ThreadContext of main thread, which is executed on the stack of the process
+ThreadContext mainThreadContext;
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+ThreadContext& createThreadContext()
+{
+	// memory is taken directly from the host, so that it is not visible in statistics of the allocator
+	const auto memory = mmap(nullptr, sizeof(ThreadContext) + ThreadContext::hostStackSize, PROT_READ | PROT_WRITE,
+			MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (memory == MAP_FAILED)
+		abort();
+
+	const auto threadContext = new (memory) ThreadContext {};
+	threadContext->hostStack = threadContext + 1;
+	return *threadContext;
+}
+
+void destroyThreadContext(ThreadContext& threadContext)
+{
+	if (&threadContext == &mainThreadContext)
+		return;
+
+	threadContext.~ThreadContext();
+	munmap(&threadContext, sizeof(ThreadContext) + ThreadContext::hostStackSize);
+}
+
+void executePendingFunctions(ThreadContext& threadContext, const sigset_t& threadInterruptMask)
+{
+	while (threadContext.pendingFunctionsCount != 0)
+	{
+		const auto begin = threadContext.pendingFunctions.begin();
+		const auto function = *begin;
+		std::copy(begin + 1, begin + threadContext.pendingFunctionsCount, begin);
+		--threadContext.pendingFunctionsCount;
+
+		sigset_t interruptMask;
+		sigprocmask(SIG_SETMASK, &threadInterruptMask, &interruptMask);
+		function();
+		sigprocmask(SIG_SETMASK, &interruptMask, nullptr);
+	}
+}
+
+ThreadContext& getThreadContext(internal::ThreadControlBlock& threadControlBlock)
+{
+	const auto stackPointer = threadControlBlock.getStack().getStackPointer();
+	return stackPointer != nullptr ? *static_cast<ThreadContext*>(stackPointer) : mainThreadContext;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,127 @@
+/**
+ * \file
+ * \brief ThreadContext struct header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_POSIX_POSIX_THREADCONTEXT_HPP_
+#define SOURCE_ARCHITECTURE_POSIX_POSIX_THREADCONTEXT_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#include <array>
+
+#include <ucontext.h>
+
+namespace distortos
+{
+
+class Thread;
+
+namespace internal
+{
+
+class ThreadControlBlock;
+
+}	// namespace internal
+
+namespace architecture
+{
+
+/**
+ * \brief ThreadContext struct is the host's context of thread for POSIX.
+ *
+ * Pointer to this object is used as thread's "stack pointer". Code compiled for the host needs much more stack than the
+ * same code compiled for a microcontroller and handlers of host signals are executed on the stack of interrupted
+ * thread, so the buffer provided for the stack is not used for execution - each thread is executed on a separate host
+ * stack of hostStackSize bytes. Object (together with its host stack) is created by initializeStack() and destroyed by
+ * deinitializeStack() when the stack is destroyed.
+ */
+
+struct ThreadContext
+{
+	/// size of host stack, bytes
+	constexpr static size_t hostStackSize {CONFIG_ARCHITECTURE_POSIX_THREAD_STACK_SIZE};
+
+	/// max number of different functions which may be pending for execution in the thread
+	constexpr static size_t maxPendingFunctions {4};
+
+	/// host's context of thread
+	ucontext_t context;
+
+	/// host stack on which the thread is executed
+	void* hostStack;
+
+	/// pointer to Thread object passed to functions
+	Thread* thread;
+
+	/// pointer to Thread's "run" function
+	void (* run)(Thread&);
+
+	/// pointer to Thread's pre-termination hook, nullptr to skip
+	void (* preTerminationHook)(Thread&);
+
+	/// pointer to Thread's termination hook
+	void (* terminationHook)(Thread&);
+
+	/// functions which should be executed in the thread as soon as it resumes execution
+	std::array<void (*)(), maxPendingFunctions> pendingFunctions;
+
+	/// number of valid elements in pendingFunctions
+	size_t pendingFunctionsCount;
+};
+
+/**
+ * \brief Creates new ThreadContext with its host stack.
+ *
+ * Memory is taken directly from the host, so that it is not visible in statistics of the allocator. Failure to get the
+ * memory is fatal.
+ *
+ * \return reference to created ThreadContext
+ */
+
+ThreadContext& createThreadContext();
+
+/**
+ * \brief Destroys ThreadContext created by createThreadContext(), releasing its host stack.
+ *
+ * \attention Thread associated with \a threadContext must not be executed anymore.
+ *
+ * \param [in] threadContext is a reference to ThreadContext which will be destroyed, statically allocated ThreadContext
+ * of main thread is ignored
+ */
+
+void destroyThreadContext(ThreadContext& threadContext);
+
+/**
+ * \brief Executes all functions which were requested to be executed in the thread.
+ *
+ * \attention This function must be called with interrupt masking enabled.
+ *
+ * \param [in] threadContext is a reference to ThreadContext of current thread
+ * \param [in] threadInterruptMask is the interrupt mask with which the functions will be executed
+ */
+
+void executePendingFunctions(ThreadContext& threadContext, const sigset_t& threadInterruptMask);
+
+/**
+ * \brief Gets ThreadContext of thread.
+ *
+ * \param [in] threadControlBlock is a reference to internal::ThreadControlBlock of thread
+ *
+ * \return reference to ThreadContext of thread associated with \a threadControlBlock - for main thread which was not
+ * yet switched out this is a statically allocated object
+ */
+
+ThreadContext& getThreadContext(internal::ThreadControlBlock& threadControlBlock);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_POSIX_POSIX_THREADCONTEXT_HPP_
@@ -0,0 +1,33 @@
+/**
+ * \file
+ * \brief deinitializeStack() implementation for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \\par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/deinitializeStack.hpp"
+
+#include "POSIX-ThreadContext.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void deinitializeStack(void* const stackPointer)
+{
+	destroyThreadContext(*static_cast<ThreadContext*>(stackPointer));
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,36 @@
+/**
+ * \file
+ * \brief disableInterruptMasking() implementation for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/disableInterruptMasking.hpp"
+
+#include "POSIX-interrupts.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+InterruptMask disableInterruptMasking()
+{
+	const auto interruptSignals = getInterruptSignals();
+	InterruptMask interruptMask;
+	sigprocmask(SIG_UNBLOCK, &interruptSignals, &interruptMask);
+	return interruptMask;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
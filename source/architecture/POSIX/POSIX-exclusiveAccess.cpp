@@ -0,0 +1,34 @@
+/**
+ * \file
+ * \brief Emulation of exclusive access functions for POSIX - implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/exclusiveAccess.hpp"
+
+#ifdef CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const volatile void* volatile exclusiveMonitor;
+
+volatile unsigned int forcedExclusiveStoreFailures;
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION
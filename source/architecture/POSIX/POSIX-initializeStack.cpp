@@ -0,0 +1,98 @@
+/**
+ * \file
+ * \brief initializeStack() implementation for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/initializeStack.hpp"
+
+#include "POSIX-interrupts.hpp"
+#include "POSIX-ThreadContext.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include "distortos/internal/scheduler/threadRunner.hpp"
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Entry point of each thread's host context.
+ *
+ * makecontext() passes only int arguments, so the pointer to ThreadContext is split into two halves.
+ *
+ * \param [in] high is the upper half of pointer to ThreadContext of thread
+ * \param [in] low is the lower half of pointer to ThreadContext of thread
+ */
+
+void threadEntry(const unsigned int high, const unsigned int low)
+{
+	auto& threadContext = *reinterpret_cast<ThreadContext*>(static_cast<uintptr_t>(static_cast<uint64_t>(high) << 32 |
+			low));
+
+	// thread is started from contextSwitchHandler(), but its execution doesn't begin in the handler
+	interruptNesting = 0;
+
+	{
+		const auto interruptMask = enableInterruptMasking();
+		executePendingFunctions(threadContext, interruptMask);
+		restoreInterruptMasking(interruptMask);
+	}
+
+	internal::threadRunner(*threadContext.thread, *threadContext.run, threadContext.preTerminationHook,
+			*threadContext.terminationHook);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void* initializeStack(void*, size_t, Thread& thread, void (& run)(Thread&),
+		void (* preTerminationHook)(Thread&), void (& terminationHook)(Thread&))
+{
+	const InterruptMaskingLock interruptMaskingLock;
+
+	auto& threadContext = createThreadContext();
+	threadContext.thread = &thread;
+	threadContext.run = &run;
+	threadContext.preTerminationHook = preTerminationHook;
+	threadContext.terminationHook = &terminationHook;
+	threadContext.pendingFunctionsCount = 0;
+
+	getcontext(&threadContext.context);
+	threadContext.context.uc_stack.ss_sp = threadContext.hostStack;
+	threadContext.context.uc_stack.ss_size = ThreadContext::hostStackSize;
+	threadContext.context.uc_link = {};
+	// thread starts with interrupt masking disabled
+	sigdelset(&threadContext.context.uc_sigmask, tickSignal);
+	sigdelset(&threadContext.context.uc_sigmask, contextSwitchSignal);
+
+	const auto address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&threadContext));
+	makecontext(&threadContext.context, reinterpret_cast<void(*)()>(threadEntry), 2,
+			static_cast<unsigned int>(address >> 32), static_cast<unsigned int>(address));
+
+	return &threadContext;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
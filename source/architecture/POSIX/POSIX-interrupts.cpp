@@ -0,0 +1,41 @@
+/**
+ * \file
+ * \brief Host signals used as interrupts in POSIX - implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "POSIX-interrupts.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+volatile sig_atomic_t interruptNesting;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+sigset_t getInterruptSignals()
+{
+	sigset_t interruptSignals;
+	sigemptyset(&interruptSignals);
+	sigaddset(&interruptSignals, tickSignal);
+	sigaddset(&interruptSignals, contextSwitchSignal);
+	return interruptSignals;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,73 @@
+/**
+ * \file
+ * \brief Host signals used as interrupts in POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_POSIX_POSIX_INTERRUPTS_HPP_
+#define SOURCE_ARCHITECTURE_POSIX_POSIX_INTERRUPTS_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#include <csignal>
+
+#include <sys/time.h>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/// host signal used as "tick" interrupt, generated by periodic interval timer
+constexpr int tickSignal {SIGALRM};
+
+/// period of "tick" interrupt, microseconds
+constexpr suseconds_t tickPeriod {1000000 / CONFIG_TICK_FREQUENCY};
+
+static_assert(tickPeriod > 0, "Invalid CONFIG_TICK_FREQUENCY value!");
+
+/// host signal used as "context switch" interrupt - equivalent of PendSV
+constexpr int contextSwitchSignal {SIGUSR1};
+
+/// nesting level of interrupts, 0 when thread's code is executed
+extern volatile sig_atomic_t interruptNesting;
+
+/**
+ * \return set of host signals used as interrupts
+ */
+
+sigset_t getInterruptSignals();
+
+/**
+ * \brief Handler of "context switch" interrupt.
+ *
+ * Performs the context switch and then executes functions which were requested to be executed in the thread that
+ * resumes execution.
+ *
+ * \param [in] context is a pointer to ucontext_t with host's context of interrupted thread
+ */
+
+void contextSwitchHandler(int, siginfo_t*, void* context);
+
+/**
+ * \brief Handler of "tick" interrupt.
+ *
+ * Executes scheduler's "tick" interrupt handler and then executes functions which were requested to be executed in
+ * the interrupted thread.
+ *
+ * \param [in] context is a pointer to ucontext_t with host's context of interrupted thread
+ */
+
+void tickHandler(int, siginfo_t*, void* context);
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_POSIX_POSIX_INTERRUPTS_HPP_
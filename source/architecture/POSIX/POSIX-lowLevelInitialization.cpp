@@ -0,0 +1,42 @@
+/**
+ * \file
+ * \brief lowLevelInitialization() implementation for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/lowLevelInitialization.hpp"
+
+#include "POSIX-interrupts.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void lowLevelInitialization()
+{
+	// handlers of "interrupts" can't be nested
+	struct sigaction action {};
+	action.sa_flags = SA_SIGINFO | SA_RESTART;
+	action.sa_mask = getInterruptSignals();
+
+	action.sa_sigaction = contextSwitchHandler;
+	sigaction(contextSwitchSignal, &action, nullptr);
+
+	action.sa_sigaction = tickHandler;
+	sigaction(tickSignal, &action, nullptr);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
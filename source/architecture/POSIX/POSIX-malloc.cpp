@@ -0,0 +1,176 @@
+/**
+ * \file
+ * \brief Wrappers for host's memory allocation functions for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+
+#include <malloc.h>
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of bytes in all blocks which are currently allocated
+size_t allocatedMemory;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Adds usable size of allocated block to \a allocatedMemory.
+ *
+ * \param [in] memory is a pointer to allocated block, may be nullptr
+ *
+ * \return \a memory
+ */
+
+void* addAllocatedMemory(void* const memory)
+{
+	if (memory != nullptr)
+		allocatedMemory += malloc_usable_size(memory);
+	return memory;
+}
+
+}	// namespace
+
+extern "C"
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| external functions' declarations
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// glibc's implementations of memory allocation functions
+void* __libc_calloc(size_t elements, size_t size);
+void __libc_free(void* memory);
+struct mallinfo __libc_mallinfo();
+void* __libc_malloc(size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void* __libc_pvalloc(size_t size);
+void* __libc_realloc(void* memory, size_t size);
+void* __libc_valloc(size_t size);
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+// Host's allocator protects its state with locks which are not aware of threads executed by distortos - a context
+// switch while the lock is held would lead to a deadlock, so all allocator functions are executed with interrupt
+// masking enabled.
+
+void* aligned_alloc(const size_t alignment, const size_t size)
+{
+	const distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+	return addAllocatedMemory(__libc_memalign(alignment, size));
+}
+
+void* calloc(const size_t elements, const size_t size)
+{
+	const distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+	return addAllocatedMemory(__libc_calloc(elements, size));
+}
+
+void free(void* const memory)
+{
+	const distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+	if (memory != nullptr)
+		allocatedMemory -= malloc_usable_size(memory);
+	__libc_free(memory);
+}
+
+struct mallinfo mallinfo()
+{
+	const distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+	auto info = __libc_mallinfo();
+	// blocks cached by host's allocator in per-thread caches are reported as allocated, so the number of bytes in use
+	// is replaced with the value which takes into account only blocks which were not freed
+	info.uordblks = allocatedMemory;
+	return info;
+}
+
+#if __GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33)
+
+struct mallinfo2 mallinfo2()
+{
+	const distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+	// glibc doesn't export its own implementation of mallinfo2() under another name, so the values are taken from
+	// mallinfo() and extended to size_t
+	const auto info = __libc_mallinfo();
+	struct mallinfo2 info2 {};
+	info2.arena = static_cast<unsigned int>(info.arena);
+	info2.ordblks = static_cast<unsigned int>(info.ordblks);
+	info2.smblks = static_cast<unsigned int>(info.smblks);
+	info2.hblks = static_cast<unsigned int>(info.hblks);
+	info2.hblkhd = static_cast<unsigned int>(info.hblkhd);
+	info2.usmblks = static_cast<unsigned int>(info.usmblks);
+	info2.fsmblks = static_cast<unsigned int>(info.fsmblks);
+	info2.uordblks = allocatedMemory;
+	info2.fordblks = static_cast<unsigned int>(info.fordblks);
+	info2.keepcost = static_cast<unsigned int>(info.keepcost);
+	return info2;
+}
+
+#endif	// __GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33)
+
+void* malloc(const size_t size)
+{
+	const distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+	return addAllocatedMemory(__libc_malloc(size));
+}
+
+void* memalign(const size_t alignment, const size_t size)
+{
+	const distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+	return addAllocatedMemory(__libc_memalign(alignment, size));
+}
+
+int posix_memalign(void** const memory, const size_t alignment, const size_t size)
+{
+	if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0)
+		return EINVAL;
+
+	const auto allocatedMemory = memalign(alignment, size);
+	if (allocatedMemory == nullptr)
+		return ENOMEM;
+
+	*memory = allocatedMemory;
+	return 0;
+}
+
+void* pvalloc(const size_t size)
+{
+	const distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+	return addAllocatedMemory(__libc_pvalloc(size));
+}
+
+void* realloc(void* const memory, const size_t size)
+{
+	const distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+	const auto previousSize = memory != nullptr ? malloc_usable_size(memory) : 0;
+	const auto newMemory = __libc_realloc(memory, size);
+	if (newMemory != nullptr || size == 0)	// previous block was freed or moved?
+		allocatedMemory -= previousSize;
+	return addAllocatedMemory(newMemory);
+}
+
+void* valloc(const size_t size)
+{
+	const distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+	return addAllocatedMemory(__libc_valloc(size));
+}
+
+}	// extern "C"
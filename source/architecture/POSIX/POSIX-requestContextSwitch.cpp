@@ -0,0 +1,34 @@
+/**
+ * \file
+ * \brief requestContextSwitch() implementation for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/requestContextSwitch.hpp"
+
+#include "POSIX-interrupts.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void requestContextSwitch()
+{
+	// if interrupts are masked, the signal remains pending until masking is disabled
+	raise(contextSwitchSignal);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
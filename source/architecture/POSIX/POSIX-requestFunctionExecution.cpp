@@ -0,0 +1,66 @@
+/**
+ * \file
+ * \brief requestFunctionExecution() implementation for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/requestFunctionExecution.hpp"
+
+#include "POSIX-interrupts.hpp"
+#include "POSIX-ThreadContext.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include <algorithm>
+
+#include <cstdlib>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void requestFunctionExecution(internal::ThreadControlBlock& threadControlBlock, void (& function)())
+{
+	const auto& currentThreadControlBlock = internal::getScheduler().getCurrentThreadControlBlock();
+	const auto toCurrentThread = &threadControlBlock == &currentThreadControlBlock;
+	if (toCurrentThread == true && interruptNesting == 0)	// current thread is sending the request to itself?
+	{
+		function();	// execute function right away
+		return;
+	}
+
+	// if interrupt is sending the request to current thread, functions will be executed when the interrupt returns,
+	// otherwise - when the thread resumes execution
+
+	const InterruptMaskingLock interruptMaskingLock;
+
+	auto& threadContext = getThreadContext(threadControlBlock);
+	const auto begin = threadContext.pendingFunctions.begin();
+	const auto end = begin + threadContext.pendingFunctionsCount;
+	if (std::find(begin, end, &function) != end)	// each pending function is executed just once
+		return;
+
+	if (threadContext.pendingFunctionsCount == threadContext.pendingFunctions.size())
+		abort();
+
+	*end = &function;
+	++threadContext.pendingFunctionsCount;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
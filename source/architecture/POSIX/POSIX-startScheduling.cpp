@@ -0,0 +1,37 @@
+/**
+ * \file
+ * \brief startScheduling() implementation for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/startScheduling.hpp"
+
+#include "POSIX-interrupts.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void startScheduling()
+{
+	// configure periodic interval timer of the process as the tick timer
+	itimerval timer {};
+	timer.it_interval.tv_usec = tickPeriod;
+	timer.it_value.tv_usec = tickPeriod;
+	setitimer(ITIMER_REAL, &timer, nullptr);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,149 @@
+/**
+ * \file
+ * \brief suppressTicksAndSleep() implementation for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/suppressTicksAndSleep.hpp"
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+#include "POSIX-interrupts.hpp"
+
+#include "distortos/architecture/waitForInterrupt.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \return true if "tick" interrupt is pending, false otherwise
+ */
+
+bool isTickPending()
+{
+	sigset_t pendingSignals;
+	sigpending(&pendingSignals);
+	return sigismember(&pendingSignals, tickSignal) == 1;
+}
+
+/**
+ * \brief Restarts interval timer of the process which was stopped with stopTimer().
+ *
+ * If the timer expired just before it was stopped, then its signal is pending and it_value is zero - setting such value
+ * would disable the timer completely (including the reload with it_interval), so the timer is restarted with full
+ * period instead.
+ *
+ * \param [in] timer is the state of interval timer returned by stopTimer()
+ */
+
+void restartTimer(itimerval timer)
+{
+	if (timer.it_value.tv_sec == 0 && timer.it_value.tv_usec == 0)
+		timer.it_value = timer.it_interval;
+	setitimer(ITIMER_REAL, &timer, nullptr);
+}
+
+/**
+ * \brief Stops interval timer of the process.
+ *
+ * \return state of interval timer before it was stopped - it_value is the time left until next "tick" interrupt
+ */
+
+itimerval stopTimer()
+{
+	const itimerval stoppedTimer {};
+	itimerval timer;
+	setitimer(ITIMER_REAL, &stoppedTimer, &timer);
+	return timer;
+}
+
+/**
+ * \param [in] microseconds is the duration which will be converted, microseconds
+ *
+ * \return \a microseconds converted to timeval
+ */
+
+timeval toTimeval(const uint64_t microseconds)
+{
+	timeval value {};
+	value.tv_sec = microseconds / 1000000;
+	value.tv_usec = microseconds % 1000000;
+	return value;
+}
+
+/**
+ * \param [in] value is the duration which will be converted
+ *
+ * \return \a value converted to microseconds
+ */
+
+uint64_t toMicroseconds(const timeval& value)
+{
+	return static_cast<uint64_t>(value.tv_sec) * 1000000 + value.tv_usec;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint32_t suppressTicksAndSleep(const uint32_t ticks)
+{
+	if (ticks < 2)
+		return 0;
+
+	auto timer = stopTimer();
+
+	if (isTickPending() == true)	// "tick" interrupt is already pending?
+	{
+		restartTimer(timer);
+		return 0;
+	}
+
+	// time left in current tick - the time "lost" while the timer is stopped is not compensated; it_interval is not
+	// changed, so the timer continues with regular period after the stretched one
+	const auto currentTickTime = toMicroseconds(timer.it_value);
+	timer.it_value = toTimeval(currentTickTime + static_cast<uint64_t>(ticks - 1) * tickPeriod);
+	setitimer(ITIMER_REAL, &timer, nullptr);
+
+	waitForInterrupt();
+
+	timer = stopTimer();
+
+	if (isTickPending() == true)	// whole sleep period elapsed?
+	{
+		// pending "tick" interrupt accounts for the last tick, timer continues with regular period
+		restartTimer(timer);
+		return ticks - 1;
+	}
+
+	// sleep was interrupted before the end - tick boundaries which were not crossed yet are located every tickPeriod
+	// before the end of the stretched period, so the next one is after the remainder of time left
+	const auto leftTime = toMicroseconds(timer.it_value);
+	const auto leftTicks = (leftTime + tickPeriod - 1) / tickPeriod;
+	timer.it_value = toTimeval(leftTime - (leftTicks - 1) * tickPeriod);
+	setitimer(ITIMER_REAL, &timer, nullptr);
+	return ticks - leftTicks;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
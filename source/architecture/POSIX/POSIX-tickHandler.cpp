@@ -0,0 +1,55 @@
+/**
+ * \file
+ * \brief tickHandler() implementation for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "POSIX-interrupts.hpp"
+#include "POSIX-ThreadContext.hpp"
+
+#include "distortos/architecture/exclusiveAccess.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/requestContextSwitch.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void tickHandler(int, siginfo_t*, void* const context)
+{
+	++interruptNesting;
+
+#ifdef CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION
+
+	clearExclusive();	// exclusive monitor is cleared on each exception entry
+
+#endif	// def CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION
+
+	auto& scheduler = internal::getScheduler();
+	const auto contextSwitchRequired = scheduler.tickInterruptHandler();
+	if (contextSwitchRequired == true)
+		requestContextSwitch();
+
+	--interruptNesting;
+
+	executePendingFunctions(getThreadContext(scheduler.getCurrentThreadControlBlock()),
+			static_cast<ucontext_t*>(context)->uc_sigmask);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
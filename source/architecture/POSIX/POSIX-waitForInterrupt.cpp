@@ -0,0 +1,39 @@
+/**
+ * \file
+ * \brief waitForInterrupt() implementation for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/architecture/waitForInterrupt.hpp"
+
+#include "POSIX-interrupts.hpp"
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void waitForInterrupt()
+{
+	// the process just sleeps until the next signal, which is then raised again, so that it remains pending until
+	// interrupt masking is disabled
+	const auto interruptSignals = getInterruptSignals();
+	siginfo_t signalInformation;
+	const auto signal = sigwaitinfo(&interruptSignals, &signalInformation);
+	if (signal > 0)
+		raise(signal);
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
@@ -0,0 +1,23 @@
+#!/bin/sh
+
+#
+# file: POSIX.ld.sh
+#
+# author: Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+#
+# This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+# distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+#
+
+set -e
+set -u
+
+if [ $# -lt 1 ]; then
+	echo "This script requires at least 1 argument!" >&2
+	exit 1
+fi
+
+linker=$1
+
+# default linker script of the host, extracted from verbose output of the linker
+$linker -Wl,--verbose 2>/dev/null | sed -e '1,/^==========/d' -e '/^==========/,$d'
@@ -0,0 +1,125 @@
+/**
+ * \file
+ * \brief Emulation of exclusive access functions for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_POSIX_INCLUDE_DISTORTOS_ARCHITECTURE_EXCLUSIVEACCESS_HPP_
+#define SOURCE_ARCHITECTURE_POSIX_INCLUDE_DISTORTOS_ARCHITECTURE_EXCLUSIVEACCESS_HPP_
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <atomic>
+
+#include <cstdint>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// emulated exclusive monitor - address marked by loadExclusive(), nullptr if the monitor is clear
+extern const volatile void* volatile exclusiveMonitor;
+
+/// number of following storeExclusive() calls which will fail as if the exclusive access was lost, used by tests
+extern volatile unsigned int forcedExclusiveStoreFailures;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Clears the exclusive monitor, abandoning exclusive access started with loadExclusive().
+ */
+
+inline void clearExclusive()
+{
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	exclusiveMonitor = nullptr;
+}
+
+/**
+ * \brief Loads the value of object and marks its address for exclusive access.
+ *
+ * Emulates the local exclusive monitor of ARMv7-M - the monitor is cleared when any host signal used as an interrupt
+ * is handled, so storeExclusive() fails if an interrupt or a context switch happened after loadExclusive().
+ *
+ * \tparam T is the type of object, its size must be 4 bytes or the size of pointer
+ *
+ * \param [in] object is a reference to object which will be loaded
+ *
+ * \return value of \a object
+ */
+
+template<typename T>
+inline T loadExclusive(T& object)
+{
+	static_assert(sizeof(T) == sizeof(uint32_t) || sizeof(T) == sizeof(void*),
+			"Only 32-bit objects and pointers can be accessed exclusively!");
+
+	// the address is marked before the value is read, so an interrupt between these two steps clears the monitor
+	exclusiveMonitor = &object;
+	std::atomic_signal_fence(std::memory_order_seq_cst);
+	return *static_cast<volatile T*>(&object);
+}
+
+/**
+ * \brief Stores new value of object if the exclusive access started with loadExclusive() was not interrupted.
+ *
+ * The exclusive monitor is cleared after each store, no matter whether it succeeded or not.
+ *
+ * \tparam T is the type of object, its size must be 4 bytes or the size of pointer
+ *
+ * \param [out] object is a reference to object which will be stored
+ * \param [in] value is the new value of \a object
+ *
+ * \return true if the store succeeded, false if exclusive access was lost (or a failure was forced with
+ * forcedExclusiveStoreFailures) and the whole sequence must be repeated
+ */
+
+template<typename T>
+inline bool storeExclusive(T& object, const T value)
+{
+	static_assert(sizeof(T) == sizeof(uint32_t) || sizeof(T) == sizeof(void*),
+			"Only 32-bit objects and pointers can be accessed exclusively!");
+
+	// check of the monitor and the store must be a single step, just like the STREX instruction
+	const InterruptMaskingLock interruptMaskingLock;
+
+	const auto lost = exclusiveMonitor != &object;
+	exclusiveMonitor = nullptr;
+
+	if (lost == true)
+		return false;
+
+	if (forcedExclusiveStoreFailures != 0)
+	{
+		--forcedExclusiveStoreFailures;
+		return false;
+	}
+
+	*static_cast<volatile T*>(&object) = value;
+	return true;
+}
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// def CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION
+
+#endif	// SOURCE_ARCHITECTURE_POSIX_INCLUDE_DISTORTOS_ARCHITECTURE_EXCLUSIVEACCESS_HPP_
@@ -0,0 +1,37 @@
+/**
+ * \file
+ * \brief Architecture parameters for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef SOURCE_ARCHITECTURE_POSIX_INCLUDE_DISTORTOS_ARCHITECTURE_PARAMETERS_HPP_
+#define SOURCE_ARCHITECTURE_POSIX_INCLUDE_DISTORTOS_ARCHITECTURE_PARAMETERS_HPP_
+
+#include <csignal>
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace architecture
+{
+
+/// interrupt mask - set of blocked host signals
+using InterruptMask = sigset_t;
+
+/// alignment of stack, bytes
+constexpr size_t stackAlignment {16};
+
+/// divisibility of stack's size
+constexpr size_t stackSizeDivisibility {16};
+
+}	// namespace architecture
+
+}	// namespace distortos
+
+#endif	// SOURCE_ARCHITECTURE_POSIX_INCLUDE_DISTORTOS_ARCHITECTURE_PARAMETERS_HPP_
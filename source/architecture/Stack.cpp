@@ -11,11 +11,14 @@
 
 #include "distortos/architecture/Stack.hpp"
 
+#include "distortos/architecture/deinitializeStack.hpp"
 #include "distortos/architecture/initializeStack.hpp"
 #include "distortos/architecture/parameters.hpp"
 
 #include "distortos/internal/memory/dummyDeleter.hpp"
 
+#include <algorithm>
+
 #include <cstring>
 
 namespace distortos
@@ -27,23 +30,37 @@ namespace architecture
 namespace
 {
 
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// pattern used for painting of stack
+constexpr uint32_t stackPaintingPattern {CONFIG_STACK_PAINTING_PATTERN};
+
+#endif	// def CONFIG_STACK_PAINTING_ENABLE
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | local functions' declarations
 +---------------------------------------------------------------------------------------------------------------------*/
 
 /**
- * \brief Adjusts storage's address to suit architecture's alignment requirements.
+ * \brief Adjusts storage's address to suit architecture's alignment requirements and to leave space for stack guard.
  *
  * \param [in] storage is a pointer to stack's storage
  * \param [in] stackAlignment is required stack alignment
+ * \param [in] guardSize is the size of stack guard which should be left below adjusted storage, bytes, 0 or a power of
+ * 2, adjusted storage is aligned to this value too
  *
  * \return adjusted storage's address
  */
 
-void* adjustStorage(void* const storage, const size_t stackAlignment)
+void* adjustStorage(void* const storage, const size_t stackAlignment, const size_t guardSize)
 {
-	const auto storageSizeT = reinterpret_cast<size_t>(storage);
-	const auto offset = (-storageSizeT) & (stackAlignment - 1);
+	const auto alignment = std::max(stackAlignment, guardSize);
+	const auto storageSizeT = reinterpret_cast<size_t>(storage) + guardSize;
+	const auto offset = (-storageSizeT) & (alignment - 1);
 	return reinterpret_cast<void*>(storageSizeT + offset);
 }
 
@@ -65,7 +82,8 @@ size_t adjustSize(void* const storage, const size_t size, void* const adjustedSt
 }
 
 /**
- * \brief Proxy for initializeStack() which fills stack with 0 before actually initializing it.
+ * \brief Proxy for initializeStack() which paints the stack (or fills it with 0 if stack painting is disabled) before
+ * actually initializing it.
  *
  * \param [in] storage is a pointer to stack's storage
  * \param [in] size is the size of stack's storage, bytes
@@ -80,7 +98,11 @@ size_t adjustSize(void* const storage, const size_t size, void* const adjustedSt
 void* initializeStackProxy(void* const storage, const size_t size, Thread& thread, void (& run)(Thread&),
 		void (* preTerminationHook)(Thread&), void (& terminationHook)(Thread&))
 {
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+	std::fill_n(static_cast<uint32_t*>(storage), size / sizeof(uint32_t), stackPaintingPattern);
+#else	// !def CONFIG_STACK_PAINTING_ENABLE
 	memset(storage, 0, size);
+#endif	// !def CONFIG_STACK_PAINTING_ENABLE
 	return initializeStack(storage, size, thread, run, preTerminationHook, terminationHook);
 }
 
@@ -93,7 +115,7 @@ void* initializeStackProxy(void* const storage, const size_t size, Thread& threa
 Stack::Stack(StorageUniquePointer&& storageUniquePointer, const size_t size, Thread& thread, void (& run)(Thread&),
 		void (* preTerminationHook)(Thread&), void (& terminationHook)(Thread&)) :
 				storageUniquePointer_{std::move(storageUniquePointer)},
-				adjustedStorage_{adjustStorage(storageUniquePointer_.get(), stackAlignment)},
+				adjustedStorage_{adjustStorage(storageUniquePointer_.get(), stackAlignment, stackGuardSize)},
 				adjustedSize_{adjustSize(storageUniquePointer_.get(), size, adjustedStorage_, stackSizeDivisibility)},
 				stackPointer_{initializeStackProxy(adjustedStorage_, adjustedSize_, thread, run, preTerminationHook,
 						terminationHook)}
@@ -103,18 +125,44 @@ Stack::Stack(StorageUniquePointer&& storageUniquePointer, const size_t size, Thr
 
 Stack::Stack(void* const storage, const size_t size) :
 		storageUniquePointer_{storage, internal::dummyDeleter<void*>},
-		adjustedStorage_{storage},
-		adjustedSize_{size},
+		adjustedStorage_{adjustStorage(storage, 1, stackGuardSize)},
+		adjustedSize_{adjustSize(storage, size, adjustedStorage_, 1)},
 		stackPointer_{}
 {
 	/// \todo implement minimal size check
 }
 
+Stack::Stack(Stack&& other) :
+		storageUniquePointer_{std::move(other.storageUniquePointer_)},
+		adjustedStorage_{other.adjustedStorage_},
+		adjustedSize_{other.adjustedSize_},
+		stackPointer_{other.stackPointer_}
+{
+	other.stackPointer_ = {};
+}
+
 Stack::~Stack()
 {
+	if (stackPointer_ != nullptr)
+		deinitializeStack(stackPointer_);
+}
 
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+
+size_t Stack::getHighWaterMark() const
+{
+	const auto begin = static_cast<const uint32_t*>(adjustedStorage_);
+	const auto end = begin + adjustedSize_ / sizeof(*begin);
+	const auto used = std::find_if(begin, end,
+			[](const uint32_t word)
+			{
+				return word != stackPaintingPattern;
+			});
+	return (end - used) * sizeof(*begin);
 }
 
+#endif	// def CONFIG_STACK_PAINTING_ENABLE
+
 }	// namespace architecture
 
 }	// namespace distortos
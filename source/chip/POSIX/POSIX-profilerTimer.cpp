@@ -0,0 +1,113 @@
+/**
+ * \file
+ * \brief startProfilerTimer() and stopProfilerTimer() implementation for POSIX host
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_PROFILER_ENABLE
+
+#include "distortos/chip/startProfilerTimer.hpp"
+#include "distortos/chip/stopProfilerTimer.hpp"
+
+#include "distortos/internal/scheduler/recordProfilerSample.hpp"
+
+#include <sys/time.h>
+
+#include <cerrno>
+#include <csignal>
+
+#include <ucontext.h>
+
+namespace distortos
+{
+
+namespace chip
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// host signal used as profiler timer's interrupt, generated by profiling interval timer
+constexpr int profilerSignal {SIGPROF};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Handler of profiler timer's interrupt.
+ *
+ * This signal is not a part of host signals masked by architecture::InterruptMaskingLock, so - just like profiler
+ * timer's interrupt on a microcontroller - it also samples code executed with interrupt masking enabled.
+ *
+ * \param [in] context is a pointer to ucontext_t with host's context of interrupted code
+ */
+
+void profilerSignalHandler(int, siginfo_t*, void* const context)
+{
+	const auto& machineContext = static_cast<const ucontext_t*>(context)->uc_mcontext;
+
+#if defined(__x86_64__)
+	const auto programCounter = machineContext.gregs[REG_RIP];
+#elif defined(__i386__)
+	const auto programCounter = machineContext.gregs[REG_EIP];
+#elif defined(__aarch64__)
+	const auto programCounter = machineContext.pc;
+#elif defined(__arm__)
+	const auto programCounter = machineContext.arm_pc;
+#else
+#error "Reading of program counter from ucontext_t is not implemented for this host!"
+#endif
+
+	internal::recordProfilerSample(static_cast<uintptr_t>(programCounter));
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int startProfilerTimer(const uint32_t frequency)
+{
+	constexpr uint32_t microsecondsPerSecond {1000000};
+	if (frequency == 0 || frequency > microsecondsPerSecond)
+		return EINVAL;
+
+	struct sigaction action {};
+	action.sa_flags = SA_SIGINFO | SA_RESTART;
+	action.sa_sigaction = profilerSignalHandler;
+	sigaction(profilerSignal, &action, nullptr);
+
+	// profiling interval timer counts only time when the process is executed
+	const suseconds_t period = microsecondsPerSecond / frequency;
+	itimerval timer {};
+	timer.it_interval.tv_sec = period / microsecondsPerSecond;
+	timer.it_interval.tv_usec = period % microsecondsPerSecond;
+	timer.it_value = timer.it_interval;
+	setitimer(ITIMER_PROF, &timer, nullptr);
+	return 0;
+}
+
+void stopProfilerTimer()
+{
+	const itimerval timer {};
+	setitimer(ITIMER_PROF, &timer, nullptr);
+}
+
+}	// namespace chip
+
+}	// namespace distortos
+
+#endif	// def CONFIG_PROFILER_ENABLE
@@ -0,0 +1,25 @@
+--
+-- file: Tupfile.lua
+--
+-- author: Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+--
+-- This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+-- distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+--
+
+if CONFIG_CHIP_POSIX == "y" then
+
+	local ldScriptGenerator = DISTORTOS_TOP .. "source/architecture/POSIX/POSIX.ld.sh"
+	local ldScriptGeneratorArguments = " \"" .. LD .. "\""
+
+	local ldscriptOutputs = {LDSCRIPT, filenameToGroup(LDSCRIPT)}
+	tup.rule("^ SH " .. ldScriptGenerator .. "^ ./" .. ldScriptGenerator .. ldScriptGeneratorArguments .. " > \"%o\"",
+			ldscriptOutputs)
+
+	CXXFLAGS += STANDARD_INCLUDES
+	CXXFLAGS += ARCHITECTURE_INCLUDES
+	CXXFLAGS += CHIP_INCLUDES
+
+	tup.include(DISTORTOS_TOP .. "compile.lua")
+
+end	-- if CONFIG_CHIP_POSIX == "y" then
@@ -0,0 +1,133 @@
+/**
+ * \file
+ * \brief startProfilerTimer() and stopProfilerTimer() implementation for STM32F4
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_PROFILER_ENABLE
+
+#include "distortos/chip/startProfilerTimer.hpp"
+#include "distortos/chip/stopProfilerTimer.hpp"
+
+#include "distortos/chip/clocks.hpp"
+#include "distortos/chip/CMSIS-proxy.h"
+#include "distortos/chip/STM32F4-RCC-bits.h"
+
+#include "distortos/internal/scheduler/recordProfilerSample.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace chip
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// frequency of TIM5's clock, Hz - twice the APB1 frequency if APB1 prescaler is not 1
+constexpr uint32_t timerFrequency {CONFIG_CHIP_STM32F4_RCC_PPRE1 == 1 ? apb1Frequency : 2 * apb1Frequency};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Handler of TIM5's interrupt
+ *
+ * Clears the interrupt flag and records the sample.
+ *
+ * \param [in] programCounter is the program counter of interrupted code, read from its exception stack frame
+ */
+
+void profilerTimerInterruptHandler(const uintptr_t programCounter)
+{
+	TIM5->SR = 0;
+	internal::recordProfilerSample(programCounter);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int startProfilerTimer(const uint32_t frequency)
+{
+	if (frequency == 0 || frequency > timerFrequency)
+		return EINVAL;
+
+	RCC_APB1ENR_TIM5EN_bb = 1;
+	__DSB();
+
+	// TIM5 has 32-bit counter, so prescaler is not needed
+	TIM5->CR1 = 0;
+	TIM5->PSC = 0;
+	TIM5->ARR = timerFrequency / frequency - 1;
+	TIM5->EGR = TIM_EGR_UG;
+	TIM5->SR = 0;
+	TIM5->DIER = TIM_DIER_UIE;
+
+	// the highest priority - above CONFIG_ARCHITECTURE_ARMV7_M_KERNEL_BASEPRI - so that also code executed with
+	// interrupt masking enabled is sampled
+	NVIC_SetPriority(TIM5_IRQn, 0);
+	NVIC_ClearPendingIRQ(TIM5_IRQn);
+	NVIC_EnableIRQ(TIM5_IRQn);
+
+	TIM5->CR1 = TIM_CR1_CEN;
+	return 0;
+}
+
+void stopProfilerTimer()
+{
+	TIM5->CR1 = 0;
+	TIM5->DIER = 0;
+	NVIC_DisableIRQ(TIM5_IRQn);
+	NVIC_ClearPendingIRQ(TIM5_IRQn);
+	RCC_APB1ENR_TIM5EN_bb = 0;
+}
+
+}	// namespace chip
+
+}	// namespace distortos
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief TIM5_IRQHandler() for STM32F4, used as profiler timer's interrupt
+ *
+ * Reads the program counter of interrupted code from the exception stack frame - on process stack if a thread was
+ * interrupted or on main stack if another interrupt was interrupted - and passes it to the handler. Both standard and
+ * extended (with floating-point context) exception stack frames have stacked program counter at offset 24.
+ */
+
+extern "C" __attribute__ ((naked)) void TIM5_IRQHandler()
+{
+	asm volatile
+	(
+			"	tst			lr, #(1 << 2)					\n"	// was process stack used?
+			"	ite			eq								\n"
+			"	mrseq		r0, msp							\n"
+			"	mrsne		r0, psp							\n"
+			"	ldr			r0, [r0, #24]					\n"	// load stacked program counter
+			"	b			%[handler]						\n"	// tail call with EXC_RETURN still in lr
+
+			::	[handler] "i" (distortos::chip::profilerTimerInterruptHandler)
+	);
+}
+
+#endif	// def CONFIG_PROFILER_ENABLE
@@ -0,0 +1,38 @@
+/**
+ * \file
+ * \brief DynamicMemoryPool class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/DynamicMemoryPool.hpp"
+
+#include "distortos/internal/memory/storageDeleter.hpp"
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+DynamicMemoryPool::DynamicMemoryPool(const size_t blockSize, const size_t blocks) :
+		DynamicMemoryPool{getNewDeleteMemoryResource(), blockSize, blocks}
+{
+
+}
+
+DynamicMemoryPool::DynamicMemoryPool(MemoryResource& memoryResource, const size_t blockSize, const size_t blocks) :
+		MemoryPool{{static_cast<BitmapWord*>(internal::allocateStorage(memoryResource,
+				getBitmapWords(blocks) * sizeof(BitmapWord))), internal::storageDeleter<BitmapWord>},
+				{internal::allocateStorage(memoryResource, getAdjustedBlockSize(blockSize) * blocks),
+				internal::storageDeleter<void>}, blockSize, blocks}
+{
+
+}
+
+}	// namespace distortos
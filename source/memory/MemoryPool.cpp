@@ -0,0 +1,136 @@
+/**
+ * \file
+ * \brief MemoryPool class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/MemoryPool.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+MemoryPool::MemoryPool(BitmapStorageUniquePointer&& bitmapStorageUniquePointer,
+		StorageUniquePointer&& storageUniquePointer, const size_t blockSize, const size_t blocks) :
+		freeBlocksSemaphore_{static_cast<Semaphore::Value>(blocks), static_cast<Semaphore::Value>(blocks)},
+		bitmapStorageUniquePointer_{std::move(bitmapStorageUniquePointer)},
+		storageUniquePointer_{std::move(storageUniquePointer)},
+		freeList_{},
+		blockSize_{getAdjustedBlockSize(blockSize)},
+		blocks_{blocks},
+		usedCount_{},
+		maxUsedCount_{}
+{
+	for (size_t i {}; i < getBitmapWords(blocks_); ++i)
+		bitmapStorageUniquePointer_[i] = {};
+
+	// blocks are linked in the order of their addresses, the last one is linked first
+	const auto storage = static_cast<uint8_t*>(storageUniquePointer_.get());
+	for (size_t i {blocks_}; i > 0; --i)
+	{
+		const auto block = storage + (i - 1) * blockSize_;
+		*reinterpret_cast<void**>(block) = freeList_;
+		freeList_ = block;
+	}
+}
+
+int MemoryPool::allocate(void*& block)
+{
+	const auto ret = freeBlocksSemaphore_.wait();
+	if (ret != 0)
+		return ret;
+
+	block = takeBlock();
+	return 0;
+}
+
+int MemoryPool::free(void* const block)
+{
+	const auto storage = reinterpret_cast<uintptr_t>(storageUniquePointer_.get());
+	const auto offset = reinterpret_cast<uintptr_t>(block) - storage;
+	// block before the storage gives huge offset due to unsigned wrap-around
+	if (offset >= blockSize_ * blocks_ || offset % blockSize_ != 0)
+		return EINVAL;
+
+	const auto index = offset / blockSize_;
+	auto& bitmapWord = bitmapStorageUniquePointer_[index / bitsPerBitmapWord];
+	const auto bitMask = BitmapWord{1} << index % bitsPerBitmapWord;
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	// block which is not allocated (double free) must not be linked to the list of free blocks
+	if ((bitmapWord & bitMask) == 0)
+		return EINVAL;
+
+	const auto ret = freeBlocksSemaphore_.post();
+	if (ret != 0)
+		return ret;
+
+	bitmapWord &= ~bitMask;
+	*static_cast<void**>(block) = freeList_;
+	freeList_ = block;
+	--usedCount_;
+	return 0;
+}
+
+int MemoryPool::tryAllocate(void*& block)
+{
+	const auto ret = freeBlocksSemaphore_.tryWait();
+	if (ret != 0)
+		return ret;
+
+	block = takeBlock();
+	return 0;
+}
+
+int MemoryPool::tryAllocateFor(const TickClock::duration duration, void*& block)
+{
+	const auto ret = freeBlocksSemaphore_.tryWaitFor(duration);
+	if (ret != 0)
+		return ret;
+
+	block = takeBlock();
+	return 0;
+}
+
+int MemoryPool::tryAllocateUntil(const TickClock::time_point timePoint, void*& block)
+{
+	const auto ret = freeBlocksSemaphore_.tryWaitUntil(timePoint);
+	if (ret != 0)
+		return ret;
+
+	block = takeBlock();
+	return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void* MemoryPool::takeBlock()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto block = freeList_;
+	freeList_ = *static_cast<void**>(block);
+	const auto index = (static_cast<uint8_t*>(block) - static_cast<uint8_t*>(storageUniquePointer_.get())) / blockSize_;
+	bitmapStorageUniquePointer_[index / bitsPerBitmapWord] |= BitmapWord{1} << index % bitsPerBitmapWord;
+	++usedCount_;
+	if (usedCount_ > maxUsedCount_)
+		maxUsedCount_ = usedCount_;
+	return block;
+}
+
+}	// namespace distortos
@@ -0,0 +1,100 @@
+/**
+ * \file
+ * \brief RecyclingMemoryResource class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/RecyclingMemoryResource.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <new>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+RecyclingMemoryResource::~RecyclingMemoryResource()
+{
+	release();
+}
+
+void RecyclingMemoryResource::release()
+{
+	CachedBlock* list;
+
+	{
+		architecture::InterruptMaskingLock interruptMaskingLock;
+		list = list_;
+		list_ = {};
+		cachedBlocks_ = {};
+	}
+
+	while (list != nullptr)
+	{
+		const auto block = list;
+		list = block->next;
+		upstream_.deallocate(block, block->size, block->alignment);
+	}
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void* RecyclingMemoryResource::doAllocate(const size_t size, const size_t alignment)
+{
+	{
+		architecture::InterruptMaskingLock interruptMaskingLock;
+
+		auto previousNext = &list_;
+		while (*previousNext != nullptr)
+		{
+			const auto block = *previousNext;
+			if (block->size == size && block->alignment == alignment)
+			{
+				*previousNext = block->next;
+				--cachedBlocks_;
+				++hits_;
+				block->~CachedBlock();
+				return block;
+			}
+
+			previousNext = &block->next;
+		}
+
+		++misses_;
+	}
+
+	return upstream_.allocate(size, alignment);
+}
+
+void RecyclingMemoryResource::doDeallocate(void* const storage, const size_t size, const size_t alignment)
+{
+	if (storage == nullptr)
+		return;
+
+	if (size >= sizeof(CachedBlock) && alignment >= alignof(CachedBlock))
+	{
+		architecture::InterruptMaskingLock interruptMaskingLock;
+
+		if (cachedBlocks_ < maxCachedBlocks_)
+		{
+			list_ = new (storage) CachedBlock{list_, size, alignment};
+			++cachedBlocks_;
+			return;
+		}
+	}
+
+	upstream_.deallocate(storage, size, alignment);
+}
+
+}	// namespace distortos
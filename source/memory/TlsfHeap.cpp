@@ -0,0 +1,435 @@
+/**
+ * \file
+ * \brief TlsfHeap class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/TlsfHeap.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Block of TlsfHeap.
+ *
+ * Header of each block consists of pointer to previous physical block and size of block (with "free" flag in the least
+ * significant bit). Links of the list of free blocks are stored in the first bytes of free block, so they don't
+ * increase size of header of used block. Each region of heap ends with a used block of size 0, so the last real block
+ * of region is never merged with anything that follows it.
+ */
+
+struct TlsfHeap::Block
+{
+	/// pointer to previous physical block, nullptr for the first block of region
+	Block* previousPhysicalBlock;
+
+	/// size of block (excluding header), bytes, the least significant bit is set for free block
+	size_t sizeAndFlags;
+
+	/// pointer to next block on the list of free blocks, valid only in free block
+	Block* nextFreeBlock;
+
+	/// pointer to previous block on the list of free blocks, valid only in free block
+	Block* previousFreeBlock;
+
+	/// "free" flag in sizeAndFlags
+	constexpr static size_t freeFlag {1};
+
+	/**
+	 * \brief Converts pointer to data of block to reference to block.
+	 *
+	 * \param [in] data is a pointer to data of block
+	 *
+	 * \return reference to block
+	 */
+
+	static Block& fromData(const void* const data)
+	{
+		return *reinterpret_cast<Block*>(reinterpret_cast<uintptr_t>(data) - headerSize);
+	}
+
+	/**
+	 * \return pointer to data of block
+	 */
+
+	void* getData()
+	{
+		return reinterpret_cast<uint8_t*>(this) + headerSize;
+	}
+
+	/**
+	 * \return reference to next physical block
+	 */
+
+	Block& getNextPhysicalBlock()
+	{
+		return *reinterpret_cast<Block*>(static_cast<uint8_t*>(getData()) + getSize());
+	}
+
+	/**
+	 * \return size of block (excluding header), bytes
+	 */
+
+	size_t getSize() const
+	{
+		return sizeAndFlags & ~freeFlag;
+	}
+
+	/**
+	 * \return true if block is free, false otherwise
+	 */
+
+	bool isFree() const
+	{
+		return (sizeAndFlags & freeFlag) != 0;
+	}
+
+	/**
+	 * \param [in] free selects whether the block is free (true) or used (false)
+	 */
+
+	void setFree(const bool free)
+	{
+		sizeAndFlags = free == true ? sizeAndFlags | freeFlag : sizeAndFlags & ~freeFlag;
+	}
+
+	/**
+	 * \param [in] size is the new size of block (excluding header), bytes, "free" flag is not modified
+	 */
+
+	void setSize(const size_t size)
+	{
+		sizeAndFlags = size | (sizeAndFlags & freeFlag);
+	}
+
+	/// size of header of block, bytes
+	constexpr static size_t headerSize {2 * sizeof(void*)};
+
+	/// minimal size of block, large enough for links of the list of free blocks, bytes
+	constexpr static size_t minimalSize {2 * sizeof(void*)};
+};
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \param [in] value is the value which will be tested, must not be 0
+ *
+ * \return index of the most significant set bit in \a value
+ */
+
+int findLastSet(const size_t value)
+{
+	return std::numeric_limits<unsigned long>::digits - 1 - __builtin_clzl(value);
+}
+
+/**
+ * \param [in] value is the value which will be tested, must not be 0
+ *
+ * \return index of the least significant set bit in \a value
+ */
+
+int findFirstSet(const uint32_t value)
+{
+	return __builtin_ctz(value);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool TlsfHeap::addRegion(void* const begin, const size_t size)
+{
+	const auto beginAddress = reinterpret_cast<uintptr_t>(begin);
+	const auto alignedBegin = (beginAddress + alignment - 1) / alignment * alignment;
+	const auto alignedEnd = (beginAddress + size) / alignment * alignment;
+	if (alignedEnd < alignedBegin || alignedEnd - alignedBegin < 2 * Block::headerSize + Block::minimalSize)
+		return false;
+
+	// size of single block is limited by the number of first level lists
+	constexpr size_t maxBlockSize {(size_t{1} << firstLevelMax) - alignment};
+	const auto blockSize = std::min(alignedEnd - alignedBegin - 2 * Block::headerSize, maxBlockSize);
+
+	auto& block = *reinterpret_cast<Block*>(alignedBegin);
+	block.previousPhysicalBlock = {};
+	block.sizeAndFlags = blockSize;
+	auto& endBlock = block.getNextPhysicalBlock();
+	endBlock.previousPhysicalBlock = &block;
+	endBlock.sizeAndFlags = 0;
+
+	totalSize_ += blockSize;
+	insertFreeBlock(block);
+	return true;
+}
+
+void* TlsfHeap::allocate(const size_t size)
+{
+	const auto adjustedSize = adjustSize(size);
+	if (adjustedSize == 0)
+		return {};
+
+	const auto block = takeFreeBlock(adjustedSize);
+	if (block == nullptr)
+		return {};
+
+	trimBlock(*block, adjustedSize);
+	++usedBlocks_;
+	updateMaxUsedSize();
+	return block->getData();
+}
+
+void* TlsfHeap::allocateAligned(const size_t blockAlignment, const size_t size)
+{
+	if (blockAlignment == 0 || (blockAlignment & (blockAlignment - 1)) != 0)
+		return {};
+
+	if (blockAlignment <= alignment)
+		return allocate(size);
+
+	const auto adjustedSize = adjustSize(size);
+	// after alignment the gap before the block must be large enough to hold another block
+	constexpr auto minimalGap = Block::headerSize + Block::minimalSize;
+	const auto searchedSize = adjustSize(adjustedSize + blockAlignment + minimalGap);
+	if (adjustedSize == 0 || searchedSize == 0)
+		return {};
+
+	auto block = takeFreeBlock(searchedSize);
+	if (block == nullptr)
+		return {};
+
+	const auto data = reinterpret_cast<uintptr_t>(block->getData());
+	if (data % blockAlignment != 0)
+	{
+		const auto alignedData = (data + minimalGap + blockAlignment - 1) / blockAlignment * blockAlignment;
+		const auto gap = alignedData - data;
+		auto& alignedBlock = Block::fromData(reinterpret_cast<void*>(alignedData));
+		alignedBlock.previousPhysicalBlock = block;
+		alignedBlock.sizeAndFlags = block->getSize() - gap;
+		alignedBlock.getNextPhysicalBlock().previousPhysicalBlock = &alignedBlock;
+		block->setSize(gap - Block::headerSize);
+		mergeAndInsertFreeBlock(*block);
+		block = &alignedBlock;
+	}
+
+	trimBlock(*block, adjustedSize);
+	++usedBlocks_;
+	updateMaxUsedSize();
+	return block->getData();
+}
+
+void TlsfHeap::deallocate(void* const block)
+{
+	if (block == nullptr)
+		return;
+
+	--usedBlocks_;
+	mergeAndInsertFreeBlock(Block::fromData(block));
+}
+
+TlsfHeap::Statistics TlsfHeap::getStatistics() const
+{
+	size_t largestFreeBlockSize {};
+	if (firstLevelBitmap_ != 0)
+	{
+		// the largest free block is on the last non-empty list, but it is not necessarily the first block there
+		const auto firstLevel = findLastSet(firstLevelBitmap_);
+		const auto secondLevel = findLastSet(secondLevelBitmaps_[firstLevel]);
+		for (auto block = lists_[firstLevel][secondLevel]; block != nullptr; block = block->nextFreeBlock)
+			largestFreeBlockSize = std::max(largestFreeBlockSize, block->getSize());
+	}
+
+	return {totalSize_, freeSize_, largestFreeBlockSize, maxUsedSize_, freeBlocks_, usedBlocks_};
+}
+
+size_t TlsfHeap::getUsableSize(const void* const block)
+{
+	return Block::fromData(block).getSize();
+}
+
+bool TlsfHeap::resize(void* const block, const size_t size)
+{
+	const auto adjustedSize = adjustSize(size);
+	if (adjustedSize == 0)
+		return false;
+
+	auto& resizedBlock = Block::fromData(block);
+	const auto currentSize = resizedBlock.getSize();
+	if (adjustedSize > currentSize)
+	{
+		auto& nextBlock = resizedBlock.getNextPhysicalBlock();
+		if (nextBlock.isFree() == false || currentSize + Block::headerSize + nextBlock.getSize() < adjustedSize)
+			return false;
+
+		removeFreeBlock(nextBlock);
+		resizedBlock.setSize(currentSize + Block::headerSize + nextBlock.getSize());
+		resizedBlock.getNextPhysicalBlock().previousPhysicalBlock = &resizedBlock;
+	}
+
+	trimBlock(resizedBlock, adjustedSize);
+	updateMaxUsedSize();
+	return true;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private static functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+size_t TlsfHeap::adjustSize(const size_t size)
+{
+	constexpr size_t maxSize {(size_t{1} << firstLevelMax) - alignment};
+	if (size > maxSize)
+		return 0;
+
+	return std::max((size + alignment - 1) / alignment * alignment, size_t{Block::minimalSize});
+}
+
+std::pair<size_t, size_t> TlsfHeap::mapInsert(const size_t size)
+{
+	if (size < (size_t{1} << firstLevelShift))
+		return {0, size >> alignmentLog2};
+
+	const auto lastSet = findLastSet(size);
+	return {lastSet - firstLevelShift + 1, (size >> (lastSet - secondLevelLog2)) ^ secondLevelCount};
+}
+
+std::pair<size_t, size_t> TlsfHeap::mapSearch(const size_t size)
+{
+	if (size < (size_t{1} << firstLevelShift))
+		return mapInsert(size);
+
+	// round up to the next list, so that any block found there is large enough
+	return mapInsert(size + (size_t{1} << (findLastSet(size) - secondLevelLog2)) - 1);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void TlsfHeap::insertFreeBlock(Block& block)
+{
+	const auto size = block.getSize();
+	const auto indexes = mapInsert(size);
+	auto& head = lists_[indexes.first][indexes.second];
+
+	block.setFree(true);
+	block.previousFreeBlock = {};
+	block.nextFreeBlock = head;
+	if (head != nullptr)
+		head->previousFreeBlock = &block;
+	head = &block;
+
+	secondLevelBitmaps_[indexes.first] |= uint32_t{1} << indexes.second;
+	firstLevelBitmap_ |= uint32_t{1} << indexes.first;
+	freeSize_ += size;
+	++freeBlocks_;
+}
+
+void TlsfHeap::mergeAndInsertFreeBlock(Block& block)
+{
+	auto mergedBlock = &block;
+
+	const auto previousBlock = mergedBlock->previousPhysicalBlock;
+	if (previousBlock != nullptr && previousBlock->isFree() == true)
+	{
+		removeFreeBlock(*previousBlock);
+		previousBlock->setSize(previousBlock->getSize() + Block::headerSize + mergedBlock->getSize());
+		mergedBlock = previousBlock;
+		mergedBlock->getNextPhysicalBlock().previousPhysicalBlock = mergedBlock;
+	}
+
+	auto& nextBlock = mergedBlock->getNextPhysicalBlock();
+	if (nextBlock.isFree() == true)
+	{
+		removeFreeBlock(nextBlock);
+		mergedBlock->setSize(mergedBlock->getSize() + Block::headerSize + nextBlock.getSize());
+		mergedBlock->getNextPhysicalBlock().previousPhysicalBlock = mergedBlock;
+	}
+
+	insertFreeBlock(*mergedBlock);
+}
+
+void TlsfHeap::removeFreeBlock(Block& block)
+{
+	const auto size = block.getSize();
+	const auto indexes = mapInsert(size);
+	auto& head = lists_[indexes.first][indexes.second];
+
+	if (block.previousFreeBlock != nullptr)
+		block.previousFreeBlock->nextFreeBlock = block.nextFreeBlock;
+	if (block.nextFreeBlock != nullptr)
+		block.nextFreeBlock->previousFreeBlock = block.previousFreeBlock;
+	if (head == &block)
+		head = block.nextFreeBlock;
+
+	if (head == nullptr)
+	{
+		secondLevelBitmaps_[indexes.first] &= ~(uint32_t{1} << indexes.second);
+		if (secondLevelBitmaps_[indexes.first] == 0)
+			firstLevelBitmap_ &= ~(uint32_t{1} << indexes.first);
+	}
+
+	block.setFree(false);
+	freeSize_ -= size;
+	--freeBlocks_;
+}
+
+TlsfHeap::Block* TlsfHeap::takeFreeBlock(const size_t size)
+{
+	auto indexes = mapSearch(size);
+	if (indexes.first >= firstLevelCount)
+		return {};
+
+	auto secondLevelBitmap = secondLevelBitmaps_[indexes.first] & (~uint32_t{} << indexes.second);
+	if (secondLevelBitmap == 0)
+	{
+		const auto firstLevelBitmap = firstLevelBitmap_ & (~uint32_t{} << (indexes.first + 1));
+		if (firstLevelBitmap == 0)
+			return {};
+
+		indexes.first = findFirstSet(firstLevelBitmap);
+		secondLevelBitmap = secondLevelBitmaps_[indexes.first];
+	}
+
+	indexes.second = findFirstSet(secondLevelBitmap);
+	const auto block = lists_[indexes.first][indexes.second];
+	removeFreeBlock(*block);
+	return block;
+}
+
+void TlsfHeap::trimBlock(Block& block, const size_t size)
+{
+	if (block.getSize() < size + Block::headerSize + Block::minimalSize)
+		return;
+
+	auto& tailBlock = *reinterpret_cast<Block*>(static_cast<uint8_t*>(block.getData()) + size);
+	tailBlock.previousPhysicalBlock = &block;
+	tailBlock.sizeAndFlags = block.getSize() - size - Block::headerSize;
+	tailBlock.getNextPhysicalBlock().previousPhysicalBlock = &tailBlock;
+	block.setSize(size);
+	mergeAndInsertFreeBlock(tailBlock);
+}
+
+void TlsfHeap::updateMaxUsedSize()
+{
+	maxUsedSize_ = std::max(maxUsedSize_, totalSize_ - freeSize_);
+}
+
+}	// namespace distortos
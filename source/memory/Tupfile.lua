@@ -8,5 +8,6 @@
 --
 
 CXXFLAGS += STANDARD_INCLUDES
+CXXFLAGS += ARCHITECTURE_INCLUDES
 
 tup.include(DISTORTOS_TOP .. "compile.lua")
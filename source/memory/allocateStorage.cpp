@@ -0,0 +1,93 @@
+/**
+ * \file
+ * \brief allocateStorage() and deallocateStorage() definitions
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/memory/allocateStorage.hpp"
+
+#include "distortos/MemoryResource.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// header placed directly before storage
+struct StorageHeader
+{
+	/// pointer to memory resource from which the storage was allocated
+	MemoryResource* memoryResource;
+
+	/// total size of allocation (including header), bytes
+	size_t size;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// alignment of all allocations, bytes
+constexpr size_t alignment {alignof(std::max_align_t)};
+
+/// offset of storage from the beginning of allocation, bytes
+constexpr size_t storageOffset {(sizeof(StorageHeader) + alignment - 1) / alignment * alignment};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \param [in] storage is a pointer to storage allocated with allocateStorage()
+ *
+ * \return reference to header of \a storage
+ */
+
+StorageHeader& getStorageHeader(void* const storage)
+{
+	return *(static_cast<StorageHeader*>(storage) - 1);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void* allocateStorage(MemoryResource& memoryResource, const size_t size)
+{
+	const auto allocationSize = storageOffset + size;
+	const auto allocation = memoryResource.allocate(allocationSize, alignment);
+	if (allocation == nullptr)
+		abort();
+
+	const auto storage = static_cast<uint8_t*>(allocation) + storageOffset;
+	getStorageHeader(storage) = {&memoryResource, allocationSize};
+	return storage;
+}
+
+void deallocateStorage(void* const storage)
+{
+	const auto header = getStorageHeader(storage);
+	header.memoryResource->deallocate(static_cast<uint8_t*>(storage) - storageOffset, header.size, alignment);
+}
+
+}	// namespace internal
+
+}	// namespace distortos
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief getMallocHeap() definition
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/memory/getMallocHeap.hpp"
+
+#ifdef CONFIG_TLSF_HEAP_ENABLE
+
+#include "distortos/TlsfHeap.hpp"
+
+namespace distortos
+{
+
+namespace internal
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// storage for main instance of TlsfHeap used by malloc() and free()
+std::aligned_storage<sizeof(TlsfHeap), alignof(TlsfHeap)>::type mallocHeapInstanceStorage;
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+TlsfHeap& getMallocHeap()
+{
+	return reinterpret_cast<TlsfHeap&>(mallocHeapInstanceStorage);
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// def CONFIG_TLSF_HEAP_ENABLE
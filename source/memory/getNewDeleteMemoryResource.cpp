@@ -0,0 +1,79 @@
+/**
+ * \file
+ * \brief getNewDeleteMemoryResource() definition
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/MemoryResource.hpp"
+
+#include <new>
+
+namespace distortos
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// NewDeleteMemoryResource class is a MemoryResource which uses global operator new and operator delete
+class NewDeleteMemoryResource : public MemoryResource
+{
+private:
+
+	/**
+	 * \brief Allocates storage with global operator new.
+	 *
+	 * \param [in] size is the size of requested storage, bytes
+	 * \param [in] alignment is the required alignment of storage, bytes, a power of 2
+	 *
+	 * \return pointer to allocated storage, nullptr if storage could not be allocated or \a alignment is greater than
+	 * alignof(std::max_align_t)
+	 */
+
+	void* doAllocate(const size_t size, const size_t alignment) override
+	{
+		if (alignment > alignof(std::max_align_t))
+			return {};
+
+		return ::operator new(size, std::nothrow);
+	}
+
+	/**
+	 * \brief Returns storage with global operator delete.
+	 *
+	 * \param [in] storage is a pointer to storage previously allocated from this resource
+	 */
+
+	void doDeallocate(void* const storage, size_t, size_t) override
+	{
+		::operator delete(storage);
+	}
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// main instance of NewDeleteMemoryResource
+NewDeleteMemoryResource newDeleteMemoryResource;
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+MemoryResource& getNewDeleteMemoryResource()
+{
+	return newDeleteMemoryResource;
+}
+
+}	// namespace distortos
@@ -0,0 +1,153 @@
+/**
+ * \file
+ * \brief RunnableThreadList class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/scheduler/RunnableThreadList.hpp"
+
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
+#include <algorithm>
+
+namespace distortos
+{
+
+namespace internal
+{
+
+#ifdef CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+auto RunnableThreadList::erase(const iterator position) -> iterator
+{
+	return unlink(position, position->getEffectivePriority());
+}
+
+auto RunnableThreadList::insert(reference newElement) -> iterator
+{
+	return link(newElement, newElement.getEffectivePriority(), false);
+}
+
+void RunnableThreadList::reposition(const iterator position, const uint8_t previousEffectivePriority,
+		const bool loweringBefore)
+{
+	unlink(position, previousEffectivePriority);
+	link(*position, position->getEffectivePriority(), loweringBefore);
+}
+
+void RunnableThreadList::rotate(const iterator position)
+{
+	const auto priority = position->getEffectivePriority();
+	auto& lastElement = lastElements_[priority];
+	if (lastElement == position)	// already at the end of its group?
+		return;
+
+	UnsortedIntrusiveList::splice(std::next(lastElement), position);
+	lastElement = position;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<bool, uint8_t> RunnableThreadList::findPriority(size_t priority) const
+{
+	auto mask = ~BitmapWord{} >> (priority % bitsPerBitmapWord);
+	for (auto index = priority / bitsPerBitmapWord; index < bitmap_.size(); ++index)
+	{
+		const auto word = bitmap_[index] & mask;
+		if (word != 0)
+			return {true, static_cast<uint8_t>(index * bitsPerBitmapWord + __builtin_clz(word))};
+
+		mask = ~BitmapWord{};
+	}
+
+	return {false, {}};
+}
+
+auto RunnableThreadList::link(reference element, const uint8_t priority, const bool atHead) -> iterator
+{
+	// element must be linked after the last element of the closest group of higher priority, or after the last
+	// element of its own group if it should be placed at the tail of that group
+	const auto found = findPriority(atHead == false ? priority : priority + 1);
+	const auto position = found.first == true ? std::next(lastElements_[found.second]) : begin();
+	const auto linkedElement = UnsortedIntrusiveList::insert(position, element);
+
+	const auto bitMask = getBitMask(priority);
+	auto& bitmapWord = bitmap_[priority / bitsPerBitmapWord];
+	if (atHead == false || (bitmapWord & bitMask) == 0)
+		lastElements_[priority] = linkedElement;
+	bitmapWord |= bitMask;
+
+	return linkedElement;
+}
+
+auto RunnableThreadList::unlink(const iterator position, const uint8_t priority) -> iterator
+{
+	auto& lastElement = lastElements_[priority];
+	if (lastElement == position)
+	{
+		const auto previous = std::prev(position);
+		if (previous != end() && previous->getEffectivePriority() == priority)
+			lastElement = previous;
+		else
+			clearBit(priority);
+	}
+
+	return UnsortedIntrusiveList::erase(position);
+}
+
+#else	// !def CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+auto RunnableThreadList::erase(const iterator position) -> iterator
+{
+	return ThreadList::erase(position);
+}
+
+auto RunnableThreadList::insert(reference newElement) -> iterator
+{
+	return ThreadList::insert(newElement);
+}
+
+void RunnableThreadList::reposition(const iterator position, uint8_t, const bool loweringBefore)
+{
+	if (loweringBefore == false)
+	{
+		ThreadList::splice(position);
+		return;
+	}
+
+	// thread is moved to the head of the group of threads with the new priority
+	const auto priority = position->getEffectivePriority();
+	UnsortedIntrusiveList::erase(position);
+	const auto insertPosition = std::find_if(begin(), end(),
+			[priority](const ThreadControlBlock& threadControlBlock) -> bool
+			{
+				return threadControlBlock.getEffectivePriority() <= priority;
+			});
+	UnsortedIntrusiveList::insert(insertPosition, *position);
+}
+
+void RunnableThreadList::rotate(const iterator position)
+{
+	ThreadList::splice(position);
+}
+
+#endif	// !def CONFIG_SCHEDULER_PRIORITY_BITMAP_ENABLE
+
+}	// namespace internal
+
+}	// namespace distortos
@@ -11,14 +11,21 @@
 
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
+#include "distortos/idle.hpp"
 #include "distortos/StaticSoftwareTimer.hpp"
 
+#include "distortos/architecture/getRunTimeCounter.hpp"
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 #include "distortos/architecture/requestContextSwitch.hpp"
+#include "distortos/architecture/suppressTicksAndSleep.hpp"
+#include "distortos/architecture/waitForInterrupt.hpp"
 
 #include "distortos/internal/scheduler/forceContextSwitch.hpp"
+#include "distortos/internal/scheduler/getIdleThread.hpp"
 #include "distortos/internal/scheduler/MainThread.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
 
+#include <algorithm>
 #include <cerrno>
 
 namespace distortos
@@ -81,6 +88,52 @@ private:
 	ThreadControlBlock::UnblockReason& unblockReason_;
 };
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/**
+ * \brief TimeoutSoftwareTimer class is a software timer used to implement timeouts of blocking functions, its function
+ * is always executed in "tick" interrupt
+ *
+ * \tparam Function is the type of function executed by the timer
+ */
+
+template<typename Function>
+class TimeoutSoftwareTimer : public SoftwareTimerCommon
+{
+public:
+
+	/**
+	 * \brief TimeoutSoftwareTimer's constructor
+	 *
+	 * \param [in] function is a reference to function executed by the timer
+	 */
+
+	constexpr explicit TimeoutSoftwareTimer(const Function& function) :
+			SoftwareTimerCommon{true},
+			function_{function}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief "Run" function of software timer
+	 *
+	 * Executes function of the timer.
+	 */
+
+	void run() override
+	{
+		function_();
+	}
+
+	/// function executed by the timer
+	Function function_;
+};
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -152,28 +205,115 @@ int Scheduler::blockUntil(ThreadList& container, const ThreadState state, const
 	// This lambda unblocks the thread only if it wasn't already unblocked - this is necessary because double unblock
 	// should be avoided (it could mess the order of threads of the same priority). In that case it also sets
 	// UnblockReason::timeout.
-	auto softwareTimer = makeStaticSoftwareTimer([this, iterator]()
+	const auto function = [this, iterator]()
 			{
 				if (iterator->getList() != &runnableList_)
 					unblockInternal(iterator, ThreadControlBlock::UnblockReason::timeout);
-			});
+			};
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	// timeouts are handled in "tick" interrupt, not in software timer thread
+	TimeoutSoftwareTimer<decltype(function)> softwareTimer {function};
+
+#else	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	auto softwareTimer = makeStaticSoftwareTimer(function);
+
+#endif	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 	softwareTimer.start(timePoint);
 
 	return block(container, state, unblockFunctor);
 }
 
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+void Scheduler::enterInterrupt()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	updateRunTime();
+	++interruptNesting_;
+}
+
+void Scheduler::exitInterrupt()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	updateRunTime();
+	--interruptNesting_;
+}
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
 uint64_t Scheduler::getContextSwitchCount() const
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 	return contextSwitchCount_;
 }
 
+uint64_t Scheduler::getIdleTickCount() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	return idleTickCount_;
+}
+
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+uint64_t Scheduler::getInterruptRunTime()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	updateRunTime();
+	return interruptRunTime_;
+}
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
 uint64_t Scheduler::getTickCount() const
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 	return tickCount_;
 }
 
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+uint64_t Scheduler::getTotalRunTime()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	updateRunTime();
+	return totalRunTime_;
+}
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+void Scheduler::idle()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (std::next(runnableList_.begin()) != runnableList_.end())	// idle thread is not the only runnable thread?
+		return;
+
+	const auto now = TickClock::time_point{TickClock::duration{tickCount_}};
+	const auto sleepDuration = softwareTimerSupervisor_.getNextTimePoint() - now;
+	uint32_t suppressedTicks {};
+
+	if (idle::hook != nullptr)
+		suppressedTicks = idle::hook(sleepDuration);
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+	else if (sleepDuration > TickClock::duration{1})
+		suppressedTicks = architecture::suppressTicksAndSleep(std::min<TickClock::rep>(sleepDuration.count(),
+				UINT32_MAX));
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+	else
+		architecture::waitForInterrupt();
+
+	tickCount_ += suppressedTicks;
+	idleTickCount_ += suppressedTicks;
+}
+
 int Scheduler::initialize(MainThread& mainThread)
 {
 	const auto ret = addInternal(mainThread.getThreadControlBlock());
@@ -182,6 +322,10 @@ int Scheduler::initialize(MainThread& mainThread)
 
 	currentThreadControlBlock_ = runnableList_.begin();
 
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+	runTimeCounter_ = architecture::getRunTimeCounter();
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
 	return 0;
 }
 
@@ -227,8 +371,12 @@ int Scheduler::suspend(const ThreadList::iterator iterator)
 void* Scheduler::switchContext(void* const stackPointer)
 {
 	++contextSwitchCount_;
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+	updateRunTime();
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
 	getCurrentThreadControlBlock().getStack().setStackPointer(stackPointer);
 	currentThreadControlBlock_ = runnableList_.begin();
+	traceEvent(trace::EventType::contextSwitch, &getCurrentThreadControlBlock().getOwner());
 	getCurrentThreadControlBlock().switchedToHook();
 	return getCurrentThreadControlBlock().getStack().getStackPointer();
 }
@@ -239,6 +387,16 @@ bool Scheduler::tickInterruptHandler()
 
 	++tickCount_;
 
+	if (&getCurrentThreadControlBlock().getOwner() == &getIdleThread())
+		++idleTickCount_;
+
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+	// tick count must be incremented before, as it may be used by architecture::getRunTimeCounter()
+	enterInterrupt();
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	traceEvent(trace::EventType::interruptEnter, trace::tickInterruptIdentifier);
+
 	getCurrentThreadControlBlock().getRoundRobinQuantum().decrement();
 
 	// if the object is on the "runnable" list, it uses SchedulingPolicy::roundRobin and it used its round-robin
@@ -249,11 +407,17 @@ bool Scheduler::tickInterruptHandler()
 			getCurrentThreadControlBlock().getRoundRobinQuantum().isZero() == true)
 	{
 		getCurrentThreadControlBlock().getRoundRobinQuantum().reset();
-		runnableList_.splice(currentThreadControlBlock_);
+		runnableList_.rotate(currentThreadControlBlock_);
 	}
 
 	softwareTimerSupervisor_.tickInterruptHandler(TickClock::time_point{TickClock::duration{tickCount_}});
 
+	traceEvent(trace::EventType::interruptExit, trace::tickInterruptIdentifier);
+
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+	exitInterrupt();
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
 	return isContextSwitchRequired();
 }
 
@@ -265,11 +429,37 @@ void Scheduler::unblock(const ThreadList::iterator iterator, const ThreadControl
 	maybeRequestContextSwitch();
 }
 
+void Scheduler::unblockAll(ThreadList& container, const ThreadControlBlock::UnblockReason unblockReason)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	while (container.empty() == false)
+		unblockInternal(container.begin(), unblockReason);
+	maybeRequestContextSwitch();
+}
+
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+void Scheduler::updateRunTime()
+{
+	const auto runTimeCounter = architecture::getRunTimeCounter();
+	const uint32_t runTime = runTimeCounter - runTimeCounter_;
+	runTimeCounter_ = runTimeCounter;
+
+	totalRunTime_ += runTime;
+	if (interruptNesting_ != 0)
+		interruptRunTime_ += runTime;
+	else
+		getCurrentThreadControlBlock().addRunTime(runTime);
+}
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
 void Scheduler::yield()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
-	runnableList_.splice(currentThreadControlBlock_);
+	runnableList_.rotate(currentThreadControlBlock_);
 	maybeRequestContextSwitch();
 }
 
@@ -298,10 +488,12 @@ int Scheduler::blockInternal(ThreadList& container, const ThreadList::iterator i
 	if (threadControlBlock.getList() != &runnableList_)
 		return EINVAL;
 
-	container.splice(iterator);
+	runnableList_.erase(iterator);
+	container.insert(threadControlBlock);
 	threadControlBlock.setList(&container);
 	threadControlBlock.setState(state);
 	threadControlBlock.blockHook(unblockFunctor);
+	traceEvent(trace::EventType::threadBlock, &threadControlBlock.getOwner(), static_cast<uint8_t>(state));
 
 	return 0;
 }
@@ -325,6 +517,7 @@ void Scheduler::unblockInternal(const ThreadList::iterator iterator,
 	threadControlBlock.setList(&runnableList_);
 	threadControlBlock.setState(ThreadState::runnable);
 	threadControlBlock.unblockHook(unblockReason);
+	traceEvent(trace::EventType::threadUnblock, &threadControlBlock.getOwner(), static_cast<uint8_t>(unblockReason));
 }
 
 }	// namespace internal
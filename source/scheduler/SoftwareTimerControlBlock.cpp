@@ -13,8 +13,10 @@
 
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
 
 #include "distortos/architecture/InterruptMaskingLock.hpp"
+#include "distortos/architecture/InterruptUnmaskingLock.hpp"
 
 namespace distortos
 {
@@ -28,15 +30,37 @@ namespace internal
 
 void SoftwareTimerControlBlock::run(SoftwareTimerSupervisor& supervisor)
 {
-	functionRunner_(owner_);
+	traceEvent(trace::EventType::softwareTimerExpiry, &owner_);
 
-	// was timer restarted in timer's function or is this a one-shot timer?
-	if (isRunning() == true || period_ == decltype(period_){})
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	if (tickInterrupt_ == false)	// function of this timer is executed in software timer thread?
+	{
+		supervisor.defer(*this);
 		return;
+	}
 
-	startInternal(supervisor, getTimePoint() + period_);	// this is a periodic timer, so restart it
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	functionRunner_(owner_);
+	restart(supervisor);
 }
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+void SoftwareTimerControlBlock::runDeferred(SoftwareTimerSupervisor& supervisor)
+{
+	{
+		architecture::InterruptUnmaskingLock interruptUnmaskingLock;
+
+		functionRunner_(owner_);
+	}
+
+	restart(supervisor);
+}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 void SoftwareTimerControlBlock::start(SoftwareTimerSupervisor& supervisor, const TickClock::time_point timePoint,
 		const TickClock::duration period)
 {
@@ -58,6 +82,15 @@ void SoftwareTimerControlBlock::stop()
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+void SoftwareTimerControlBlock::restart(SoftwareTimerSupervisor& supervisor)
+{
+	// was timer restarted in timer's function or is this a one-shot timer?
+	if (isRunning() == true || period_ == decltype(period_){})
+		return;
+
+	startInternal(supervisor, getTimePoint() + period_);	// this is a periodic timer, so restart it
+}
+
 void SoftwareTimerControlBlock::startInternal(SoftwareTimerSupervisor& supervisor,
 		const TickClock::time_point timePoint)
 {
@@ -67,11 +100,24 @@ void SoftwareTimerControlBlock::startInternal(SoftwareTimerSupervisor& superviso
 
 void SoftwareTimerControlBlock::stopInternal()
 {
+	// period is cleared even if the timer is not running, so periodic timer stopped during execution of its function
+	// will not be restarted
+	period_ = {};
+
 	if (isRunning() == false)	// timer is already stopped?
 		return;
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	if (deferred_ == true)	// expired timer waits for execution by software timer thread?
+	{
+		getScheduler().getSoftwareTimerSupervisor().cancelDeferred(*this);
+		return;
+	}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 	node.unlink();
-	period_ = {};
 }
 
 }	// namespace internal
@@ -15,12 +15,129 @@
 
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 
+#include <algorithm>
+
 namespace distortos
 {
 
 namespace internal
 {
 
+#ifdef CONFIG_SOFTWARE_TIMER_TIMING_WHEEL
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \param [in] tick is the tick which will be checked
+ * \param [in] bits is the number of least significant bits which will be checked
+ *
+ * \return true if \a bits least significant bits of \a tick are all zero, false otherwise
+ */
+
+constexpr bool isAligned(const TickClock::rep tick, const size_t bits)
+{
+	return (tick & ((TickClock::rep{1} << bits) - 1)) == 0;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void SoftwareTimerSupervisor::add(SoftwareTimerControlBlock& softwareTimerControlBlock)
+{
+	// software timer with expiration time point which is not in the future will be executed in next tick
+	const auto tick = softwareTimerControlBlock.getTimePoint().time_since_epoch().count();
+	// software timers started earlier are closer to the front of the slot
+	getSlot(std::max(tick, currentTick_ + 1)).push_back(softwareTimerControlBlock);
+}
+
+TickClock::time_point SoftwareTimerSupervisor::getNextTimePoint() const
+{
+	auto nextTimePoint = TickClock::time_point::max();
+	for (size_t level {}; level < levels; ++level)
+	{
+		const auto shift = slotBits * level;
+		const auto currentBlock = currentTick_ >> shift;
+		// slots of this and all higher levels begin later than the time point that was already found?
+		if (TickClock::time_point{TickClock::duration{(currentBlock + 1) << shift}} >= nextTimePoint)
+			break;
+
+		for (auto block = currentBlock + 1; block <= currentBlock + slotsPerLevel; ++block)
+			if (wheel_[level][block % slotsPerLevel].empty() == false)
+			{
+				nextTimePoint = std::min(nextTimePoint, TickClock::time_point{TickClock::duration{block << shift}});
+				break;
+			}
+	}
+
+	return nextTimePoint;
+}
+
+void SoftwareTimerSupervisor::tickInterruptHandler(const TickClock::time_point timePoint)
+{
+	// handle all ticks up to given time point - there may be more than one if "tick" interrupts were suppressed
+	while (currentTick_ < timePoint.time_since_epoch().count())
+	{
+		++currentTick_;
+
+		// cascade all levels with slot beginning at current tick - if a level has such slot, all lower levels also
+		// have it; lower levels are cascaded first, so that software timers from higher levels - which were started
+		// earlier - are moved in front of them
+		for (size_t level {1}; level < levels && isAligned(currentTick_, slotBits * level) == true; ++level)
+			cascade(level);
+
+		// execute all software timers from current slot of level 0 - they all reached their time point
+		auto& slot = wheel_[0][currentTick_ % slotsPerLevel];
+		while (slot.empty() == false)
+		{
+			auto& softwareTimer = slot.front();
+			slot.pop_front();
+			softwareTimer.run(*this);
+		}
+	}
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void SoftwareTimerSupervisor::cascade(const size_t level)
+{
+	// slot is emptied first, as software timers expiring after the range of all levels are linked back to it
+	Slot slot;
+	slot.swap(wheel_[level][(currentTick_ >> (slotBits * level)) % slotsPerLevel]);
+	// software timers with the same expiration time point are executed in the order in which they were started - all
+	// software timers from this slot were started before the ones which are already in the lower levels, so they are
+	// moved to the front of their new slots, starting from the back of this slot to preserve their relative order
+	while (slot.empty() == false)
+	{
+		auto& softwareTimer = slot.back();
+		slot.pop_back();
+		getSlot(softwareTimer.getTimePoint().time_since_epoch().count()).push_front(softwareTimer);
+	}
+}
+
+SoftwareTimerSupervisor::Slot& SoftwareTimerSupervisor::getSlot(const TickClock::rep tick)
+{
+	// select the lowest level which can hold this delay, software timers with longer delays are linked in the highest
+	// level and will be moved again when the range of their slot begins
+	const auto delay = tick - currentTick_;
+	size_t level {};
+	while (level + 1 < levels && (delay >> (slotBits * (level + 1))) != 0)
+		++level;
+
+	return wheel_[level][(tick >> (slotBits * level)) % slotsPerLevel];
+}
+
+#else	// !def CONFIG_SOFTWARE_TIMER_TIMING_WHEEL
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -30,6 +147,11 @@ void SoftwareTimerSupervisor::add(SoftwareTimerControlBlock& softwareTimerContro
 	activeList_.insert(softwareTimerControlBlock);
 }
 
+TickClock::time_point SoftwareTimerSupervisor::getNextTimePoint() const
+{
+	return activeList_.empty() == false ? activeList_.begin()->getTimePoint() : TickClock::time_point::max();
+}
+
 void SoftwareTimerSupervisor::tickInterruptHandler(const TickClock::time_point timePoint)
 {
 	// execute all software timers that reached their time point
@@ -42,6 +164,48 @@ void SoftwareTimerSupervisor::tickInterruptHandler(const TickClock::time_point t
 	}
 }
 
+#endif	// !def CONFIG_SOFTWARE_TIMER_TIMING_WHEEL
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void SoftwareTimerSupervisor::cancelDeferred(SoftwareTimerControlBlock& softwareTimerControlBlock)
+{
+	softwareTimerControlBlock.node.unlink();
+	softwareTimerControlBlock.setDeferred(false);
+	--deferredCount_;
+}
+
+void SoftwareTimerSupervisor::defer(SoftwareTimerControlBlock& softwareTimerControlBlock)
+{
+	deferredList_.push_back(softwareTimerControlBlock);
+	softwareTimerControlBlock.setDeferred(true);
+	maxDeferredCount_ = std::max(maxDeferredCount_, ++deferredCount_);
+	semaphore_.post();	// EOVERFLOW is not an error - software timer thread was already woken
+}
+
+void SoftwareTimerSupervisor::runDeferred()
+{
+	semaphore_.wait();
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	// interrupts are unmasked during execution of each function, so software timers may be deferred or cancelled
+	while (deferredList_.empty() == false)
+	{
+		auto& softwareTimer = deferredList_.front();
+		deferredList_.pop_front();
+		softwareTimer.setDeferred(false);
+		--deferredCount_;
+		softwareTimer.runDeferred(*this);
+	}
+}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief ThreadControlBlock class implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -42,6 +42,7 @@ ThreadControlBlock::ThreadControlBlock(architecture::Stack&& stack, const uint8_
 		owner_{owner},
 		ownedProtocolMutexList_{},
 		priorityInheritanceMutexControlBlock_{},
+		eventFlagsWaiter_{},
 		list_{},
 		threadGroupControlBlock_{threadGroupControlBlock},
 		unblockFunctor_{},
@@ -49,18 +50,27 @@ ThreadControlBlock::ThreadControlBlock(architecture::Stack&& stack, const uint8_
 		{
 				signalsReceiver != nullptr ? &signalsReceiver->signalsReceiverControlBlock_ : nullptr
 		},
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+		runTime_{},
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
 		roundRobinQuantum_{},
 		schedulingPolicy_{schedulingPolicy},
 		state_{ThreadState::created}
 {
+#ifdef _NEWLIB_VERSION
 	_REENT_INIT_PTR(&reent_);
+#endif	// def _NEWLIB_VERSION
 }
 
 ThreadControlBlock::~ThreadControlBlock()
 {
+#ifdef _NEWLIB_VERSION
+
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
 	_reclaim_reent(&reent_);
+
+#endif	// def _NEWLIB_VERSION
 }
 
 int ThreadControlBlock::addHook()
@@ -93,7 +103,7 @@ void ThreadControlBlock::setPriority(const uint8_t priority, const bool alwaysBe
 	if (previousEffectivePriority == getEffectivePriority() || threadListNode.isLinked() == false)
 		return;
 
-	reposition(loweringBefore);
+	reposition(previousEffectivePriority, loweringBefore);
 
 	if (priorityInheritanceMutexControlBlock_ != nullptr)
 		priorityInheritanceMutexControlBlock_->getOwner()->updateBoostedPriority();
@@ -138,7 +148,7 @@ void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
 
 	const auto loweringBefore = newEffectivePriority < oldEffectivePriority;
 
-	reposition(loweringBefore);
+	reposition(oldEffectivePriority, loweringBefore);
 
 	// this code is placed here, even though it could be moved to ThreadControlBlock::reposition(), simplifying
 	// ThreadControlBlock::setPriority(). This way optimizer can remove recursive calls to this function, reducing
@@ -151,17 +161,24 @@ void ThreadControlBlock::updateBoostedPriority(const uint8_t boostedPriority)
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
-void ThreadControlBlock::reposition(const bool loweringBefore)
+void ThreadControlBlock::reposition(const uint8_t previousEffectivePriority, const bool loweringBefore)
 {
-	const auto oldPriority = priority_;
+	// "runnable" list keeps additional data about positions of threads, so it has to do the repositioning on its own
+	if (state_ == ThreadState::runnable)
+		static_cast<RunnableThreadList*>(list_)->reposition(ThreadList::iterator{*this}, previousEffectivePriority,
+				loweringBefore);
+	else
+	{
+		const auto oldPriority = priority_;
 
-	if (loweringBefore == true)
-		priority_ = getEffectivePriority() + 1;
+		if (loweringBefore == true)
+			priority_ = getEffectivePriority() + 1;
 
-	list_->splice(ThreadList::iterator{*this});
+		list_->splice(ThreadList::iterator{*this});
 
-	if (loweringBefore == true)
-		priority_ = oldPriority;
+		if (loweringBefore == true)
+			priority_ = oldPriority;
+	}
 
 	getScheduler().maybeRequestContextSwitch();
 }
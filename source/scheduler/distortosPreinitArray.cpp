@@ -62,6 +62,9 @@ const FunctionPointer distortosPreinitArray[] __attribute__ ((section(".preinit_
 		chip::lowLevelInitialization,
 		boardLowLevelInitializationWrapper,
 		architecture::startScheduling,
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+		startSoftwareTimerThread,
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
 };
 
 }	// namespace
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief idle namespace implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/idle.hpp"
+
+namespace distortos
+{
+
+namespace idle
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// current wake-up latency limit, microseconds
+volatile uint32_t currentWakeUpLatencyLimit {CONFIG_IDLE_WAKE_UP_LATENCY_LIMIT};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint32_t getWakeUpLatencyLimit()
+{
+	return currentWakeUpLatencyLimit;
+}
+
+void setWakeUpLatencyLimit(const uint32_t wakeUpLatencyLimit)
+{
+	currentWakeUpLatencyLimit = wakeUpLatencyLimit;
+}
+
+}	// namespace idle
+
+}	// namespace distortos
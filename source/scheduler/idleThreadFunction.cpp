@@ -2,7 +2,7 @@
  * \file
  * \brief idleThreadFunction() definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,7 +14,8 @@
 #include "distortos/internal/memory/DeferredThreadDeleter.hpp"
 #include "distortos/internal/memory/getDeferredThreadDeleter.hpp"
 
-#include <cstdint>
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
 
 namespace distortos
 {
@@ -28,17 +29,15 @@ namespace internal
 
 void idleThreadFunction()
 {
-	volatile uint64_t i {};
-
 	while (1)
 	{
-		++i;
-
 #ifdef CONFIG_THREAD_DETACH_ENABLE
 
 		getDeferredThreadDeleter().tryCleanup();	/// \todo error handling?
 
 #endif	// def CONFIG_THREAD_DETACH_ENABLE
+
+		getScheduler().idle();
 	}
 }
 
@@ -2,7 +2,7 @@
  * \file
  * \brief internal::lowLevelInitialization() definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -16,14 +16,36 @@
 
 #include "distortos/internal/memory/DeferredThreadDeleter.hpp"
 #include "distortos/internal/memory/getDeferredThreadDeleter.hpp"
+#include "distortos/internal/memory/getMallocHeap.hpp"
 #include "distortos/internal/memory/getMallocMutex.hpp"
 
+#include "distortos/internal/scheduler/getIdleThread.hpp"
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 #include "distortos/internal/scheduler/idleThreadFunction.hpp"
 #include "distortos/internal/scheduler/MainThread.hpp"
+#include "distortos/internal/scheduler/softwareTimerThreadFunction.hpp"
 #include "distortos/internal/scheduler/ThreadGroupControlBlock.hpp"
 
+#include "distortos/TlsfHeap.hpp"
+
+#include <cstdlib>
+
+#ifdef CONFIG_TLSF_HEAP_ENABLE
+
+extern "C"
+{
+
+/// table with pairs of pointers to beginning and end of each region of the heap, imported from linker script
+extern uint8_t* const __heap_array_start[];
+
+/// end of table with regions of the heap, imported from linker script
+extern uint8_t* const __heap_array_end[];
+
+}	// extern "C"
+
+#endif	// def CONFIG_TLSF_HEAP_ENABLE
+
 namespace distortos
 {
 
@@ -50,6 +72,17 @@ using IdleThread = decltype(makeStaticThread<idleThreadStackSize>(0, idleThreadF
 /// storage for idle thread instance
 std::aligned_storage<sizeof(IdleThread), alignof(IdleThread)>::type idleThreadStorage;
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// type of software timer thread
+using SoftwareTimerThread = decltype(makeStaticThread<CONFIG_SOFTWARE_TIMER_THREAD_STACK_SIZE>(
+		CONFIG_SOFTWARE_TIMER_THREAD_PRIORITY, softwareTimerThreadFunction));
+
+/// storage for software timer thread instance
+std::aligned_storage<sizeof(SoftwareTimerThread), alignof(SoftwareTimerThread)>::type softwareTimerThreadStorage;
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 /// storage for main thread instance
 std::aligned_storage<sizeof(MainThread), alignof(MainThread)>::type mainThreadStorage;
 
@@ -75,6 +108,11 @@ std::aligned_storage<sizeof(MainThreadStaticSignalsReceiver), alignof(MainThread
 | global functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+Thread& getIdleThread()
+{
+	return reinterpret_cast<IdleThread&>(idleThreadStorage);
+}
+
 void lowLevelInitialization()
 {
 	auto& schedulerInstance = getScheduler();
@@ -103,8 +141,23 @@ void lowLevelInitialization()
 	auto& idleThread = *new (&idleThreadStorage) IdleThread {0, idleThreadFunction};
 	idleThread.start();
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	new (&softwareTimerThreadStorage) SoftwareTimerThread {CONFIG_SOFTWARE_TIMER_THREAD_PRIORITY,
+			softwareTimerThreadFunction};
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 	new (&getMallocMutex()) Mutex {Mutex::Type::recursive, Mutex::Protocol::priorityInheritance};
 
+#ifdef CONFIG_TLSF_HEAP_ENABLE
+
+	auto& mallocHeap = *new (&getMallocHeap()) TlsfHeap;
+	for (auto region = __heap_array_start; region < __heap_array_end; region += 2)
+		mallocHeap.addRegion(region[0], region[1] - region[0]);
+
+#endif	// def CONFIG_TLSF_HEAP_ENABLE
+
 #ifdef CONFIG_THREAD_DETACH_ENABLE
 
 	new (&getDeferredThreadDeleter()) DeferredThreadDeleter;
@@ -112,6 +165,19 @@ void lowLevelInitialization()
 #endif	// def CONFIG_THREAD_DETACH_ENABLE
 }
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+void startSoftwareTimerThread()
+{
+	// without software timer thread deferred software timers would never be executed - there is no one to report the
+	// error to, so the program is aborted
+	const auto ret = reinterpret_cast<SoftwareTimerThread&>(softwareTimerThreadStorage).start();
+	if (ret != 0)
+		abort();
+}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 }	// namespace internal
 
 }	// namespace distortos
@@ -0,0 +1,140 @@
+/**
+ * \file
+ * \brief Definitions of profiler functions
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/profiler.hpp"
+
+#ifdef CONFIG_PROFILER_ENABLE
+
+#include "distortos/chip/startProfilerTimer.hpp"
+#include "distortos/chip/stopProfilerTimer.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/recordProfilerSample.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+#include <cstring>
+
+namespace distortos
+{
+
+namespace profiler
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// max number of samples in the buffer
+constexpr size_t bufferSamples {CONFIG_PROFILER_BUFFER_SAMPLES};
+
+static_assert((bufferSamples & (bufferSamples - 1)) == 0, "CONFIG_PROFILER_BUFFER_SAMPLES must be a power of 2!");
+
+/// magic value of Header - "DPRF" in little-endian byte order
+constexpr uint32_t headerMagic {0x46525044};
+
+/// version of binary format of profile
+constexpr uint16_t formatVersion {1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// buffer for samples
+Sample samples[bufferSamples];
+
+/// total number of recorded samples, index of next sample is this value modulo bufferSamples, modified only by writer
+volatile uint32_t writeCount;
+
+/// total number of read samples, index of oldest unread sample is this value modulo bufferSamples, modified only by
+/// reader
+volatile uint32_t readCount;
+
+/// number of samples which were dropped because the buffer was full, modified only by writer
+volatile uint32_t droppedSamples;
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+uint32_t getDroppedSampleCount()
+{
+	return droppedSamples;
+}
+
+Header getHeader()
+{
+	return {headerMagic, formatVersion, sizeof(Sample), CONFIG_PROFILER_FREQUENCY, {},
+			reinterpret_cast<uintptr_t>(&getHeader)};
+}
+
+size_t read(void* const buffer, const size_t size)
+{
+	const uint32_t localReadCount = readCount;
+	const auto count = std::min<uint32_t>(writeCount - localReadCount, size / sizeof(Sample));
+	std::atomic_signal_fence(std::memory_order_acquire);
+
+	const auto output = static_cast<uint8_t*>(buffer);
+	for (uint32_t i {}; i < count; ++i)
+		memcpy(output + i * sizeof(Sample), &samples[(localReadCount + i) % bufferSamples], sizeof(Sample));
+
+	std::atomic_signal_fence(std::memory_order_release);
+	readCount = localReadCount + count;
+	return count * sizeof(Sample);
+}
+
+int start()
+{
+	return chip::startProfilerTimer(CONFIG_PROFILER_FREQUENCY);
+}
+
+void stop()
+{
+	chip::stopProfilerTimer();
+}
+
+}	// namespace profiler
+
+namespace internal
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void recordProfilerSample(const uintptr_t programCounter)
+{
+	const uint32_t localWriteCount = profiler::writeCount;
+	if (localWriteCount - profiler::readCount == profiler::bufferSamples)	// buffer full?
+	{
+		++profiler::droppedSamples;
+		return;
+	}
+
+	std::atomic_signal_fence(std::memory_order_acquire);
+	profiler::samples[localWriteCount % profiler::bufferSamples] = {programCounter,
+			reinterpret_cast<uintptr_t>(&getScheduler().getCurrentThreadControlBlock().getOwner())};
+	std::atomic_signal_fence(std::memory_order_release);
+	profiler::writeCount = localWriteCount + 1;
+}
+
+}	// namespace internal
+
+}	// namespace distortos
+
+#endif	// def CONFIG_PROFILER_ENABLE
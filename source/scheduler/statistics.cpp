@@ -2,7 +2,7 @@
  * \file
  * \brief statistics namespace implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,8 +11,17 @@
 
 #include "distortos/statistics.hpp"
 
+#include "distortos/Thread.hpp"
+
+#include "distortos/architecture/getRunTimeCounter.hpp"
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include "distortos/internal/memory/getMallocHeap.hpp"
+
+#include "distortos/internal/scheduler/getIdleThread.hpp"
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/ThreadGroupControlBlock.hpp"
 
 namespace distortos
 {
@@ -29,6 +38,97 @@ uint64_t getContextSwitchCount()
 	return internal::getScheduler().getContextSwitchCount();
 }
 
+uint64_t getIdleTickCount()
+{
+	return internal::getScheduler().getIdleTickCount();
+}
+
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+void enterInterrupt()
+{
+	internal::getScheduler().enterInterrupt();
+}
+
+void exitInterrupt()
+{
+	internal::getScheduler().exitInterrupt();
+}
+
+uint64_t getIdleRunTime()
+{
+	return internal::getIdleThread().getRunTime();
+}
+
+uint64_t getInterruptRunTime()
+{
+	return internal::getScheduler().getInterruptRunTime();
+}
+
+uint32_t getRunTimeFrequency()
+{
+	return architecture::getRunTimeCounterFrequency();
+}
+
+uint64_t getTotalRunTime()
+{
+	return internal::getScheduler().getTotalRunTime();
+}
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+size_t getMaxSoftwareTimerBacklog()
+{
+	return internal::getScheduler().getSoftwareTimerSupervisor().getMaxDeferredCount();
+}
+
+size_t getSoftwareTimerBacklog()
+{
+	return internal::getScheduler().getSoftwareTimerSupervisor().getDeferredCount();
+}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+
+size_t getStackUsage(const estd::ContiguousRange<StackUsage> stackUsages)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto threadGroupControlBlock =
+			internal::getScheduler().getCurrentThreadControlBlock().getThreadGroupControlBlock();
+	if (threadGroupControlBlock == nullptr)
+		return {};
+
+	size_t count {};
+	for (const auto& threadControlBlock : threadGroupControlBlock->getThreadList())
+	{
+		if (count < stackUsages.size())
+		{
+			const auto& stack = threadControlBlock.getStack();
+			stackUsages[count] = {&threadControlBlock.getOwner(), stack.getSize(), stack.getHighWaterMark()};
+		}
+
+		++count;
+	}
+
+	return count;
+}
+
+#endif	// def CONFIG_STACK_PAINTING_ENABLE
+
+#ifdef CONFIG_TLSF_HEAP_ENABLE
+
+TlsfHeap::Statistics getHeapStatistics()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	return internal::getMallocHeap().getStatistics();
+}
+
+#endif	// def CONFIG_TLSF_HEAP_ENABLE
+
 }	// namespace statistics
 
 }	// namespace distortos
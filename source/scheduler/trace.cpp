@@ -0,0 +1,129 @@
+/**
+ * \file
+ * \brief Definitions of trace functions
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/trace.hpp"
+
+#ifdef CONFIG_TRACE_ENABLE
+
+#include "distortos/architecture/getRunTimeCounter.hpp"
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <algorithm>
+
+#include <cstring>
+
+namespace distortos
+{
+
+namespace trace
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// max number of events in the buffer
+constexpr size_t bufferEvents {CONFIG_TRACE_BUFFER_EVENTS};
+
+static_assert((bufferEvents & (bufferEvents - 1)) == 0, "CONFIG_TRACE_BUFFER_EVENTS must be a power of 2!");
+
+/// magic value of Header - "DTRC" in little-endian byte order
+constexpr uint32_t headerMagic {0x43525444};
+
+/// version of binary format of trace
+constexpr uint16_t formatVersion {1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// buffer for events
+Event events[bufferEvents];
+
+/// total number of recorded events, index of next event is this value modulo bufferEvents
+uint32_t writeCount;
+
+/// total number of read events, index of oldest unread event is this value modulo bufferEvents
+uint32_t readCount;
+
+/// number of events which were dropped because the buffer was full
+uint32_t droppedEvents;
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+void enterInterrupt(const uint32_t identifier)
+{
+	record(EventType::interruptEnter, identifier);
+}
+
+void exitInterrupt(const uint32_t identifier)
+{
+	record(EventType::interruptExit, identifier);
+}
+
+uint32_t getDroppedEventCount()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	return droppedEvents;
+}
+
+Header getHeader()
+{
+	return {headerMagic, formatVersion, sizeof(Event), architecture::getRunTimeCounterFrequency(), {}};
+}
+
+size_t read(void* const buffer, const size_t size)
+{
+	uint32_t availableEvents;
+
+	{
+		architecture::InterruptMaskingLock interruptMaskingLock;
+		availableEvents = writeCount - readCount;
+	}
+
+	// events between readCount and writeCount are complete and they are not modified by record(), as long as readCount
+	// is not changed, so they may be copied with interrupts unmasked
+	const auto count = std::min(availableEvents, static_cast<uint32_t>(size / sizeof(Event)));
+	const auto output = static_cast<uint8_t*>(buffer);
+	for (uint32_t i {}; i < count; ++i)
+		memcpy(output + i * sizeof(Event), &events[(readCount + i) % bufferEvents], sizeof(Event));
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	readCount += count;
+	return count * sizeof(Event);
+}
+
+void record(const EventType type, const uint32_t object, const uint8_t argument)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (writeCount - readCount == bufferEvents)	// buffer full?
+	{
+		++droppedEvents;
+		return;
+	}
+
+	events[writeCount % bufferEvents] = {architecture::getRunTimeCounter(), object, type, argument, {}};
+	++writeCount;
+}
+
+}	// namespace trace
+
+}	// namespace distortos
+
+#endif	// def CONFIG_TRACE_ENABLE
@@ -2,7 +2,7 @@
  * \file
  * \brief CallOnceControlBlock class implementation
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -15,6 +15,12 @@
 
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+#include "distortos/architecture/exclusiveAccess.hpp"
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
@@ -30,6 +36,27 @@ namespace internal
 
 void CallOnceControlBlock::callOnceImplementation(const Functor& functor)
 {
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	{
+		ThreadList blockedList;
+		if (tryClaimExclusive(blockedList) == true)	// function is executed with no interrupt masking
+		{
+			functor();
+
+			done_ = true;
+			if (tryReleaseExclusive() == true)	// no threads were blocked during execution of function?
+				return;
+
+			architecture::InterruptMaskingLock interruptMaskingLock;
+			blockedList_ = nullptr;
+			getScheduler().unblockAll(blockedList);
+			return;
+		}
+	}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
 	if (done_ == true)	// function already executed?
@@ -50,10 +77,42 @@ void CallOnceControlBlock::callOnceImplementation(const Functor& functor)
 	done_ = true;
 	blockedList_ = nullptr;
 
-	while (blockedList.empty() == false)
-		getScheduler().unblock(blockedList.begin());
+	getScheduler().unblockAll(blockedList);
+}
+
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+bool CallOnceControlBlock::tryClaimExclusive(ThreadList& blockedList)
+{
+	do
+	{
+		// function already executed or currently being executed?
+		if (architecture::loadExclusive(blockedList_) != nullptr || done_ == true)
+		{
+			architecture::clearExclusive();
+			return false;
+		}
+	} while (architecture::storeExclusive(blockedList_, &blockedList) == false);
+
+	return true;
 }
 
+bool CallOnceControlBlock::tryReleaseExclusive()
+{
+	do
+	{
+		if (architecture::loadExclusive(blockedList_)->empty() == false)	// any threads blocked on the list?
+		{
+			architecture::clearExclusive();
+			return false;
+		}
+	} while (architecture::storeExclusive(blockedList_, static_cast<ThreadList*>(nullptr)) == false);
+
+	return true;
+}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 }	// namespace internal
 
 }	// namespace distortos
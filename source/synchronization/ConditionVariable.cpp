@@ -2,7 +2,7 @@
  * \file
  * \brief ConditionVariable class implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -19,6 +19,7 @@
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 
 #include <cerrno>
+#include <iterator>
 
 namespace distortos
 {
@@ -31,15 +32,22 @@ void ConditionVariable::notifyAll()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
-	while (blockedList_.empty() == false)
-		internal::getScheduler().unblock(blockedList_.begin());
+	auto iterator = blockedList_.begin();
+	while (iterator != blockedList_.end())
+	{
+		const auto nextIterator = std::next(iterator);
+		requeue(iterator);
+		iterator = nextIterator;
+	}
+
+	internal::getScheduler().unblockAll(blockedList_);
 }
 
 void ConditionVariable::notifyOne()
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
-	if (blockedList_.empty() == false)
+	if (blockedList_.empty() == false && requeue(blockedList_.begin()) == false)
 		internal::getScheduler().unblock(blockedList_.begin());
 }
 
@@ -52,7 +60,17 @@ int ConditionVariable::wait(Mutex& mutex)
 		if (ret != 0)
 			return ret;
 
-		internal::getScheduler().block(blockedList_, ThreadState::blockedOnConditionVariable);
+		auto& mutexControlBlock = mutex.controlBlock_;
+		const auto currentThreadControlBlock = &internal::getScheduler().getCurrentThreadControlBlock();
+		// recursive mutex may still be owned by current thread - such thread is never requeued to the mutex
+		const auto stillOwner = mutexControlBlock.getOwner() == currentThreadControlBlock;
+		mutex_ = blockedList_.empty() == true || mutex_ == &mutex ? &mutex : nullptr;
+
+		mutexControlBlock.blockOnConditionVariable(blockedList_);
+
+		// thread was requeued to the mutex and the lock was transferred to it?
+		if (stillOwner == false && mutexControlBlock.getOwner() == currentThreadControlBlock)
+			return 0;
 	}
 
 	return mutex.lock();
@@ -74,12 +92,33 @@ int ConditionVariable::waitUntil(Mutex& mutex, const TickClock::time_point timeP
 		if (ret != 0)
 			return ret;
 
-		blockUntilRet = internal::getScheduler().blockUntil(blockedList_, ThreadState::blockedOnConditionVariable,
-				timePoint);
+		auto& mutexControlBlock = mutex.controlBlock_;
+		const auto currentThreadControlBlock = &internal::getScheduler().getCurrentThreadControlBlock();
+		// recursive mutex may still be owned by current thread - such thread is never requeued to the mutex
+		const auto stillOwner = mutexControlBlock.getOwner() == currentThreadControlBlock;
+		mutex_ = blockedList_.empty() == true || mutex_ == &mutex ? &mutex : nullptr;
+
+		blockUntilRet = mutexControlBlock.blockOnConditionVariableUntil(blockedList_, timePoint);
+
+		// thread was requeued to the mutex and the lock was transferred to it?
+		if (stillOwner == false && mutexControlBlock.getOwner() == currentThreadControlBlock)
+			return 0;
 	}
 
 	const auto ret = mutex.lock();
 	return ret != 0 ? ret : blockUntilRet != EINTR ? blockUntilRet : 0;	// don't return EINTR in case of spurious wakeup
 }
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ConditionVariable::requeue(const internal::ThreadList::iterator iterator)
+{
+	if (mutex_ == nullptr)
+		return false;
+
+	return mutex_->controlBlock_.requeue(iterator);
+}
+
 }	// namespace distortos
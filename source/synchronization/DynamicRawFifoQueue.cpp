@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicRawFifoQueue class implementation
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -21,7 +21,15 @@ namespace distortos
 +---------------------------------------------------------------------------------------------------------------------*/
 
 DynamicRawFifoQueue::DynamicRawFifoQueue(const size_t elementSize, const size_t queueSize) :
-		RawFifoQueue{{new uint8_t[elementSize * queueSize], internal::storageDeleter<uint8_t>}, elementSize, queueSize}
+		DynamicRawFifoQueue{getNewDeleteMemoryResource(), elementSize, queueSize}
+{
+
+}
+
+DynamicRawFifoQueue::DynamicRawFifoQueue(MemoryResource& memoryResource, const size_t elementSize,
+		const size_t queueSize) :
+		RawFifoQueue{{internal::allocateStorage(memoryResource, elementSize * queueSize),
+				internal::storageDeleter<void>}, elementSize, queueSize}
 {
 
 }
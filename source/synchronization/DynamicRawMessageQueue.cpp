@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicRawMessageQueue class implementation
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -21,8 +21,17 @@ namespace distortos
 +---------------------------------------------------------------------------------------------------------------------*/
 
 DynamicRawMessageQueue::DynamicRawMessageQueue(const size_t elementSize, const size_t queueSize) :
-		RawMessageQueue{{new EntryStorage[queueSize], internal::storageDeleter<EntryStorage>},
-				{new uint8_t[elementSize * queueSize], internal::storageDeleter<uint8_t>}, elementSize, queueSize}
+		DynamicRawMessageQueue{getNewDeleteMemoryResource(), elementSize, queueSize}
+{
+
+}
+
+DynamicRawMessageQueue::DynamicRawMessageQueue(MemoryResource& memoryResource, const size_t elementSize,
+		const size_t queueSize) :
+		RawMessageQueue{{static_cast<EntryStorage*>(internal::allocateStorage(memoryResource,
+				sizeof(EntryStorage) * queueSize)), internal::storageDeleter<EntryStorage>},
+				{internal::allocateStorage(memoryResource, elementSize * queueSize), internal::storageDeleter<void>},
+				elementSize, queueSize}
 {
 
 }
@@ -0,0 +1,37 @@
+/**
+ * \file
+ * \brief DynamicRawSpscQueue class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/DynamicRawSpscQueue.hpp"
+
+#include "distortos/internal/memory/storageDeleter.hpp"
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+DynamicRawSpscQueue::DynamicRawSpscQueue(const size_t elementSize, const size_t queueSize) :
+		DynamicRawSpscQueue{getNewDeleteMemoryResource(), elementSize, queueSize}
+{
+
+}
+
+DynamicRawSpscQueue::DynamicRawSpscQueue(MemoryResource& memoryResource, const size_t elementSize,
+		const size_t queueSize) :
+		RawSpscQueue{{internal::allocateStorage(memoryResource, elementSize * queueSize),
+				internal::storageDeleter<void>}, elementSize, queueSize}
+{
+
+}
+
+}	// namespace distortos
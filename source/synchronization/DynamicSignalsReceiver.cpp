@@ -2,7 +2,7 @@
  * \file
  * \brief DynamicSignalsReceiver class implementation
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -21,11 +21,21 @@ namespace distortos
 +---------------------------------------------------------------------------------------------------------------------*/
 
 DynamicSignalsReceiver::DynamicSignalsReceiver(const size_t queuedSignals, const size_t signalActions) :
+		DynamicSignalsReceiver{getNewDeleteMemoryResource(), queuedSignals, signalActions}
+{
+
+}
+
+DynamicSignalsReceiver::DynamicSignalsReceiver(MemoryResource& memoryResource, const size_t queuedSignals,
+		const size_t signalActions) :
 		SignalsReceiver{queuedSignals != 0 ? &signalInformationQueueWrapper_ : nullptr,
 				signalActions != 0 ? &signalsCatcher_ : nullptr},
-		signalInformationQueueWrapper_{{queuedSignals != 0 ? new SignalInformationQueueWrapper::Storage[queuedSignals] :
-				nullptr, internal::storageDeleter<SignalInformationQueueWrapper::Storage>}, queuedSignals},
-		signalsCatcher_{{signalActions != 0 ? new SignalsCatcher::Storage[signalActions] : nullptr,
+		signalInformationQueueWrapper_{{queuedSignals != 0 ?
+				static_cast<SignalInformationQueueWrapper::Storage*>(internal::allocateStorage(memoryResource,
+				sizeof(SignalInformationQueueWrapper::Storage) * queuedSignals)) : nullptr,
+				internal::storageDeleter<SignalInformationQueueWrapper::Storage>}, queuedSignals},
+		signalsCatcher_{{signalActions != 0 ? static_cast<SignalsCatcher::Storage*>(internal::allocateStorage(
+				memoryResource, sizeof(SignalsCatcher::Storage) * signalActions)) : nullptr,
 				internal::storageDeleter<SignalsCatcher::Storage>}, signalActions}
 {
 
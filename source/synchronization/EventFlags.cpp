@@ -0,0 +1,147 @@
+/**
+ * \file
+ * \brief EventFlags class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/EventFlags.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/ThreadControlBlock.hpp"
+
+#include "distortos/internal/synchronization/EventFlagsWaiter.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+EventFlags::Value EventFlags::clear(const Value bitmask)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto previousValue = value_;
+	value_ &= ~bitmask;
+	return previousValue;
+}
+
+EventFlags::Value EventFlags::set(const Value bitmask)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto previousValue = value_;
+	value_ |= bitmask;
+
+	// waiting threads are checked in the order of their current effective priorities (list of blocked threads is kept
+	// sorted also when priorities change), so flags which are cleared automatically are delivered to the most important
+	// thread
+	auto& scheduler = internal::getScheduler();
+	auto iterator = blockedList_.begin();
+	while (iterator != blockedList_.end() && value_ != 0)
+	{
+		auto& waiter = *iterator->getEventFlagsWaiter();
+		if (waiter.isSatisfied(value_) == false)
+		{
+			++iterator;
+			continue;
+		}
+
+		waiter.value = value_;
+		if (waiter.autoClear == true)
+			value_ &= ~waiter.bitmask;
+		scheduler.unblock(iterator++);
+	}
+
+	return previousValue;
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitAll(const Value bitmask, const bool autoClear)
+{
+	return waitImplementation(bitmask, true, autoClear, true, nullptr);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitAllFor(const TickClock::duration duration, const Value bitmask,
+		const bool autoClear)
+{
+	return tryWaitAllUntil(TickClock::now() + duration + TickClock::duration{1}, bitmask, autoClear);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitAllUntil(const TickClock::time_point timePoint,
+		const Value bitmask, const bool autoClear)
+{
+	return waitImplementation(bitmask, true, autoClear, false, &timePoint);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitAny(const Value bitmask, const bool autoClear)
+{
+	return waitImplementation(bitmask, false, autoClear, true, nullptr);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitAnyFor(const TickClock::duration duration, const Value bitmask,
+		const bool autoClear)
+{
+	return tryWaitAnyUntil(TickClock::now() + duration + TickClock::duration{1}, bitmask, autoClear);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::tryWaitAnyUntil(const TickClock::time_point timePoint,
+		const Value bitmask, const bool autoClear)
+{
+	return waitImplementation(bitmask, false, autoClear, false, &timePoint);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::waitAll(const Value bitmask, const bool autoClear)
+{
+	return waitImplementation(bitmask, true, autoClear, false, nullptr);
+}
+
+std::pair<int, EventFlags::Value> EventFlags::waitAny(const Value bitmask, const bool autoClear)
+{
+	return waitImplementation(bitmask, false, autoClear, false, nullptr);
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<int, EventFlags::Value> EventFlags::waitImplementation(const Value bitmask, const bool all,
+		const bool autoClear, const bool nonBlocking, const TickClock::time_point* const timePoint)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (bitmask == 0)
+		return {EINVAL, value_};
+
+	internal::EventFlagsWaiter waiter {bitmask, all, autoClear};
+	if (waiter.isSatisfied(value_) == true)
+	{
+		const auto value = value_;
+		if (autoClear == true)
+			value_ &= ~bitmask;
+		return {0, value};
+	}
+
+	if (nonBlocking == true)
+		return {EAGAIN, value_};
+
+	auto& scheduler = internal::getScheduler();
+	auto& currentThreadControlBlock = scheduler.getCurrentThreadControlBlock();
+	currentThreadControlBlock.setEventFlagsWaiter(&waiter);
+	const auto ret = timePoint == nullptr ? scheduler.block(blockedList_, ThreadState::blockedOnEventFlags) :
+			scheduler.blockUntil(blockedList_, ThreadState::blockedOnEventFlags, *timePoint);
+	currentThreadControlBlock.setEventFlagsWaiter(nullptr);
+	return {ret, ret == 0 ? waiter.value : value_};
+}
+
+}	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief FifoQueueBase class implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,26 +11,59 @@
 
 #include "distortos/internal/synchronization/FifoQueueBase.hpp"
 
+#include "distortos/internal/scheduler/traceEvent.hpp"
+
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <limits>
+
 namespace distortos
 {
 
 namespace internal
 {
 
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets max value of semaphores which count elements of the queue.
+ *
+ * \param [in] maxElements is the number of elements in storage
+ *
+ * \return \a maxElements clipped to the range of Semaphore::Value
+ */
+
+constexpr Semaphore::Value getSemaphoreMaxValue(const size_t maxElements)
+{
+	return static_cast<Semaphore::Value>(maxElements < std::numeric_limits<Semaphore::Value>::max() ? maxElements :
+			std::numeric_limits<Semaphore::Value>::max());
+}
+
+}	// namespace
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | public functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
 FifoQueueBase::FifoQueueBase(StorageUniquePointer&& storageUniquePointer, const size_t elementSize,
 		const size_t maxElements) :
-		popSemaphore_{0, maxElements},
-		pushSemaphore_{maxElements, maxElements},
+		popSemaphore_{0, getSemaphoreMaxValue(maxElements)},
+		pushSemaphore_{getSemaphoreMaxValue(maxElements), getSemaphoreMaxValue(maxElements)},
 		storageUniquePointer_{std::move(storageUniquePointer)},
 		storageEnd_{static_cast<uint8_t*>(storageUniquePointer_.get()) + elementSize * maxElements},
 		readPosition_{storageUniquePointer_.get()},
 		writePosition_{storageUniquePointer_.get()},
+		popReservation_{},
+		pushReservation_{},
+		deferredPopSemaphorePosts_{},
+		deferredPushSemaphorePosts_{},
 		elementSize_{elementSize}
 {
 
@@ -41,12 +74,56 @@ FifoQueueBase::~FifoQueueBase()
 
 }
 
+int FifoQueueBase::peekPop(const SemaphoreFunctor& waitSemaphoreFunctor, const void*& storage)
+{
+	void* reservedStorage;
+	const auto ret = reserve(waitSemaphoreFunctor, popSemaphore_, readPosition_, popReservation_, reservedStorage);
+	if (ret != 0)
+		return ret;
+
+	storage = reservedStorage;
+	return 0;
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+void FifoQueueBase::advance(void*& position, const size_t count) const
+{
+	const auto storageBegin = static_cast<uint8_t*>(storageUniquePointer_.get());
+	auto newPosition = static_cast<uint8_t*>(position) + elementSize_ * count;
+	if (newPosition >= storageEnd_)
+		newPosition -= static_cast<const uint8_t*>(storageEnd_) - storageBegin;
+	position = newPosition;
+}
+
+int FifoQueueBase::commitRelease(const void* const storage, void*& reservation, size_t& deferredPosts,
+		Semaphore& postSemaphore)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (reservation == nullptr || storage != reservation)
+		return EINVAL;
+
+	reservation = {};
+
+	traceEvent(&postSemaphore == &popSemaphore_ ? trace::EventType::queuePush : trace::EventType::queuePop, this, 1);
+
+	// post for reserved element and for all elements which were pushed/popped after it
+	while (1)
+	{
+		const auto ret = postSemaphore.post();
+		if (ret != 0 || deferredPosts == 0)
+			return ret;
+
+		--deferredPosts;
+	}
+}
+
 int FifoQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueFunctor& functor,
-		Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage)
+		Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage, const void* const reservation,
+		size_t& deferredPosts)
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
@@ -56,13 +133,84 @@ int FifoQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, const Q
 
 	functor(storage);
 
-	storage = static_cast<uint8_t*>(storage) + elementSize_;
-	if (storage >= storageEnd_)
-		storage = storageUniquePointer_.get();
+	advance(storage);
+
+	traceEvent(&waitSemaphore == &pushSemaphore_ ? trace::EventType::queuePush : trace::EventType::queuePop, this, 1);
+
+	if (reservation != nullptr)	// element/slot must not be made available before the reserved one?
+	{
+		++deferredPosts;
+		return 0;
+	}
 
 	return postSemaphore.post();
 }
 
+int FifoQueueBase::popPushN(const SemaphoreFunctor& waitSemaphoreFunctor, const QueueRangeFunctor& functor,
+		const size_t maxCount, size_t& count, Semaphore& waitSemaphore, Semaphore& postSemaphore, void*& storage,
+		const void* const reservation, size_t& deferredPosts)
+{
+	if (maxCount == 0)
+		return EINVAL;
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	const auto ret = waitSemaphoreFunctor(waitSemaphore);
+	if (ret != 0)
+		return ret;
+
+	// first element/slot was acquired by the functor, all other are taken only if they are immediately available
+	const size_t transferCount = 1 + waitSemaphore.tryWaitInternal(std::min<size_t>(maxCount - 1,
+			std::numeric_limits<Semaphore::Value>::max()));
+
+	for (size_t index {}; index < transferCount;)
+	{
+		const size_t contiguousCount = (static_cast<const uint8_t*>(storageEnd_) - static_cast<uint8_t*>(storage)) /
+				elementSize_;
+		const auto rangeCount = std::min(transferCount - index, contiguousCount);
+		functor(storage, index, rangeCount);
+		advance(storage, rangeCount);
+		index += rangeCount;
+	}
+
+	count = transferCount;
+
+	traceEvent(&waitSemaphore == &pushSemaphore_ ? trace::EventType::queuePush : trace::EventType::queuePop, this,
+			std::min<size_t>(transferCount, UINT8_MAX));
+
+	if (reservation != nullptr)	// elements/slots must not be made available before the reserved one?
+	{
+		deferredPosts += transferCount;
+		return 0;
+	}
+
+	return postSemaphore.postInternal(transferCount);
+}
+
+int FifoQueueBase::reserve(const SemaphoreFunctor& waitSemaphoreFunctor, Semaphore& waitSemaphore, void*& position,
+		void*& reservation, void*& storage)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (reservation != nullptr)
+		return EBUSY;
+
+	const auto ret = waitSemaphoreFunctor(waitSemaphore);
+	if (ret != 0)
+		return ret;
+
+	if (reservation != nullptr)	// another reservation was made while waiting for the semaphore?
+	{
+		waitSemaphore.post();
+		return EBUSY;
+	}
+
+	reservation = position;
+	storage = position;
+	advance(position);
+	return 0;
+}
+
 }	// namespace internal
 
 }	// namespace distortos
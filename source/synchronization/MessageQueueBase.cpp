@@ -2,7 +2,7 @@
  * \file
  * \brief MessageQueueBase class implementation
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,8 +11,14 @@
 
 #include "distortos/internal/synchronization/MessageQueueBase.hpp"
 
+#include "distortos/internal/scheduler/traceEvent.hpp"
+
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 
+#include <cerrno>
+#include <iterator>
+#include <limits>
+
 namespace distortos
 {
 
@@ -64,7 +70,7 @@ public:
 
 		functor_(entry.storage);
 
-		MessageQueueBase::FreeEntryList::splice_after(freeEntryList.before_begin(), entryList.before_begin());
+		entryList.spliceFrontAfter(freeEntryList.before_begin());
 	}
 
 private:
@@ -126,6 +132,24 @@ private:
 	const uint8_t priority_;
 };
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets max value of semaphores which count elements of the queue.
+ *
+ * \param [in] maxElements is the number of elements in storage
+ *
+ * \return \a maxElements clipped to the range of Semaphore::Value
+ */
+
+constexpr Semaphore::Value getSemaphoreMaxValue(const size_t maxElements)
+{
+	return static_cast<Semaphore::Value>(maxElements < std::numeric_limits<Semaphore::Value>::max() ? maxElements :
+			std::numeric_limits<Semaphore::Value>::max());
+}
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -134,12 +158,18 @@ private:
 
 MessageQueueBase::MessageQueueBase(EntryStorageUniquePointer&& entryStorageUniquePointer,
 		ValueStorageUniquePointer&& valueStorageUniquePointer, size_t elementSize, size_t maxElements) :
-		popSemaphore_{0, maxElements},
-		pushSemaphore_{maxElements, maxElements},
+		popSemaphore_{0, getSemaphoreMaxValue(maxElements)},
+		pushSemaphore_{getSemaphoreMaxValue(maxElements), getSemaphoreMaxValue(maxElements)},
 		entryStorageUniquePointer_{std::move(entryStorageUniquePointer)},
 		valueStorageUniquePointer_{std::move(valueStorageUniquePointer)},
+#ifdef CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+		entryList_{reinterpret_cast<Entry*>(entryStorageUniquePointer_.get()), maxElements},
+#else	// !def CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
 		entryList_{},
-		freeEntryList_{}
+#endif	// !def CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+		freeEntryList_{},
+		popReservedEntryList_{},
+		pushReservedEntryList_{}
 {
 	for (size_t i = 0; i < maxElements; ++i)
 	{
@@ -154,6 +184,46 @@ MessageQueueBase::~MessageQueueBase()
 
 }
 
+int MessageQueueBase::commitPush(const uint8_t priority, const void* const storage)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (pushReservedEntryList_.empty() == true || pushReservedEntryList_.front().storage != storage)
+		return EINVAL;
+
+	pushReservedEntryList_.front().priority = priority;
+	entryList_.splice_after(pushReservedEntryList_.before_begin());
+
+	traceEvent(trace::EventType::queuePush, this, 1);
+
+	return popSemaphore_.post();
+}
+
+int MessageQueueBase::peekPop(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t& priority, const void*& storage)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (popReservedEntryList_.empty() == false)
+		return EBUSY;
+
+	const auto ret = waitSemaphoreFunctor(popSemaphore_);
+	if (ret != 0)
+		return ret;
+
+	if (popReservedEntryList_.empty() == false)	// another reservation was made while waiting for the semaphore?
+	{
+		popSemaphore_.post();
+		return EBUSY;
+	}
+
+	const auto& entry = entryList_.front();
+	priority = entry.priority;
+	storage = entry.storage;
+
+	entryList_.spliceFrontAfter(popReservedEntryList_.before_begin());
+	return 0;
+}
+
 int MessageQueueBase::pop(const SemaphoreFunctor& waitSemaphoreFunctor, uint8_t& priority, const QueueFunctor& functor)
 {
 	const PopInternalFunctor popInternalFunctor {priority, functor};
@@ -167,6 +237,43 @@ int MessageQueueBase::push(const SemaphoreFunctor& waitSemaphoreFunctor, const u
 	return popPush(waitSemaphoreFunctor, pushInternalFunctor, pushSemaphore_, popSemaphore_);
 }
 
+int MessageQueueBase::releasePop(const void* const storage)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (popReservedEntryList_.empty() == true || popReservedEntryList_.front().storage != storage)
+		return EINVAL;
+
+	FreeEntryList::splice_after(freeEntryList_.before_begin(), popReservedEntryList_.before_begin());
+
+	traceEvent(trace::EventType::queuePop, this, 1);
+
+	return pushSemaphore_.post();
+}
+
+int MessageQueueBase::reservePush(const SemaphoreFunctor& waitSemaphoreFunctor, void*& storage)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (pushReservedEntryList_.empty() == false)
+		return EBUSY;
+
+	const auto ret = waitSemaphoreFunctor(pushSemaphore_);
+	if (ret != 0)
+		return ret;
+
+	if (pushReservedEntryList_.empty() == false)	// another reservation was made while waiting for the semaphore?
+	{
+		pushSemaphore_.post();
+		return EBUSY;
+	}
+
+	storage = freeEntryList_.front().storage;
+
+	FreeEntryList::splice_after(pushReservedEntryList_.before_begin(), freeEntryList_.before_begin());
+	return 0;
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -182,9 +289,98 @@ int MessageQueueBase::popPush(const SemaphoreFunctor& waitSemaphoreFunctor, cons
 
 	internalFunctor(entryList_, freeEntryList_);
 
+	traceEvent(&waitSemaphore == &pushSemaphore_ ? trace::EventType::queuePush : trace::EventType::queuePop, this, 1);
+
 	return postSemaphore.post();
 }
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| MessageQueueBase::EntryList public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+#ifdef CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+
+void MessageQueueBase::EntryList::splice_after(const FreeEntryList::iterator beforeSplicedEntry)
+{
+	auto& entry = *std::next(beforeSplicedEntry);
+	const auto priority = entry.priority;
+
+	// entry must be linked after the last entry of its own group or after the last entry of the closest group of higher
+	// priority, if there are no other entries with the same priority
+	const auto found = findPriority(priority);
+	const auto lastEntryLink = found.first == true ? &findLastEntryLink(found.second) : nullptr;
+	const auto position = lastEntryLink != nullptr ? FreeEntryList::iterator{**lastEntryLink} : list_.before_begin();
+	FreeEntryList::splice_after(position, beforeSplicedEntry);
+
+	if (found.first == true && found.second == priority)	// entry replaces previous last entry with this priority?
+	{
+		entry.nextLastEntry = (*lastEntryLink)->nextLastEntry;
+		*lastEntryLink = &entry;
+		return;
+	}
+
+	auto& bucket = getBucket(priority);
+	entry.nextLastEntry = bucket;
+	bucket = &entry;
+	bitmap_[priority / bitsPerBitmapWord] |= getBitMask(priority);
+}
+
+void MessageQueueBase::EntryList::spliceFrontAfter(const FreeEntryList::iterator position)
+{
+	const auto priority = list_.front().priority;
+	const auto next = std::next(list_.begin());
+	if (next == list_.end() || next->priority != priority)	// last entry with this priority?
+	{
+		auto& lastEntryLink = findLastEntryLink(priority);
+		lastEntryLink = lastEntryLink->nextLastEntry;
+		bitmap_[priority / bitsPerBitmapWord] &= ~getBitMask(priority);
+	}
+
+	FreeEntryList::splice_after(position, list_.before_begin());
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| MessageQueueBase::EntryList private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+std::pair<bool, uint8_t> MessageQueueBase::EntryList::findPriority(const size_t priority) const
+{
+	auto mask = ~BitmapWord{} >> (priority % bitsPerBitmapWord);
+	for (auto index = priority / bitsPerBitmapWord; index < bitmap_.size(); ++index)
+	{
+		const auto word = bitmap_[index] & mask;
+		if (word != 0)
+			return {true, static_cast<uint8_t>(index * bitsPerBitmapWord + __builtin_clz(word))};
+
+		mask = ~BitmapWord{};
+	}
+
+	return {false, {}};
+}
+
+MessageQueueBase::Entry*& MessageQueueBase::EntryList::findLastEntryLink(const uint8_t priority) const
+{
+	auto lastEntryLink = &getBucket(priority);
+	while ((*lastEntryLink)->priority != priority)
+		lastEntryLink = &(*lastEntryLink)->nextLastEntry;
+
+	return *lastEntryLink;
+}
+
+#else	// !def CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+
+void MessageQueueBase::EntryList::splice_after(const FreeEntryList::iterator beforeSplicedEntry)
+{
+	list_.splice_after(beforeSplicedEntry);
+}
+
+void MessageQueueBase::EntryList::spliceFrontAfter(const FreeEntryList::iterator position)
+{
+	FreeEntryList::splice_after(position, list_.before_begin());
+}
+
+#endif	// !def CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+
 }	// namespace internal
 
 }	// namespace distortos
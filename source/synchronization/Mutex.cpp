@@ -2,7 +2,7 @@
  * \file
  * \brief Mutex class implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,7 @@
 
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
 
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 
@@ -27,6 +28,16 @@ namespace distortos
 
 int Mutex::lock()
 {
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	if (controlBlock_.tryLockExclusive() == true)
+	{
+		internal::traceEvent(trace::EventType::mutexLock, this);
+		return 0;
+	}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
 	int ret;
@@ -34,13 +45,27 @@ int Mutex::lock()
 	// - lock successful, recursive lock not possible or deadlock detected;
 	// - lock transferred successfully;
 	while ((ret = tryLockInternal()) == EBUSY && (ret = controlBlock_.block()) == EINTR);
+	if (ret == 0)
+		internal::traceEvent(trace::EventType::mutexLock, this);
 	return ret;
 }
 
 int Mutex::tryLock()
 {
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	if (controlBlock_.tryLockExclusive() == true)
+	{
+		internal::traceEvent(trace::EventType::mutexLock, this);
+		return 0;
+	}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	architecture::InterruptMaskingLock interruptMaskingLock;
 	const auto ret = tryLockInternal();
+	if (ret == 0)
+		internal::traceEvent(trace::EventType::mutexLock, this);
 	return ret != EDEADLK ? ret : EBUSY;
 }
 
@@ -51,6 +76,16 @@ int Mutex::tryLockFor(const TickClock::duration duration)
 
 int Mutex::tryLockUntil(const TickClock::time_point timePoint)
 {
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	if (controlBlock_.tryLockExclusive() == true)
+	{
+		internal::traceEvent(trace::EventType::mutexLock, this);
+		return 0;
+	}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
 	int ret;
@@ -59,13 +94,15 @@ int Mutex::tryLockUntil(const TickClock::time_point timePoint)
 	// - lock transferred successfully;
 	// - timeout expired;
 	while ((ret = tryLockInternal()) == EBUSY && (ret = controlBlock_.blockUntil(timePoint)) == EINTR);
+	if (ret == 0)
+		internal::traceEvent(trace::EventType::mutexLock, this);
 	return ret;
 }
 
 int Mutex::unlock()
 {
-	architecture::InterruptMaskingLock interruptMaskingLock;
-
+	// owner of the mutex and the number of recursive locks can be changed only by current owner, so these checks don't
+	// need interrupt masking
 	if (type_ != Type::normal)
 	{
 		if (controlBlock_.getOwner() != &internal::getScheduler().getCurrentThreadControlBlock())
@@ -74,11 +111,15 @@ int Mutex::unlock()
 		if (type_ == Type::recursive && recursiveLocksCount_ != 0)
 		{
 			--recursiveLocksCount_;
+			internal::traceEvent(trace::EventType::mutexUnlock, this);
 			return 0;
 		}
 	}
 
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
 	controlBlock_.unlockOrTransferLock();
+	internal::traceEvent(trace::EventType::mutexUnlock, this);
 
 	return 0;
 }
@@ -2,7 +2,7 @@
  * \file
  * \brief MutexControlBlock class implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,12 @@
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
 
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+#include "distortos/architecture/exclusiveAccess.hpp"
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 namespace distortos
 {
 
@@ -99,6 +105,21 @@ int MutexControlBlock::blockUntil(const TickClock::time_point timePoint)
 			protocol_ == Protocol::priorityInheritance ? &unblockFunctor : nullptr);
 }
 
+int MutexControlBlock::blockOnConditionVariable(ThreadList& conditionVariableBlockedList) const
+{
+	const PriorityInheritanceMutexControlBlockUnblockFunctor unblockFunctor {*this};
+	return getScheduler().block(conditionVariableBlockedList, ThreadState::blockedOnConditionVariable,
+			protocol_ == Protocol::priorityInheritance ? &unblockFunctor : nullptr);
+}
+
+int MutexControlBlock::blockOnConditionVariableUntil(ThreadList& conditionVariableBlockedList,
+		const TickClock::time_point timePoint) const
+{
+	const PriorityInheritanceMutexControlBlockUnblockFunctor unblockFunctor {*this};
+	return getScheduler().blockUntil(conditionVariableBlockedList, ThreadState::blockedOnConditionVariable, timePoint,
+			protocol_ == Protocol::priorityInheritance ? &unblockFunctor : nullptr);
+}
+
 uint8_t MutexControlBlock::getBoostedPriority() const
 {
 	if (protocol_ == Protocol::priorityInheritance)
@@ -128,6 +149,51 @@ void MutexControlBlock::lock()
 		owner_->updateBoostedPriority();
 }
 
+bool MutexControlBlock::requeue(const ThreadList::iterator iterator)
+{
+	auto& threadControlBlock = *iterator;
+
+	if (owner_ == nullptr || owner_ == &threadControlBlock)
+		return false;
+
+	if (protocol_ == Protocol::priorityProtect && threadControlBlock.getPriority() > priorityCeiling_)
+		return false;
+
+	blockedList_.splice(iterator);
+	threadControlBlock.setList(&blockedList_);
+	threadControlBlock.setState(ThreadState::blockedOnMutex);
+
+	if (protocol_ == Protocol::priorityInheritance)
+	{
+		threadControlBlock.setPriorityInheritanceMutexControlBlock(this);
+		owner_->updateBoostedPriority();
+	}
+
+	return true;
+}
+
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+bool MutexControlBlock::tryLockExclusive()
+{
+	if (protocol_ != Protocol::none)
+		return false;
+
+	const auto currentThreadControlBlock = &getScheduler().getCurrentThreadControlBlock();
+	do
+	{
+		if (architecture::loadExclusive(owner_) != nullptr)	// mutex is locked?
+		{
+			architecture::clearExclusive();
+			return false;
+		}
+	} while (architecture::storeExclusive(owner_, currentThreadControlBlock) == false);
+
+	return true;
+}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 void MutexControlBlock::unlockOrTransferLock()
 {
 	auto& oldOwner = *owner_;
@@ -2,7 +2,7 @@
  * \file
  * \brief RawFifoQueue class implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -11,6 +11,7 @@
 
 #include "distortos/RawFifoQueue.hpp"
 
+#include "distortos/internal/synchronization/BoundQueueRangeFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPopQueueFunctor.hpp"
 #include "distortos/internal/synchronization/MemcpyPushQueueFunctor.hpp"
 #include "distortos/internal/synchronization/SemaphoreWaitFunctor.hpp"
@@ -35,18 +36,70 @@ RawFifoQueue::RawFifoQueue(StorageUniquePointer&& storageUniquePointer, const si
 
 }
 
+int RawFifoQueue::commitPush(const void* const storage)
+{
+	return fifoQueueBase_.commitPush(storage);
+}
+
+int RawFifoQueue::peekPop(const void*& storage)
+{
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return fifoQueueBase_.peekPop(semaphoreWaitFunctor, storage);
+}
+
 int RawFifoQueue::pop(void* const buffer, const size_t size)
 {
 	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
 	return popInternal(semaphoreWaitFunctor, buffer, size);
 }
 
+int RawFifoQueue::popN(void* const buffer, const size_t size, size_t& count)
+{
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return popNInternal(semaphoreWaitFunctor, buffer, size, count);
+}
+
 int RawFifoQueue::push(const void* const data, const size_t size)
 {
 	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
 	return pushInternal(semaphoreWaitFunctor, data, size);
 }
 
+int RawFifoQueue::pushN(const void* const data, const size_t size, size_t& count)
+{
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return pushNInternal(semaphoreWaitFunctor, data, size, count);
+}
+
+int RawFifoQueue::releasePop(const void* const storage)
+{
+	return fifoQueueBase_.releasePop(storage);
+}
+
+int RawFifoQueue::reservePush(void*& storage)
+{
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return fifoQueueBase_.reservePush(semaphoreWaitFunctor, storage);
+}
+
+int RawFifoQueue::tryPeekPop(const void*& storage)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return fifoQueueBase_.peekPop(semaphoreTryWaitFunctor, storage);
+}
+
+int RawFifoQueue::tryPeekPopFor(const TickClock::duration duration, const void*& storage)
+{
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return fifoQueueBase_.peekPop(semaphoreTryWaitForFunctor, storage);
+}
+
+int RawFifoQueue::tryPeekPopUntil(const TickClock::time_point timePoint, const void*& storage)
+{
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return fifoQueueBase_.peekPop(semaphoreTryWaitUntilFunctor, storage);
+}
+
 int RawFifoQueue::tryPop(void* const buffer, const size_t size)
 {
 	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
@@ -59,6 +112,25 @@ int RawFifoQueue::tryPopFor(const TickClock::duration duration, void* const buff
 	return popInternal(semaphoreTryWaitForFunctor, buffer, size);
 }
 
+int RawFifoQueue::tryPopN(void* const buffer, const size_t size, size_t& count)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return popNInternal(semaphoreTryWaitFunctor, buffer, size, count);
+}
+
+int RawFifoQueue::tryPopNFor(const TickClock::duration duration, void* const buffer, const size_t size, size_t& count)
+{
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return popNInternal(semaphoreTryWaitForFunctor, buffer, size, count);
+}
+
+int RawFifoQueue::tryPopNUntil(const TickClock::time_point timePoint, void* const buffer, const size_t size,
+		size_t& count)
+{
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return popNInternal(semaphoreTryWaitUntilFunctor, buffer, size, count);
+}
+
 int RawFifoQueue::tryPopUntil(const TickClock::time_point timePoint, void* const buffer, const size_t size)
 {
 	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
@@ -77,12 +149,50 @@ int RawFifoQueue::tryPushFor(const TickClock::duration duration, const void* con
 	return pushInternal(semaphoreTryWaitForFunctor, data, size);
 }
 
+int RawFifoQueue::tryPushN(const void* const data, const size_t size, size_t& count)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return pushNInternal(semaphoreTryWaitFunctor, data, size, count);
+}
+
+int RawFifoQueue::tryPushNFor(const TickClock::duration duration, const void* const data, const size_t size,
+		size_t& count)
+{
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return pushNInternal(semaphoreTryWaitForFunctor, data, size, count);
+}
+
+int RawFifoQueue::tryPushNUntil(const TickClock::time_point timePoint, const void* const data, const size_t size,
+		size_t& count)
+{
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return pushNInternal(semaphoreTryWaitUntilFunctor, data, size, count);
+}
+
 int RawFifoQueue::tryPushUntil(const TickClock::time_point timePoint, const void* const data, const size_t size)
 {
 	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
 	return pushInternal(semaphoreTryWaitUntilFunctor, data, size);
 }
 
+int RawFifoQueue::tryReservePush(void*& storage)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return fifoQueueBase_.reservePush(semaphoreTryWaitFunctor, storage);
+}
+
+int RawFifoQueue::tryReservePushFor(const TickClock::duration duration, void*& storage)
+{
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return fifoQueueBase_.reservePush(semaphoreTryWaitForFunctor, storage);
+}
+
+int RawFifoQueue::tryReservePushUntil(const TickClock::time_point timePoint, void*& storage)
+{
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return fifoQueueBase_.reservePush(semaphoreTryWaitUntilFunctor, storage);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -97,6 +207,21 @@ int RawFifoQueue::popInternal(const internal::SemaphoreFunctor& waitSemaphoreFun
 	return fifoQueueBase_.pop(waitSemaphoreFunctor, memcpyPopQueueFunctor);
 }
 
+int RawFifoQueue::popNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, void* const buffer,
+		const size_t size, size_t& count)
+{
+	const auto elementSize = fifoQueueBase_.getElementSize();
+	if (size == 0 || size % elementSize != 0)
+		return EMSGSIZE;
+
+	const auto memcpyPopQueueRangeFunctor = internal::makeBoundQueueRangeFunctor(
+			[buffer, elementSize](void* const storage, const size_t index, const size_t rangeCount)
+			{
+				memcpy(static_cast<uint8_t*>(buffer) + index * elementSize, storage, rangeCount * elementSize);
+			});
+	return fifoQueueBase_.popN(waitSemaphoreFunctor, memcpyPopQueueRangeFunctor, size / elementSize, count);
+}
+
 int RawFifoQueue::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* const data,
 		const size_t size)
 {
@@ -107,4 +232,19 @@ int RawFifoQueue::pushInternal(const internal::SemaphoreFunctor& waitSemaphoreFu
 	return fifoQueueBase_.push(waitSemaphoreFunctor, memcpyPushQueueFunctor);
 }
 
+int RawFifoQueue::pushNInternal(const internal::SemaphoreFunctor& waitSemaphoreFunctor, const void* const data,
+		const size_t size, size_t& count)
+{
+	const auto elementSize = fifoQueueBase_.getElementSize();
+	if (size == 0 || size % elementSize != 0)
+		return EMSGSIZE;
+
+	const auto memcpyPushQueueRangeFunctor = internal::makeBoundQueueRangeFunctor(
+			[data, elementSize](void* const storage, const size_t index, const size_t rangeCount)
+			{
+				memcpy(storage, static_cast<const uint8_t*>(data) + index * elementSize, rangeCount * elementSize);
+			});
+	return fifoQueueBase_.pushN(waitSemaphoreFunctor, memcpyPushQueueRangeFunctor, size / elementSize, count);
+}
+
 }	// namespace distortos
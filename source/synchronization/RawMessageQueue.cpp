@@ -2,7 +2,7 @@
  * \file
  * \brief RawMessageQueue class implementation
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -37,6 +37,17 @@ RawMessageQueue::RawMessageQueue(EntryStorageUniquePointer&& entryStorageUniqueP
 
 }
 
+int RawMessageQueue::commitPush(const uint8_t priority, const void* const storage)
+{
+	return messageQueueBase_.commitPush(priority, storage);
+}
+
+int RawMessageQueue::peekPop(uint8_t& priority, const void*& storage)
+{
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return messageQueueBase_.peekPop(semaphoreWaitFunctor, priority, storage);
+}
+
 int RawMessageQueue::pop(uint8_t& priority, void* const buffer, const size_t size)
 {
 	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
@@ -49,6 +60,35 @@ int RawMessageQueue::push(const uint8_t priority, const void* const data, const
 	return pushInternal(semaphoreWaitFunctor, priority, data, size);
 }
 
+int RawMessageQueue::releasePop(const void* const storage)
+{
+	return messageQueueBase_.releasePop(storage);
+}
+
+int RawMessageQueue::reservePush(void*& storage)
+{
+	const internal::SemaphoreWaitFunctor semaphoreWaitFunctor;
+	return messageQueueBase_.reservePush(semaphoreWaitFunctor, storage);
+}
+
+int RawMessageQueue::tryPeekPop(uint8_t& priority, const void*& storage)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return messageQueueBase_.peekPop(semaphoreTryWaitFunctor, priority, storage);
+}
+
+int RawMessageQueue::tryPeekPopFor(const TickClock::duration duration, uint8_t& priority, const void*& storage)
+{
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return messageQueueBase_.peekPop(semaphoreTryWaitForFunctor, priority, storage);
+}
+
+int RawMessageQueue::tryPeekPopUntil(const TickClock::time_point timePoint, uint8_t& priority, const void*& storage)
+{
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return messageQueueBase_.peekPop(semaphoreTryWaitUntilFunctor, priority, storage);
+}
+
 int RawMessageQueue::tryPop(uint8_t& priority, void* const buffer, const size_t size)
 {
 	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
@@ -89,6 +129,24 @@ int RawMessageQueue::tryPushUntil(const TickClock::time_point timePoint, const u
 	return pushInternal(semaphoreTryWaitUntilFunctor, priority, data, size);
 }
 
+int RawMessageQueue::tryReservePush(void*& storage)
+{
+	const internal::SemaphoreTryWaitFunctor semaphoreTryWaitFunctor;
+	return messageQueueBase_.reservePush(semaphoreTryWaitFunctor, storage);
+}
+
+int RawMessageQueue::tryReservePushFor(const TickClock::duration duration, void*& storage)
+{
+	const internal::SemaphoreTryWaitForFunctor semaphoreTryWaitForFunctor {duration};
+	return messageQueueBase_.reservePush(semaphoreTryWaitForFunctor, storage);
+}
+
+int RawMessageQueue::tryReservePushUntil(const TickClock::time_point timePoint, void*& storage)
+{
+	const internal::SemaphoreTryWaitUntilFunctor semaphoreTryWaitUntilFunctor {timePoint};
+	return messageQueueBase_.reservePush(semaphoreTryWaitUntilFunctor, storage);
+}
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
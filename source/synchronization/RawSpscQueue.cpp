@@ -0,0 +1,138 @@
+/**
+ * \file
+ * \brief RawSpscQueue class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/RawSpscQueue.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+RawSpscQueue::RawSpscQueue(StorageUniquePointer&& storageUniquePointer, const size_t elementSize,
+		const size_t maxElements) :
+		blockedList_{},
+		storageUniquePointer_{std::move(storageUniquePointer)},
+		readPosition_{},
+		writePosition_{},
+		elementSize_{elementSize},
+		maxElements_{maxElements}
+{
+
+}
+
+RawSpscQueue::~RawSpscQueue()
+{
+
+}
+
+int RawSpscQueue::pop(void* const buffer, const size_t size)
+{
+	return popInternal(buffer, size, nullptr);
+}
+
+int RawSpscQueue::tryPop(void* const buffer, const size_t size)
+{
+	if (size != elementSize_)
+		return EMSGSIZE;
+
+	return tryPopInternal(buffer);
+}
+
+int RawSpscQueue::tryPopFor(const TickClock::duration duration, void* const buffer, const size_t size)
+{
+	return tryPopUntil(TickClock::now() + duration + TickClock::duration{1}, buffer, size);
+}
+
+int RawSpscQueue::tryPopUntil(const TickClock::time_point timePoint, void* const buffer, const size_t size)
+{
+	return popInternal(buffer, size, &timePoint);
+}
+
+int RawSpscQueue::tryPush(const void* const data, const size_t size)
+{
+	if (size != elementSize_)
+		return EMSGSIZE;
+
+	const size_t readPosition = readPosition_;
+	const size_t writePosition = writePosition_;
+	if (isFull(readPosition, writePosition) == true)
+		return EAGAIN;
+
+	memcpy(getStorage(writePosition), data, size);
+	// element must be completely written before it is made available for the consumer
+	std::atomic_signal_fence(std::memory_order_release);
+	writePosition_ = increasePosition(writePosition);
+
+	// consumer can be blocked only if it consumed all elements preceding the one that was just pushed
+	if (readPosition_ == writePosition)
+	{
+		architecture::InterruptMaskingLock interruptMaskingLock;
+
+		if (blockedList_.empty() == false)
+			internal::getScheduler().unblock(blockedList_.begin());
+	}
+
+	return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int RawSpscQueue::popInternal(void* const buffer, const size_t size, const TickClock::time_point* const timePoint)
+{
+	if (size != elementSize_)
+		return EMSGSIZE;
+
+	while (tryPopInternal(buffer) != 0)
+	{
+		architecture::InterruptMaskingLock interruptMaskingLock;
+
+		// producer has to see the consumer on the list if it pushes the element after this check
+		if (isEmpty(readPosition_, writePosition_) == false)
+			continue;
+
+		auto& scheduler = internal::getScheduler();
+		const auto ret = timePoint == nullptr ? scheduler.block(blockedList_, ThreadState::blockedOnSpscQueue) :
+				scheduler.blockUntil(blockedList_, ThreadState::blockedOnSpscQueue, *timePoint);
+		if (ret != 0)
+			return ret;
+	}
+
+	return 0;
+}
+
+int RawSpscQueue::tryPopInternal(void* const buffer)
+{
+	const size_t readPosition = readPosition_;
+	if (isEmpty(readPosition, writePosition_) == true)
+		return EAGAIN;
+
+	std::atomic_signal_fence(std::memory_order_acquire);
+	memcpy(buffer, getStorage(readPosition), elementSize_);
+	// element must be completely read before its slot is made available for the producer
+	std::atomic_signal_fence(std::memory_order_release);
+	readPosition_ = increasePosition(readPosition);
+	return 0;
+}
+
+}	// namespace distortos
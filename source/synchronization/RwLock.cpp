@@ -0,0 +1,190 @@
+/**
+ * \file
+ * \brief RwLock class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/RwLock.hpp"
+
+#include "distortos/internal/scheduler/getScheduler.hpp"
+#include "distortos/internal/scheduler/Scheduler.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| public functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int RwLock::lock()
+{
+	return lockInternal(nullptr);
+}
+
+int RwLock::lockShared()
+{
+	return lockSharedInternal(nullptr);
+}
+
+int RwLock::tryLock()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (controlBlock_.getOwner() != nullptr || readers_ != 0)
+		return EBUSY;
+
+	controlBlock_.lock();
+	return 0;
+}
+
+int RwLock::tryLockFor(const TickClock::duration duration)
+{
+	return tryLockUntil(TickClock::now() + duration + TickClock::duration{1});
+}
+
+int RwLock::tryLockShared()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+	const auto ret = tryLockSharedInternal();
+	return ret != EDEADLK ? ret : EBUSY;
+}
+
+int RwLock::tryLockSharedFor(const TickClock::duration duration)
+{
+	return tryLockSharedUntil(TickClock::now() + duration + TickClock::duration{1});
+}
+
+int RwLock::tryLockSharedUntil(const TickClock::time_point timePoint)
+{
+	return lockSharedInternal(&timePoint);
+}
+
+int RwLock::tryLockUntil(const TickClock::time_point timePoint)
+{
+	return lockInternal(&timePoint);
+}
+
+int RwLock::unlock()
+{
+	// owner can be changed only by current owner, so this check doesn't need interrupt masking
+	if (controlBlock_.getOwner() != &internal::getScheduler().getCurrentThreadControlBlock())
+		return EPERM;
+
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	controlBlock_.unlockOrTransferLock();
+
+	return 0;
+}
+
+int RwLock::unlockShared()
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (readers_ == 0)
+		return EPERM;
+
+	--readers_;
+
+	// the last reader unblocks the writer which is waiting for readers
+	if (readers_ == 0 && writerBlockedList_.empty() == false)
+		internal::getScheduler().unblock(writerBlockedList_.begin());
+
+	return 0;
+}
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+int RwLock::lockInternal(const TickClock::time_point* const timePoint)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	int ret;
+	// break the loop when one of following conditions is true:
+	// - lock successful or deadlock detected;
+	// - lock transferred successfully;
+	// - timeout expired;
+	while ((ret = tryLockInternal()) == EBUSY &&
+			(ret = timePoint == nullptr ? controlBlock_.block() : controlBlock_.blockUntil(*timePoint)) == EINTR);
+	if (ret != 0)
+		return ret;
+
+	// the lock is owned by current thread now, so no new readers can acquire it - wait until all current readers unlock
+	auto& scheduler = internal::getScheduler();
+	while (readers_ != 0)
+	{
+		ret = timePoint == nullptr ? scheduler.block(writerBlockedList_, ThreadState::blockedOnRwLock) :
+				scheduler.blockUntil(writerBlockedList_, ThreadState::blockedOnRwLock, *timePoint);
+		if (ret != 0 && ret != EINTR)
+		{
+			controlBlock_.unlockOrTransferLock();
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+int RwLock::lockSharedInternal(const TickClock::time_point* const timePoint)
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	int ret;
+	while ((ret = tryLockSharedInternal()) == EBUSY)
+	{
+		ret = timePoint == nullptr ? controlBlock_.block() : controlBlock_.blockUntil(*timePoint);
+		if (ret == EINTR)
+			continue;
+		if (ret != 0)
+			return ret;
+
+		// lock was transferred to current thread - become a reader and pass the lock to the next blocked thread, which
+		// is either another reader (the chain continues) or a writer (which will wait for all readers to unlock)
+		++readers_;
+		controlBlock_.unlockOrTransferLock();
+		return 0;
+	}
+
+	return ret;
+}
+
+int RwLock::tryLockInternal()
+{
+	if (controlBlock_.getOwner() == nullptr)
+	{
+		controlBlock_.lock();
+		return 0;
+	}
+
+	if (controlBlock_.getOwner() == &internal::getScheduler().getCurrentThreadControlBlock())
+		return EDEADLK;
+
+	return EBUSY;
+}
+
+int RwLock::tryLockSharedInternal()
+{
+	if (controlBlock_.getOwner() == nullptr)
+	{
+		++readers_;
+		return 0;
+	}
+
+	if (controlBlock_.getOwner() == &internal::getScheduler().getCurrentThreadControlBlock())
+		return EDEADLK;
+
+	return EBUSY;
+}
+
+}	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief Semaphore class implementation
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,9 +13,16 @@
 
 #include "distortos/internal/scheduler/getScheduler.hpp"
 #include "distortos/internal/scheduler/Scheduler.hpp"
+#include "distortos/internal/scheduler/traceEvent.hpp"
 
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+#include "distortos/architecture/exclusiveAccess.hpp"
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 #include <cerrno>
 
 namespace distortos
@@ -27,26 +34,46 @@ namespace distortos
 
 int Semaphore::post()
 {
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	if (tryPostExclusive() == true)
+	{
+		internal::traceEvent(trace::EventType::semaphorePost, this);
+		return 0;
+	}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
 	if (value_ == maxValue_)
 		return EOVERFLOW;
 
 	if (blockedList_.empty() == false)
-	{
 		internal::getScheduler().unblock(blockedList_.begin());
-		return 0;
-	}
-
-	++value_;
+	else
+		++value_;
 
+	internal::traceEvent(trace::EventType::semaphorePost, this);
 	return 0;
 }
 
 int Semaphore::tryWait()
 {
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	const auto ret = tryWaitExclusive() == true ? 0 : EAGAIN;
+
+#else	// !def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	architecture::InterruptMaskingLock interruptMaskingLock;
-	return tryWaitInternal();
+	const auto ret = tryWaitInternal();
+
+#endif	// !def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	if (ret == 0)
+		internal::traceEvent(trace::EventType::semaphoreWait, this);
+	return ret;
 }
 
 int Semaphore::tryWaitFor(const TickClock::duration duration)
@@ -56,30 +83,109 @@ int Semaphore::tryWaitFor(const TickClock::duration duration)
 
 int Semaphore::tryWaitUntil(const TickClock::time_point timePoint)
 {
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	if (tryWaitExclusive() == true)
+	{
+		internal::traceEvent(trace::EventType::semaphoreWait, this);
+		return 0;
+	}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
-	const auto ret = tryWaitInternal();
-	if (ret != EAGAIN)	// lock successful?
-		return ret;
+	auto ret = tryWaitInternal();
+	if (ret == EAGAIN)	// lock not successful?
+		ret = internal::getScheduler().blockUntil(blockedList_, ThreadState::blockedOnSemaphore, timePoint);
 
-	return internal::getScheduler().blockUntil(blockedList_, ThreadState::blockedOnSemaphore, timePoint);
+	if (ret == 0)
+		internal::traceEvent(trace::EventType::semaphoreWait, this);
+	return ret;
 }
 
 int Semaphore::wait()
 {
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+	if (tryWaitExclusive() == true)
+	{
+		internal::traceEvent(trace::EventType::semaphoreWait, this);
+		return 0;
+	}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 	architecture::InterruptMaskingLock interruptMaskingLock;
 
-	const auto ret = tryWaitInternal();
-	if (ret != EAGAIN)	// lock successful?
-		return ret;
+	auto ret = tryWaitInternal();
+	if (ret == EAGAIN)	// lock not successful?
+		ret = internal::getScheduler().block(blockedList_, ThreadState::blockedOnSemaphore);
 
-	return internal::getScheduler().block(blockedList_, ThreadState::blockedOnSemaphore);
+	if (ret == 0)
+		internal::traceEvent(trace::EventType::semaphoreWait, this);
+	return ret;
 }
 
 /*---------------------------------------------------------------------------------------------------------------------+
 | private functions
 +---------------------------------------------------------------------------------------------------------------------*/
 
+int Semaphore::postInternal(const Value count)
+{
+	Value unblockCount {};
+	for (auto iterator = blockedList_.begin(); iterator != blockedList_.end() && unblockCount < count; ++iterator)
+		++unblockCount;
+
+	const auto incrementCount = count - unblockCount;
+	if (incrementCount > maxValue_ - value_)
+		return EOVERFLOW;
+
+	while (unblockCount-- != 0)
+		internal::getScheduler().unblock(blockedList_.begin());
+
+	value_ += incrementCount;
+
+	return 0;
+}
+
+#ifdef CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
+bool Semaphore::tryPostExclusive()
+{
+	Value value;
+	do
+	{
+		value = architecture::loadExclusive(value_);
+		// overflow or thread blocked on the semaphore - both are handled with interrupt masking
+		if (value == maxValue_ || blockedList_.empty() == false)
+		{
+			architecture::clearExclusive();
+			return false;
+		}
+	} while (architecture::storeExclusive(value_, value + 1) == false);
+
+	return true;
+}
+
+bool Semaphore::tryWaitExclusive()
+{
+	Value value;
+	do
+	{
+		value = architecture::loadExclusive(value_);
+		if (value == 0)	// lock not possible?
+		{
+			architecture::clearExclusive();
+			return false;
+		}
+	} while (architecture::storeExclusive(value_, value - 1) == false);
+
+	return true;
+}
+
+#endif	// def CONFIG_ARCHITECTURE_HAS_EXCLUSIVE_ACCESS
+
 int Semaphore::tryWaitInternal()
 {
 	if (value_ == 0)	// lock not possible?
@@ -90,4 +196,11 @@ int Semaphore::tryWaitInternal()
 	return 0;
 }
 
+Semaphore::Value Semaphore::tryWaitInternal(const Value count)
+{
+	const auto lockCount = value_ < count ? value_ : count;
+	value_ -= lockCount;
+	return lockCount;
+}
+
 }	// namespace distortos
@@ -2,7 +2,7 @@
  * \file
  * \brief SignalsCatcherControlBlock class implementation
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -57,8 +57,8 @@ std::pair<int, SignalInformation> acceptPendingUnblockedSignal(SignalsReceiverCo
 		return {EAGAIN, SignalInformation{uint8_t{}, SignalInformation::Code{}, sigval{}}};
 
 	const auto pendingUnblockedValue = pendingUnblockedBitset.to_ulong();
-	static_assert(sizeof(pendingUnblockedValue) == pendingUnblockedBitset.size() / 8,
-			"Size of pendingUnblockedValue doesn't match size of pendingUnblockedBitset!");
+	static_assert(sizeof(pendingUnblockedValue) >= pendingUnblockedBitset.size() / 8,
+			"Size of pendingUnblockedValue is too small for size of pendingUnblockedBitset!");
 	// GCC builtin - "find first set" - https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
 	const auto signalNumber = __builtin_ffsl(pendingUnblockedValue) - 1;
 
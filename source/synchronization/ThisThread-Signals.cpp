@@ -2,7 +2,7 @@
  * \file
  * \brief ThisThread::Signals namespace implementation
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -122,8 +122,8 @@ std::pair<int, SignalInformation> waitImplementation(const SignalSet& signalSet,
 	}
 
 	const auto intersectionValue = intersection.to_ulong();
-	static_assert(sizeof(intersectionValue) == intersection.size() / 8,
-			"Size of intersectionValue doesn't match size of intersection!");
+	static_assert(sizeof(intersectionValue) >= intersection.size() / 8,
+			"Size of intersectionValue is too small for size of intersection!");
 	// GCC builtin - "find first set" - https://gcc.gnu.org/onlinedocs/gcc/Other-Builtins.html
 	const auto signalNumber = __builtin_ffsl(intersectionValue) - 1;
 	return signalsReceiverControlBlock->acceptPendingSignal(signalNumber);
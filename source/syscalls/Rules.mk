@@ -7,14 +7,20 @@
 # distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 #
 
+# newlib's system calls and locks - host's C library provides its own implementation
+ifneq ($(CONFIG_ARCHITECTURE_POSIX),y)
+
 #-----------------------------------------------------------------------------------------------------------------------
 # compilation flags
 #-----------------------------------------------------------------------------------------------------------------------
 
 CXXFLAGS_$(d) := $(CXXFLAGS_$(d)) $(STANDARD_INCLUDES)
+CXXFLAGS_$(d) := $(CXXFLAGS_$(d)) $(ARCHITECTURE_INCLUDES)
 
 #-----------------------------------------------------------------------------------------------------------------------
 # standard footer
 #-----------------------------------------------------------------------------------------------------------------------
 
 include $(DISTORTOS_PATH)footer.mk
+
+endif	# neq ($(CONFIG_ARCHITECTURE_POSIX),y)
@@ -7,6 +7,12 @@
 -- distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
 --
 
-CXXFLAGS += STANDARD_INCLUDES
+-- newlib's system calls and locks - host's C library provides its own implementation
+if CONFIG_ARCHITECTURE_POSIX ~= "y" then
 
-tup.include(DISTORTOS_TOP .. "compile.lua")
+	CXXFLAGS += STANDARD_INCLUDES
+	CXXFLAGS += ARCHITECTURE_INCLUDES
+
+	tup.include(DISTORTOS_TOP .. "compile.lua")
+
+end	-- if CONFIG_ARCHITECTURE_POSIX ~= "y" then
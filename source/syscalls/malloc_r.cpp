@@ -0,0 +1,173 @@
+/**
+ * \file
+ * \brief _malloc_r(), _calloc_r(), _realloc_r(), _memalign_r(), _malloc_usable_size_r() and _free_r() system calls
+ * implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "distortos/internal/memory/getMallocHeap.hpp"
+
+#ifdef CONFIG_TLSF_HEAP_ENABLE
+
+#include "distortos/TlsfHeap.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include <algorithm>
+
+#include <cerrno>
+#include <cstring>
+
+extern "C"
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Allocates block from the heap.
+ *
+ * This version of _malloc_r() replaces newlib's allocator with TlsfHeap.
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure
+ * \param [in] size is the size of requested block, bytes
+ *
+ * \return pointer to allocated block, nullptr if block could not be allocated
+ */
+
+void* _malloc_r(_reent* const reent, const size_t size)
+{
+	void* block;
+
+	{
+		distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+		block = distortos::internal::getMallocHeap().allocate(size);
+	}
+
+	if (block == nullptr)
+		reent->_errno = ENOMEM;
+
+	return block;
+}
+
+/**
+ * \brief Allocates block for an array from the heap and fills it with zeros.
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure
+ * \param [in] elements is the number of elements in array
+ * \param [in] elementSize is the size of single element, bytes
+ *
+ * \return pointer to allocated block, nullptr if block could not be allocated
+ */
+
+void* _calloc_r(_reent* const reent, const size_t elements, const size_t elementSize)
+{
+	const auto size = elements * elementSize;
+	if (elementSize != 0 && size / elementSize != elements)	// overflow?
+	{
+		reent->_errno = ENOMEM;
+		return nullptr;
+	}
+
+	const auto block = _malloc_r(reent, size);
+	if (block != nullptr)
+		memset(block, 0, size);
+
+	return block;
+}
+
+/**
+ * \brief Returns block to the heap.
+ *
+ * \param [in] block is a pointer to block previously allocated from the heap, nullptr is ignored
+ */
+
+void _free_r(_reent*, void* const block)
+{
+	distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+	distortos::internal::getMallocHeap().deallocate(block);
+}
+
+/**
+ * \param [in] block is a pointer to block previously allocated from the heap
+ *
+ * \return usable size of \a block, bytes, 0 if \a block is nullptr
+ */
+
+size_t _malloc_usable_size_r(_reent*, void* const block)
+{
+	return block != nullptr ? distortos::TlsfHeap::getUsableSize(block) : 0;
+}
+
+/**
+ * \brief Allocates block with given alignment from the heap.
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure
+ * \param [in] alignment is the required alignment of block, bytes, must be a power of 2
+ * \param [in] size is the size of requested block, bytes
+ *
+ * \return pointer to allocated block, nullptr if block could not be allocated
+ */
+
+void* _memalign_r(_reent* const reent, const size_t alignment, const size_t size)
+{
+	void* block;
+
+	{
+		distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+		block = distortos::internal::getMallocHeap().allocateAligned(alignment, size);
+	}
+
+	if (block == nullptr)
+		reent->_errno = ENOMEM;
+
+	return block;
+}
+
+/**
+ * \brief Changes size of block allocated from the heap.
+ *
+ * Block is resized in place if possible, otherwise new block is allocated, contents are copied and old block is freed.
+ *
+ * \param [in] reent is a pointer to newlib's reentrancy structure
+ * \param [in] block is a pointer to block previously allocated from the heap, nullptr is equivalent to _malloc_r()
+ * \param [in] size is the new size of block, bytes, 0 is equivalent to _free_r() (for non-nullptr \a block)
+ *
+ * \return pointer to resized block, nullptr if block could not be resized (in that case \a block is not modified)
+ */
+
+void* _realloc_r(_reent* const reent, void* const block, const size_t size)
+{
+	if (block == nullptr)
+		return _malloc_r(reent, size);
+
+	if (size == 0)
+	{
+		_free_r(reent, block);
+		return nullptr;
+	}
+
+	{
+		distortos::architecture::InterruptMaskingLock interruptMaskingLock;
+		if (distortos::internal::getMallocHeap().resize(block, size) == true)
+			return block;
+	}
+
+	const auto newBlock = _malloc_r(reent, size);
+	if (newBlock == nullptr)
+		return nullptr;
+
+	memcpy(newBlock, block, std::min(distortos::TlsfHeap::getUsableSize(block), size));
+	_free_r(reent, block);
+	return newBlock;
+}
+
+}	// extern "C"
+
+#endif	// def CONFIG_TLSF_HEAP_ENABLE
@@ -2,13 +2,18 @@
  * \file
  * \brief _sbrk_r() system call implementation
  *
- * \author Copyright (C) 2014 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
  * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
  */
 
+#include "distortos/distortosConfiguration.h"
+
+// with TlsfHeap the heap area is managed directly, there's no need to "increase program data space"
+#ifndef CONFIG_TLSF_HEAP_ENABLE
+
 #include <cerrno>
 #include <cstdint>
 
@@ -49,3 +54,5 @@ void* _sbrk_r(_reent*, const intptr_t size)
 }
 
 }	// extern "C"
+
+#endif	// !def CONFIG_TLSF_HEAP_ENABLE
@@ -93,6 +93,34 @@ uint8_t DynamicThread::getPriority() const
 	return detachableThread_->getPriority();
 }
 
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+uint64_t DynamicThread::getRunTime() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getRunTime();
+}
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+
+size_t DynamicThread::getStackHighWaterMark() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	if (detachableThread_ == nullptr)
+		return {};
+
+	return detachableThread_->getStackHighWaterMark();
+}
+
+#endif	// def CONFIG_STACK_PAINTING_ENABLE
+
 SchedulingPolicy DynamicThread::getSchedulingPolicy() const
 {
 	architecture::InterruptMaskingLock interruptMaskingLock;
@@ -52,6 +52,20 @@ int DynamicThreadBase::detach()
 
 #endif	// def CONFIG_THREAD_DETACH_ENABLE
 
+/*---------------------------------------------------------------------------------------------------------------------+
+| public static functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+#ifdef CONFIG_THREAD_DETACH_ENABLE
+
+void* DynamicThreadBase::operator new(const size_t size, MemoryResource& memoryResource)
+{
+	getDeferredThreadDeleter().tryCleanup();	// errors are not important - cleanup will be retried by idle thread
+	return allocateStorage(memoryResource, size);
+}
+
+#endif	// def CONFIG_THREAD_DETACH_ENABLE
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | protected static functions
 +---------------------------------------------------------------------------------------------------------------------*/
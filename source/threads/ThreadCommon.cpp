@@ -71,6 +71,28 @@ uint8_t ThreadCommon::getPriority() const
 	return getThreadControlBlock().getPriority();
 }
 
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+uint64_t ThreadCommon::getRunTime() const
+{
+	architecture::InterruptMaskingLock interruptMaskingLock;
+
+	// time since previous measurement is not yet charged if this is the current thread
+	internal::getScheduler().updateRunTime();
+	return getThreadControlBlock().getRunTime();
+}
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+
+size_t ThreadCommon::getStackHighWaterMark() const
+{
+	return getThreadControlBlock().getStack().getHighWaterMark();
+}
+
+#endif	// def CONFIG_STACK_PAINTING_ENABLE
+
 SchedulingPolicy ThreadCommon::getSchedulingPolicy() const
 {
 	return getThreadControlBlock().getSchedulingPolicy();
@@ -19,6 +19,8 @@
 #include "distortos/statistics.hpp"
 #include "distortos/ThisThread.hpp"
 
+#include <array>
+
 namespace distortos
 {
 
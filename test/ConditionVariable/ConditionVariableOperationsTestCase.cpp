@@ -21,6 +21,8 @@
 #include "distortos/StaticSoftwareTimer.hpp"
 #include "distortos/statistics.hpp"
 
+#include <array>
+
 #include <cerrno>
 
 namespace distortos
@@ -62,11 +64,28 @@ constexpr decltype(statistics::getContextSwitchCount()) phase1WaitForUntilContex
 /// (test -> main)
 constexpr decltype(statistics::getContextSwitchCount()) phase2ThreadContextSwitchCount {5};
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// expected number of context switches in phase3 block involving software timer (excluding waitForNextTick() and
+/// testMutexAndUnlock()): 1 - main thread blocks on condition variable (main -> idle), 2 - software timer thread is
+/// woken by interrupt (idle -> software timer thread), 3 - main thread is unblocked by software timer thread, which
+/// then waits for next software timer (software timer thread -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase3SoftwareTimerContextSwitchCount {3};
+
+#else	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 /// expected number of context switches in phase3 block involving software timer (excluding waitForNextTick() and
 /// testMutexAndUnlock()): 1 - main thread blocks on condition variable (main -> idle), 2 - main thread is unblocked by
 /// interrupt (idle -> main)
 constexpr decltype(statistics::getContextSwitchCount()) phase3SoftwareTimerContextSwitchCount {2};
 
+#endif	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// expected number of context switches in phase4 block involving test thread (excluding testMutexAndUnlock()): 1 - main
+/// thread blocks on condition variable (main -> test), 2 - test thread unlocks the mutex and transfers it to main
+/// thread (test -> main), 3 - main thread joins test thread (main -> test), 4 - test thread terminates (test -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase4ThreadContextSwitchCount {4};
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | local functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -353,6 +372,77 @@ bool phase3(Mutex& mutex)
 	return true;
 }
 
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests notification from thread which holds the mutex. Main (current) thread waits for condition variable notification
+ * (using wait() and waitUntil()). Test thread with lower priority locks the mutex, notifies one waiter and unlocks the
+ * mutex. Main thread is expected to be moved directly to the list of threads blocked on the mutex, so it is not woken
+ * up until the mutex is unlocked and it acquires ownership of the mutex without blocking again.
+ *
+ * \param [in] mutex is a reference to mutex used with condition variable, must be unlocked
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4(Mutex& mutex)
+{
+	constexpr size_t testThreadStackSize {512};
+
+	ConditionVariable conditionVariable;
+
+	const auto notifyFunctor = [&conditionVariable, &mutex]()
+			{
+				mutex.lock();
+				conditionVariable.notifyOne();
+				mutex.unlock();
+			};
+
+	{
+		const auto ret = mutex.lock();
+		if (ret != 0)
+			return false;
+	}
+
+	{
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		auto thread = makeAndStartDynamicThread({testThreadStackSize, 1}, notifyFunctor);
+
+		// wait() should succeed after test thread unlocks the mutex
+		const auto ret = conditionVariable.wait(mutex);
+
+		thread.join();
+		const auto contextSwitches = statistics::getContextSwitchCount() - contextSwitchCount;
+
+		const auto mutexTest = testMutexAndUnlock(mutex);
+		if (ret != 0 || mutexTest != true || contextSwitches != phase4ThreadContextSwitchCount)
+			return false;
+	}
+
+	{
+		const auto ret = mutex.lock();
+		if (ret != 0)
+			return false;
+	}
+
+	{
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		auto thread = makeAndStartDynamicThread({testThreadStackSize, 1}, notifyFunctor);
+
+		// waitUntil() should succeed after test thread unlocks the mutex
+		const auto ret = conditionVariable.waitUntil(mutex, TickClock::now() + longDuration);
+
+		thread.join();
+		const auto contextSwitches = statistics::getContextSwitchCount() - contextSwitchCount;
+
+		const auto mutexTest = testMutexAndUnlock(mutex);
+		if (ret != 0 || mutexTest != true || contextSwitches != phase4ThreadContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -381,13 +471,15 @@ bool ConditionVariableOperationsTestCase::run_() const
 			phase2ThreadContextSwitchCount + testMutexAndUnlockContextSwitchCount);
 	constexpr auto phase3ExpectedContextSwitchCount = 3 * (waitForNextTickContextSwitchCount +
 			phase3SoftwareTimerContextSwitchCount + testMutexAndUnlockContextSwitchCount);
+	constexpr auto phase4ExpectedContextSwitchCount = 2 * (phase4ThreadContextSwitchCount +
+			testMutexAndUnlockContextSwitchCount);
 	constexpr auto expectedContextSwitchCount = parametersArray.size() * (phase1ExpectedContextSwitchCount +
-			phase2ExpectedContextSwitchCount + phase3ExpectedContextSwitchCount);
+			phase2ExpectedContextSwitchCount + phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount);
 
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
 	for (const auto& parameters : parametersArray)
-		for (const auto& function : {phase1, phase2, phase3})
+		for (const auto& function : {phase1, phase2, phase3, phase4})
 		{
 			Mutex mutex {std::get<0>(parameters), std::get<1>(parameters), std::get<2>(parameters)};
 			const auto ret = function(mutex);
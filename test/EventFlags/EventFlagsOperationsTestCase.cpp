@@ -0,0 +1,373 @@
+/**
+ * \file
+ * \brief EventFlagsOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "EventFlagsOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/EventFlags.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+
+#include <array>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// expected number of context switches in blocks involving timed-out wait (excluding waitForNextTick()): 1 - main
+/// thread blocks on event flags (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) blockingWaitContextSwitchCount {2};
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// expected number of context switches in blocks involving software timer which satisfies the wait (excluding
+/// waitForNextTick()): 1 - main thread blocks on event flags (main -> idle), 2 - software timer thread is woken by
+/// interrupt (idle -> software timer thread), 3 - main thread is unblocked by software timer thread, which then waits
+/// for next software timer (software timer thread -> main)
+constexpr decltype(statistics::getContextSwitchCount()) softwareTimerWaitContextSwitchCount {3};
+
+/// expected number of context switches in blocks involving software timer which doesn't satisfy the wait (excluding
+/// waitForNextTick()): 1 - main thread blocks on event flags (main -> idle), 2 - software timer thread is woken by
+/// interrupt (idle -> software timer thread), 3 - software timer thread waits for next software timer (software timer
+/// thread -> idle), 4 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) softwareTimerTimedOutWaitContextSwitchCount {4};
+
+#else	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// expected number of context switches in blocks involving software timer which satisfies the wait (excluding
+/// waitForNextTick()): 1 - main thread blocks on event flags (main -> idle), 2 - main thread is unblocked by interrupt
+/// (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) softwareTimerWaitContextSwitchCount {2};
+
+/// expected number of context switches in blocks involving software timer which doesn't satisfy the wait (excluding
+/// waitForNextTick()): 1 - main thread blocks on event flags (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) softwareTimerTimedOutWaitContextSwitchCount {2};
+
+#endif	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// size of stack of test threads, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests set(), clear() and all non-blocking functions.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	EventFlags eventFlags;
+
+	if (eventFlags.get() != 0 || eventFlags.tryWaitAny(0).first != EINVAL || eventFlags.tryWaitAll(0).first != EINVAL)
+		return false;
+
+	{
+		const auto ret = eventFlags.tryWaitAny(0b1);
+		if (ret.first != EAGAIN || ret.second != 0)
+			return false;
+	}
+
+	if (eventFlags.set(0b101) != 0 || eventFlags.set(0b1000) != 0b101 || eventFlags.get() != 0b1101)
+		return false;
+
+	{
+		const auto ret = eventFlags.tryWaitAll(0b111);
+		if (ret.first != EAGAIN || ret.second != 0b1101)
+			return false;
+	}
+
+	{
+		const auto ret = eventFlags.tryWaitAll(0b101);
+		if (ret.first != 0 || ret.second != 0b1101 || eventFlags.get() != 0b1101)
+			return false;
+	}
+
+	{
+		// only flags selected by bitmask are cleared automatically
+		const auto ret = eventFlags.tryWaitAny(0b110, true);
+		if (ret.first != 0 || ret.second != 0b1101 || eventFlags.get() != 0b1001)
+			return false;
+	}
+
+	{
+		const auto ret = eventFlags.tryWaitAll(0b1001, true);
+		if (ret.first != 0 || ret.second != 0b1001 || eventFlags.get() != 0)
+			return false;
+	}
+
+	return eventFlags.set(0b11) == 0 && eventFlags.clear(0b10) == 0b11 && eventFlags.get() == 0b1;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests timeouts of tryWaitAnyFor(), tryWaitAnyUntil(), tryWaitAllFor() and tryWaitAllUntil().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	EventFlags eventFlags {0b1};
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto start = TickClock::now();
+		const auto ret = eventFlags.tryWaitAnyFor(singleDuration, 0b110);
+		const auto realDuration = TickClock::now() - start;
+		if (ret.first != ETIMEDOUT || ret.second != 0b1 || realDuration != singleDuration + decltype(singleDuration){1}
+				|| statistics::getContextSwitchCount() - contextSwitchCount != blockingWaitContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		const auto ret = eventFlags.tryWaitAllUntil(requestedTimePoint, 0b11, true);
+		if (ret.first != ETIMEDOUT || ret.second != 0b1 || requestedTimePoint != TickClock::now() ||
+				eventFlags.get() != 0b1 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != blockingWaitContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests interrupt -> thread communication - flags are set by software timer, waitAll(), tryWaitAllFor() and
+ * tryWaitAnyUntil() must be satisfied only when expected flags are set.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	EventFlags eventFlags {0b1};
+	EventFlags::Value timerBitmask {};
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&eventFlags, &timerBitmask]()
+			{
+				eventFlags.set(timerBitmask);
+			});
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		timerBitmask = 0b10;
+		softwareTimer.start(wakeUpTimePoint);
+
+		const auto ret = eventFlags.waitAll(0b11, true);
+		if (ret.first != 0 || ret.second != 0b11 || wakeUpTimePoint != TickClock::now() || eventFlags.get() != 0 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != softwareTimerWaitContextSwitchCount)
+			return false;
+	}
+
+	{
+		// flag set by software timer does not satisfy the wait, so it should time-out
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto start = TickClock::now();
+		timerBitmask = 0b100;
+		softwareTimer.start(start + singleDuration);
+
+		const auto ret = eventFlags.tryWaitAllFor(longDuration, 0b110);
+		const auto realDuration = TickClock::now() - start;
+		if (ret.first != ETIMEDOUT || ret.second != 0b100 || realDuration != longDuration + decltype(longDuration){1} ||
+				eventFlags.get() != 0b100 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != softwareTimerTimedOutWaitContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		timerBitmask = 0b1000;
+		softwareTimer.start(wakeUpTimePoint);
+
+		const auto ret = eventFlags.tryWaitAnyUntil(wakeUpTimePoint + longDuration, 0b1001);
+		if (ret.first != 0 || ret.second != 0b1100 || wakeUpTimePoint != TickClock::now() ||
+				eventFlags.get() != 0b1100 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != softwareTimerWaitContextSwitchCount)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests single set() with many waiting threads. Flags cleared automatically must be delivered only to the thread with
+ * the highest priority (regardless of the order in which threads started waiting), while all threads which don't
+ * clear flags and have satisfied conditions must be unblocked by the same set().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	EventFlags eventFlags;
+
+	const auto waitFunctor = [&eventFlags](const EventFlags::Value bitmask, const bool all, const bool autoClear,
+			EventFlags::Value& value)
+			{
+				const auto ret = all == true ? eventFlags.waitAll(bitmask, autoClear) :
+						eventFlags.waitAny(bitmask, autoClear);
+				value = ret.first == 0 ? ret.second : ~EventFlags::Value{};
+			};
+
+	std::array<EventFlags::Value, 4> values {};
+	// threads with priority higher than main thread start immediately and block on event flags
+	std::array<DynamicThread, 4> threads
+	{{
+			makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX - 1}, waitFunctor, 0b1, false, true,
+					std::ref(values[0])),
+			makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, waitFunctor, 0b1, false, true,
+					std::ref(values[1])),
+			makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, waitFunctor, 0b10, false, false,
+					std::ref(values[2])),
+			makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX - 1}, waitFunctor, 0b110, true, false,
+					std::ref(values[3])),
+	}};
+
+	for (auto& thread : threads)
+		if (thread.getState() != ThreadState::blockedOnEventFlags)
+			return false;
+
+	// only thread with the highest priority gets the flag, which is then cleared
+	eventFlags.set(0b1);
+	if (threads[1].getState() != ThreadState::terminated || values[1] != 0b1 ||
+			threads[0].getState() != ThreadState::blockedOnEventFlags || eventFlags.get() != 0)
+		return false;
+
+	// flags which are not cleared are delivered to all threads with satisfied conditions
+	eventFlags.set(0b110);
+	if (threads[2].getState() != ThreadState::terminated || values[2] != 0b110 ||
+			threads[3].getState() != ThreadState::terminated || values[3] != 0b110 ||
+			threads[0].getState() != ThreadState::blockedOnEventFlags || eventFlags.get() != 0b110)
+		return false;
+
+	eventFlags.set(0b1);
+	if (threads[0].getState() != ThreadState::terminated || values[0] != 0b111 || eventFlags.get() != 0b110)
+		return false;
+
+	for (auto& thread : threads)
+		thread.join();
+
+	return true;
+}
+
+/**
+ * \brief Phase 5 of test case.
+ *
+ * Tests set() with threads which change their priorities while waiting. Flags cleared automatically must be delivered
+ * to the thread with the highest current priority, not the one which had the highest priority when it started waiting.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase5()
+{
+	EventFlags eventFlags;
+
+	const auto waitFunctor = [&eventFlags](EventFlags::Value& value)
+			{
+				const auto ret = eventFlags.waitAny(0b1, true);
+				value = ret.first == 0 ? ret.second : ~EventFlags::Value{};
+			};
+
+	std::array<EventFlags::Value, 2> values {};
+	// threads with priority higher than main thread start immediately and block on event flags
+	std::array<DynamicThread, 2> threads
+	{{
+			makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX - 1}, waitFunctor, std::ref(values[0])),
+			makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX - 2}, waitFunctor, std::ref(values[1])),
+	}};
+
+	for (auto& thread : threads)
+		if (thread.getState() != ThreadState::blockedOnEventFlags)
+			return false;
+
+	threads[1].setPriority(UINT8_MAX);
+
+	// thread which raised its priority gets the flag, which is then cleared
+	eventFlags.set(0b1);
+	if (threads[1].getState() != ThreadState::terminated || values[1] != 0b1 ||
+			threads[0].getState() != ThreadState::blockedOnEventFlags || eventFlags.get() != 0)
+		return false;
+
+	eventFlags.set(0b1);
+	if (threads[0].getState() != ThreadState::terminated || values[0] != 0b1 || eventFlags.get() != 0)
+		return false;
+
+	for (auto& thread : threads)
+		thread.join();
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool EventFlagsOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3, phase4, phase5})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,306 @@
+/**
+ * \file
+ * \brief MemoryPoolOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MemoryPoolOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicMemoryPool.hpp"
+#include "distortos/StaticMemoryPool.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+
+#include <array>
+
+#include <cerrno>
+#include <cstring>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// requested size of block used in tests, bytes
+constexpr size_t blockSize {MemoryPool::alignment + 1};
+
+/// number of blocks in pools used in tests
+constexpr size_t blocks {4};
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// expected number of context switches in blocks involving timed-out allocation (excluding waitForNextTick()): 1 - main
+/// thread blocks on memory pool (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) blockingAllocationContextSwitchCount {2};
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// expected number of context switches in blocks involving software timer (excluding waitForNextTick()): 1 - main
+/// thread blocks on memory pool (main -> idle), 2 - software timer thread is woken by interrupt (idle -> software timer
+/// thread), 3 - main thread is unblocked by software timer thread, which then waits for next software timer (software
+/// timer thread -> main)
+constexpr decltype(statistics::getContextSwitchCount()) softwareTimerAllocationContextSwitchCount {3};
+
+#else	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// expected number of context switches in blocks involving software timer (excluding waitForNextTick()): 1 - main
+/// thread blocks on memory pool (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) softwareTimerAllocationContextSwitchCount {2};
+
+#endif	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests non-blocking allocation, deallocation and usage statistics of a memory pool.
+ *
+ * \param [in] memoryPool is a reference to tested memory pool, it must be unused and have \a blocks blocks, each with
+ * requested size of \a blockSize
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testNonBlocking(MemoryPool& memoryPool)
+{
+	if (memoryPool.getBlockSize() != MemoryPool::alignment * 2 || memoryPool.getCapacity() != blocks ||
+			memoryPool.getUsedCount() != 0 || memoryPool.getMaxUsedCount() != 0)
+		return false;
+
+	std::array<void*, blocks> allocated {};
+	for (size_t i {}; i < allocated.size(); ++i)
+	{
+		if (memoryPool.tryAllocate(allocated[i]) != 0 ||
+				reinterpret_cast<uintptr_t>(allocated[i]) % MemoryPool::alignment != 0 ||
+				memoryPool.getUsedCount() != i + 1 || memoryPool.getMaxUsedCount() != i + 1)
+			return false;
+
+		// whole block must be usable
+		memset(allocated[i], static_cast<int>(i), memoryPool.getBlockSize());
+
+		for (size_t j {}; j < i; ++j)
+			if (allocated[i] == allocated[j])
+				return false;
+	}
+
+	{
+		void* block {};
+		if (memoryPool.tryAllocate(block) != EAGAIN || block != nullptr)
+			return false;
+	}
+
+	if (memoryPool.free(nullptr) != EINVAL || memoryPool.free(static_cast<uint8_t*>(allocated[0]) + 1) != EINVAL ||
+			memoryPool.free(static_cast<uint8_t*>(allocated[0]) - memoryPool.getBlockSize()) != EINVAL ||
+			memoryPool.free(static_cast<uint8_t*>(allocated[0]) + memoryPool.getBlockSize() * blocks) != EINVAL)
+		return false;
+
+	for (size_t i {}; i < allocated.size(); ++i)
+		if (memoryPool.free(allocated[i]) != 0 || memoryPool.getUsedCount() != blocks - i - 1 ||
+				memoryPool.getMaxUsedCount() != blocks)
+			return false;
+
+	{
+		// the most recently freed block is reused first
+		void* block {};
+		if (memoryPool.tryAllocate(block) != 0 || block != allocated.back() || memoryPool.free(block) != 0)
+			return false;
+	}
+
+	// double free must be rejected without corrupting the pool, also when other blocks are allocated
+	if (memoryPool.free(allocated.back()) != EINVAL || memoryPool.getUsedCount() != 0)
+		return false;
+
+	{
+		void* block1 {};
+		void* block2 {};
+		if (memoryPool.tryAllocate(block1) != 0 || memoryPool.tryAllocate(block2) != 0 ||
+				memoryPool.free(block1) != 0 || memoryPool.free(block1) != EINVAL || memoryPool.getUsedCount() != 1)
+			return false;
+
+		void* block3 {};
+		void* block4 {};
+		if (memoryPool.tryAllocate(block3) != 0 || memoryPool.tryAllocate(block4) != 0 || block3 != block1 ||
+				block4 == block1 || block4 == block2 || memoryPool.free(block2) != 0 || memoryPool.free(block3) != 0 ||
+				memoryPool.free(block4) != 0)
+			return false;
+	}
+
+	for (auto& block : allocated)
+		if (memoryPool.tryAllocate(block) != 0)
+			return false;
+
+	{
+		void* block {};
+		if (memoryPool.tryAllocate(block) != EAGAIN)
+			return false;
+	}
+
+	for (const auto block : allocated)
+		if (memoryPool.free(block) != 0)
+			return false;
+
+	return memoryPool.getUsedCount() == 0 && memoryPool.getMaxUsedCount() == blocks;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests non-blocking allocation, deallocation and usage statistics of StaticMemoryPool and DynamicMemoryPool.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	{
+		StaticMemoryPool<blockSize, blocks> memoryPool;
+		if (testNonBlocking(memoryPool) != true)
+			return false;
+	}
+
+	{
+		DynamicMemoryPool memoryPool {blockSize, blocks};
+		if (testNonBlocking(memoryPool) != true)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests timeouts of tryAllocateFor() and tryAllocateUntil() when the pool is empty.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	StaticMemoryPool<blockSize, 1> memoryPool;
+	void* allocated {};
+	if (memoryPool.tryAllocate(allocated) != 0)
+		return false;
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto start = TickClock::now();
+		void* block {};
+		const auto ret = memoryPool.tryAllocateFor(singleDuration, block);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != ETIMEDOUT || block != nullptr || realDuration != singleDuration + decltype(singleDuration){1} ||
+				statistics::getContextSwitchCount() - contextSwitchCount != blockingAllocationContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		void* block {};
+		const auto ret = memoryPool.tryAllocateUntil(requestedTimePoint, block);
+		if (ret != ETIMEDOUT || block != nullptr || requestedTimePoint != TickClock::now() ||
+				statistics::getContextSwitchCount() - contextSwitchCount != blockingAllocationContextSwitchCount)
+			return false;
+	}
+
+	return memoryPool.getUsedCount() == 1 && memoryPool.free(allocated) == 0;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests interrupt -> thread communication - block is freed by software timer, allocate() and tryAllocateFor() must be
+ * unblocked and get this block.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	StaticMemoryPool<blockSize, 1> memoryPool;
+	void* allocated {};
+	if (memoryPool.tryAllocate(allocated) != 0)
+		return false;
+
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&memoryPool, &allocated]()
+			{
+				memoryPool.free(allocated);
+			});
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		softwareTimer.start(wakeUpTimePoint);
+
+		void* block {};
+		const auto ret = memoryPool.allocate(block);
+		if (ret != 0 || block != allocated || wakeUpTimePoint != TickClock::now() || memoryPool.getUsedCount() != 1 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != softwareTimerAllocationContextSwitchCount)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto wakeUpTimePoint = TickClock::now() + singleDuration;
+		softwareTimer.start(wakeUpTimePoint);
+
+		void* block {};
+		const auto ret = memoryPool.tryAllocateFor(longDuration, block);
+		if (ret != 0 || block != allocated || wakeUpTimePoint != TickClock::now() || memoryPool.getUsedCount() != 1 ||
+				statistics::getContextSwitchCount() - contextSwitchCount != softwareTimerAllocationContextSwitchCount)
+			return false;
+	}
+
+	return memoryPool.free(allocated) == 0 && memoryPool.getMaxUsedCount() == 1;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MemoryPoolOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,440 @@
+/**
+ * \file
+ * \brief MemoryResourceOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MemoryResourceOperationsTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#include "distortos/DynamicFifoQueue.hpp"
+#include "distortos/DynamicMemoryPool.hpp"
+#include "distortos/DynamicMessageQueue.hpp"
+#include "distortos/DynamicRawFifoQueue.hpp"
+#include "distortos/DynamicRawMessageQueue.hpp"
+#include "distortos/DynamicRawSpscQueue.hpp"
+#include "distortos/DynamicSignalsReceiver.hpp"
+#include "distortos/DynamicThread.hpp"
+#include "distortos/RecyclingMemoryResource.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/ThisThread-Signals.hpp"
+#include "distortos/TlsfHeap.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// TestMemoryResource class is a MemoryResource with TlsfHeap in its own buffer, which checks deallocations
+class TestMemoryResource : public MemoryResource
+{
+public:
+
+	/**
+	 * \brief TestMemoryResource's constructor
+	 */
+
+	TestMemoryResource() :
+			buffer_{},
+			tlsfHeap_{},
+			valid_{true}
+	{
+		tlsfHeap_.addRegion(buffer_, sizeof(buffer_));
+	}
+
+	/**
+	 * \param [in] storage is a pointer to storage
+	 *
+	 * \return true if \a storage is inside the buffer of this resource, false otherwise
+	 */
+
+	bool contains(const void* const storage) const
+	{
+		return storage >= buffer_ && storage < buffer_ + sizeof(buffer_);
+	}
+
+	/**
+	 * \return number of blocks currently allocated from this resource
+	 */
+
+	size_t getUsedBlocks() const
+	{
+		return tlsfHeap_.getStatistics().usedBlocks;
+	}
+
+	/**
+	 * \return true if all deallocations so far were done with arguments matching the allocations, false otherwise
+	 */
+
+	bool isValid() const
+	{
+		return valid_;
+	}
+
+private:
+
+	/**
+	 * \brief Allocates storage from TlsfHeap.
+	 *
+	 * \param [in] size is the size of requested storage, bytes
+	 * \param [in] alignment is the required alignment of storage, bytes, a power of 2
+	 *
+	 * \return pointer to allocated storage, nullptr if storage could not be allocated
+	 */
+
+	void* doAllocate(const size_t size, const size_t alignment) override
+	{
+		return tlsfHeap_.allocateAligned(alignment, size);
+	}
+
+	/**
+	 * \brief Returns storage to TlsfHeap.
+	 *
+	 * \param [in] storage is a pointer to storage previously allocated from this resource
+	 * \param [in] size is the size of \a storage, bytes
+	 * \param [in] alignment is the alignment of \a storage, bytes
+	 */
+
+	void doDeallocate(void* const storage, const size_t size, const size_t alignment) override
+	{
+		if (contains(storage) == false || TlsfHeap::getUsableSize(storage) < size ||
+				reinterpret_cast<uintptr_t>(storage) % alignment != 0)
+			valid_ = false;
+
+		tlsfHeap_.deallocate(storage);
+	}
+
+	/// buffer for TlsfHeap
+	alignas(TlsfHeap::alignment) uint8_t buffer_[8192];
+
+	/// heap which manages \a buffer_
+	TlsfHeap tlsfHeap_;
+
+	/// true if all deallocations so far were done with arguments matching the allocations, false otherwise
+	bool valid_;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// number of allocations done for internal thread object
+#ifdef CONFIG_THREAD_DETACH_ENABLE
+constexpr size_t threadObjectAllocations {1};
+#else	// !def CONFIG_THREAD_DETACH_ENABLE
+constexpr size_t threadObjectAllocations {0};
+#endif	// !def CONFIG_THREAD_DETACH_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// memory resource used in tests
+TestMemoryResource memoryResource;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Test thread function which queues a signal to itself and accepts it.
+ *
+ * \param [out] value is a reference to variable which will be set to the value of accepted signal
+ */
+
+void signalsThread(int& value)
+{
+	if (ThisThread::Signals::queueSignal(1, sigval{0x5a}) != 0)
+		return;
+
+	const auto waitResult = ThisThread::Signals::tryWait(SignalSet{1 << 1});
+	if (waitResult.first == 0)
+		value = waitResult.second.getValue().sival_int;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether storage of queues and memory pool is allocated from and returned to the memory resource given in the
+ * constructor.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	{
+		DynamicRawFifoQueue rawFifoQueue {memoryResource, sizeof(int), 2};
+		int value {0x12};
+		if (memoryResource.getUsedBlocks() != 1 || rawFifoQueue.tryPush(value) != 0 ||
+				rawFifoQueue.tryPop(value) != 0 || value != 0x12)
+			return false;
+	}
+
+	{
+		DynamicFifoQueue<int> fifoQueue {memoryResource, 2};
+		int value {0x34};
+		if (memoryResource.getUsedBlocks() != 1 || fifoQueue.tryPush(value) != 0 || fifoQueue.tryPop(value) != 0 ||
+				value != 0x34)
+			return false;
+	}
+
+	{
+		DynamicRawMessageQueue rawMessageQueue {memoryResource, sizeof(int), 2};
+		int value {0x56};
+		uint8_t priority {};
+		if (memoryResource.getUsedBlocks() != 2 || rawMessageQueue.tryPush(1, value) != 0 ||
+				rawMessageQueue.tryPop(priority, value) != 0 || priority != 1 || value != 0x56)
+			return false;
+	}
+
+	{
+		DynamicMessageQueue<int> messageQueue {memoryResource, 2};
+		int value {0x78};
+		uint8_t priority {};
+		if (memoryResource.getUsedBlocks() != 2 || messageQueue.tryPush(2, value) != 0 ||
+				messageQueue.tryPop(priority, value) != 0 || priority != 2 || value != 0x78)
+			return false;
+	}
+
+	{
+		DynamicRawSpscQueue rawSpscQueue {memoryResource, sizeof(int), 2};
+		int value {0x9a};
+		if (memoryResource.getUsedBlocks() != 1 || rawSpscQueue.tryPush(value) != 0 ||
+				rawSpscQueue.tryPop(value) != 0 || value != 0x9a)
+			return false;
+	}
+
+	{
+		DynamicMemoryPool memoryPool {memoryResource, sizeof(int), 2};
+		void* block {};
+		if (memoryResource.getUsedBlocks() != 2 || memoryPool.tryAllocate(block) != 0 ||
+				memoryResource.contains(block) == false || memoryPool.free(block) != 0)
+			return false;
+	}
+
+	{
+		DynamicSignalsReceiver signalsReceiver {memoryResource, 2, 2};
+		if (memoryResource.getUsedBlocks() != 2)
+			return false;
+	}
+
+	{
+		// storage is not allocated at all if queuing and catching of signals are disabled
+		DynamicSignalsReceiver signalsReceiver {memoryResource, 0, 0};
+		if (memoryResource.getUsedBlocks() != 0)
+			return false;
+	}
+
+	return memoryResource.getUsedBlocks() == 0 && memoryResource.isValid() == true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests whether stack, storage for signals and internal thread object of DynamicThread are allocated from and returned
+ * to the memory resource given in the constructor.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	{
+		int value {};
+		auto thread = makeAndStartDynamicThread(memoryResource, {testThreadStackSize, true, 1, 0, 1}, signalsThread,
+				std::ref(value));
+		if (memoryResource.getUsedBlocks() != threadObjectAllocations + 2 || thread.join() != 0 || value != 0x5a)
+			return false;
+	}
+
+	if (memoryResource.getUsedBlocks() != 0)
+		return false;
+
+	{
+		bool executed {};
+		auto thread = makeDynamicThread(memoryResource, testThreadStackSize, false, 0, 0, 1,
+				SchedulingPolicy::roundRobin,
+				[&executed]()
+				{
+					executed = true;
+				});
+		if (memoryResource.getUsedBlocks() != threadObjectAllocations + 1 || thread.start() != 0 ||
+				thread.join() != 0 || executed != true)
+			return false;
+	}
+
+	return memoryResource.getUsedBlocks() == 0 && memoryResource.isValid() == true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests whether RecyclingMemoryResource caches deallocated blocks (up to the limit given in the constructor) and
+ * reuses them only for allocations with the same size and alignment.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	{
+		RecyclingMemoryResource recyclingMemoryResource {memoryResource, 2};
+
+		const auto block1 = recyclingMemoryResource.allocate(64);
+		const auto block2 = recyclingMemoryResource.allocate(64);
+		const auto block3 = recyclingMemoryResource.allocate(128);
+		const auto block4 = recyclingMemoryResource.allocate(1);
+		if (block1 == nullptr || block2 == nullptr || block3 == nullptr || block4 == nullptr ||
+				memoryResource.getUsedBlocks() != 4 || recyclingMemoryResource.getMissCount() != 4)
+			return false;
+
+		// block which is too small is returned to upstream resource immediately
+		recyclingMemoryResource.deallocate(block4, 1);
+		if (memoryResource.getUsedBlocks() != 3 || recyclingMemoryResource.getCachedBlockCount() != 0)
+			return false;
+
+		// only two blocks fit in the cache, the last one is returned to upstream resource
+		recyclingMemoryResource.deallocate(block1, 64);
+		recyclingMemoryResource.deallocate(block2, 64);
+		recyclingMemoryResource.deallocate(block3, 128);
+		if (memoryResource.getUsedBlocks() != 2 || recyclingMemoryResource.getCachedBlockCount() != 2)
+			return false;
+
+		// most recently cached block is reused first
+		if (recyclingMemoryResource.allocate(64) != block2 || recyclingMemoryResource.getHitCount() != 1 ||
+				recyclingMemoryResource.getCachedBlockCount() != 1)
+			return false;
+
+		// block with different size or alignment is not reused
+		const auto block5 = recyclingMemoryResource.allocate(128);
+		const auto block6 = recyclingMemoryResource.allocate(64, 2 * alignof(std::max_align_t));
+		if (block5 == nullptr || block5 == block1 || block6 == nullptr || block6 == block1 ||
+				recyclingMemoryResource.getHitCount() != 1 || recyclingMemoryResource.getMissCount() != 6 ||
+				memoryResource.getUsedBlocks() != 4)
+			return false;
+
+		recyclingMemoryResource.deallocate(block2, 64);
+		recyclingMemoryResource.deallocate(block5, 128);
+		recyclingMemoryResource.deallocate(block6, 64, 2 * alignof(std::max_align_t));
+		if (memoryResource.getUsedBlocks() != 2 || recyclingMemoryResource.getCachedBlockCount() != 2)
+			return false;
+
+		recyclingMemoryResource.release();
+		if (memoryResource.getUsedBlocks() != 0 || recyclingMemoryResource.getCachedBlockCount() != 0)
+			return false;
+
+		const auto block7 = recyclingMemoryResource.allocate(64);
+		if (block7 == nullptr)
+			return false;
+
+		recyclingMemoryResource.deallocate(block7, 64);
+		if (memoryResource.getUsedBlocks() != 1 || recyclingMemoryResource.getCachedBlockCount() != 1)
+			return false;
+	}
+
+	// destructor returns all cached blocks to upstream resource
+	return memoryResource.getUsedBlocks() == 0 && memoryResource.isValid() == true;
+}
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests whether storage of terminated DynamicThread objects (both joined and detached) is reused by new threads when
+ * RecyclingMemoryResource is used.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	constexpr size_t threadAllocations {threadObjectAllocations + 1};
+
+	{
+		RecyclingMemoryResource recyclingMemoryResource {memoryResource, threadAllocations};
+
+		for (size_t i {}; i < 3; ++i)
+		{
+			bool executed {};
+			auto thread = makeAndStartDynamicThread(recyclingMemoryResource, {testThreadStackSize, 1},
+					[&executed]()
+					{
+						executed = true;
+					});
+			if (thread.join() != 0 || executed != true)
+				return false;
+		}
+
+		// only the first thread allocated its storage from upstream resource
+		if (recyclingMemoryResource.getMissCount() != threadAllocations ||
+				recyclingMemoryResource.getHitCount() != 2 * threadAllocations ||
+				recyclingMemoryResource.getCachedBlockCount() != threadAllocations ||
+				memoryResource.getUsedBlocks() != threadAllocations)
+			return false;
+
+#ifdef CONFIG_THREAD_DETACH_ENABLE
+
+		{
+			auto thread = makeAndStartDynamicThread(recyclingMemoryResource, {testThreadStackSize, 1}, []() {});
+			if (thread.detach() != 0)
+				return false;
+		}
+
+		// give the detached thread a chance to run and terminate
+		ThisThread::sleepFor(TickClock::duration{2});
+
+		{
+			auto thread = makeAndStartDynamicThread(recyclingMemoryResource, {testThreadStackSize, 1}, []() {});
+			if (thread.join() != 0)
+				return false;
+		}
+
+		if (recyclingMemoryResource.getMissCount() != threadAllocations ||
+				recyclingMemoryResource.getHitCount() != 4 * threadAllocations ||
+				memoryResource.getUsedBlocks() != threadAllocations)
+			return false;
+
+#endif	// def CONFIG_THREAD_DETACH_ENABLE
+	}
+
+	return memoryResource.getUsedBlocks() == 0 && memoryResource.isValid() == true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MemoryResourceOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3, phase4})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
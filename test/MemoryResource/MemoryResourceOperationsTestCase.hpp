@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief MemoryResourceOperationsTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_MEMORYRESOURCE_MEMORYRESOURCEOPERATIONSTESTCASE_HPP_
+#define TEST_MEMORYRESOURCE_MEMORYRESOURCEOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests allocation of storage of Dynamic* objects from MemoryResource.
+ *
+ * Tests whether storage of queues, memory pools, signals receivers and threads is allocated from and returned to the
+ * memory resource given in the constructor, and whether RecyclingMemoryResource reuses storage of destroyed objects.
+ */
+
+class MemoryResourceOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_MEMORYRESOURCE_MEMORYRESOURCEOPERATIONSTESTCASE_HPP_
@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief memoryResourceTestCases object definition
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "memoryResourceTestCases.hpp"
+
+#include "MemoryResourceOperationsTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// MemoryResourceOperationsTestCase instance
+const MemoryResourceOperationsTestCase operationsTestCase;
+
+/// array with references to TestCase objects related to memory resource
+const TestCaseGroup::Range::value_type memoryResourceTestCases_[]
+{
+		TestCaseGroup::Range::value_type{operationsTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup memoryResourceTestCases {TestCaseGroup::Range{memoryResourceTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
@@ -17,6 +17,8 @@
 
 #include "estd/ReverseAdaptor.hpp"
 
+#include <array>
+
 #include <cerrno>
 
 namespace distortos
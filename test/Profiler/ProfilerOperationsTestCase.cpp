@@ -0,0 +1,183 @@
+/**
+ * \file
+ * \brief ProfilerOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ProfilerOperationsTestCase.hpp"
+
+#include "distortos/profiler.hpp"
+
+#ifdef CONFIG_PROFILER_ENABLE
+
+#include "wasteTime.hpp"
+
+#include "distortos/StaticThread.hpp"
+#include "distortos/ThisThread.hpp"
+
+#endif	// def CONFIG_PROFILER_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef CONFIG_PROFILER_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack of test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// number of samples of test thread required in phase 2
+constexpr size_t requiredSamples {10};
+
+/// max duration of phase 2 - samples are taken only when the process is executed on POSIX host, which may be slowed
+/// down by the load of the host, so the duration is not fixed
+constexpr auto maxDuration = std::chrono::seconds{10};
+
+/// duration for which time is wasted in phase 3, ticks
+constexpr TickClock::duration wastedDuration {10};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// buffer for samples
+profiler::Sample samples[64];
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Reads all samples from the buffer and counts samples of selected thread.
+ *
+ * \param [in] thread is a pointer to thread for which samples are counted, nullptr to count all samples
+ *
+ * \return number of samples of \a thread (or number of all samples if \a thread is nullptr)
+ */
+
+size_t readSamples(const Thread* const thread)
+{
+	size_t count {};
+
+	size_t size;
+	while ((size = profiler::read(samples, sizeof(samples))) != 0)
+		for (size_t i {}; i < size / sizeof(*samples); ++i)
+			if (thread == nullptr ||
+					(samples[i].thread == reinterpret_cast<uintptr_t>(thread) && samples[i].programCounter != 0))
+				++count;
+
+	return count;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests header of binary profile.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	const auto header = profiler::getHeader();
+	return header.magic == 0x46525044 && header.version == 1 && header.sampleSize == sizeof(profiler::Sample) &&
+			header.frequency == CONFIG_PROFILER_FREQUENCY && header.reserved == 0 &&
+			header.referenceAddress == reinterpret_cast<uintptr_t>(&profiler::getHeader);
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests whether samples taken while test thread wastes time are attributed to this thread.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	size_t threadSamples {};
+	auto testThread = makeStaticThread<testThreadStackSize>(UINT8_MAX,
+			[&threadSamples]()
+			{
+				// keep executing until enough samples of this thread are read
+				const auto deadline = TickClock::now() + maxDuration;
+				while (threadSamples < requiredSamples && TickClock::now() < deadline)
+					threadSamples += readSamples(&ThisThread::get());
+			});
+
+	readSamples(nullptr);
+
+	if (profiler::start() != 0)
+		return false;
+
+	const auto startRet = testThread.start();
+	const auto joinRet = testThread.join();
+
+	profiler::stop();
+
+	if (startRet != 0 || joinRet != 0)
+		return false;
+
+	return threadSamples + readSamples(&testThread) >= requiredSamples;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests whether no samples are recorded when profiler is stopped.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	readSamples(nullptr);
+
+	const auto droppedSampleCount = profiler::getDroppedSampleCount();
+
+	wasteTime(wastedDuration);
+
+	return readSamples(nullptr) == 0 && profiler::getDroppedSampleCount() == droppedSampleCount;
+}
+
+}	// namespace
+
+#endif	// def CONFIG_PROFILER_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ProfilerOperationsTestCase::run_() const
+{
+#ifdef CONFIG_PROFILER_ENABLE
+
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+#endif	// def CONFIG_PROFILER_ENABLE
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
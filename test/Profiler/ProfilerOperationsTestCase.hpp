@@ -0,0 +1,46 @@
+/**
+ * \file
+ * \brief ProfilerOperationsTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_PROFILER_PROFILEROPERATIONSTESTCASE_HPP_
+#define TEST_PROFILER_PROFILEROPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests statistical profiler.
+ *
+ * Tests header of binary profile, attribution of samples to the thread which was running and stopping of profiler.
+ */
+
+class ProfilerOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_PROFILER_PROFILEROPERATIONSTESTCASE_HPP_
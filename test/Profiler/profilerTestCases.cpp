@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief profilerTestCases object definition
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "profilerTestCases.hpp"
+
+#include "ProfilerOperationsTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// ProfilerOperationsTestCase instance
+const ProfilerOperationsTestCase operationsTestCase;
+
+/// array with references to TestCase objects related to statistical profiler
+const TestCaseGroup::Range::value_type profilerTestCases_[]
+{
+		TestCaseGroup::Range::value_type{operationsTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup profilerTestCases {TestCaseGroup::Range{profilerTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
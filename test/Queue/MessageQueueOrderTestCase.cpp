@@ -0,0 +1,189 @@
+/**
+ * \file
+ * \brief MessageQueueOrderTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "MessageQueueOrderTestCase.hpp"
+
+#include "distortos/StaticMessageQueue.hpp"
+#include "distortos/StaticRawMessageQueue.hpp"
+
+#include <array>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of elements used in tests
+using TestType = uint32_t;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// priorities of elements pushed to the queue, element's value is equal to its index in this array; some of them are
+/// equal modulo size of the queue, so they share buckets of last entries when CONFIG_MESSAGE_QUEUE_PRIORITY_BITMAP_ENABLE
+/// is selected
+constexpr std::array<uint8_t, 16> priorities
+{{
+		5, 200, 5, 0, 200, 37, 0, 5, 37, 255, 0, 200, 31, 32, 33, 5,
+}};
+
+/// size of queues used in tests
+constexpr size_t queueSize {priorities.size()};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Pops all elements from the queue and checks their order.
+ *
+ * \tparam Queue is the type of tested queue
+ *
+ * \param [in] queue is a reference to tested queue
+ * \param [in] expectedCount is the expected number of elements in the queue
+ *
+ * \return true if all elements were popped in descending order of priorities and in FIFO order within the group of
+ * elements with the same priority, false otherwise
+ */
+
+template<typename Queue>
+bool popAndCheck(Queue& queue, const size_t expectedCount)
+{
+	size_t previousPriority {UINT8_MAX + 1};
+	TestType previousValue {};
+	for (size_t i {}; i < expectedCount; ++i)
+	{
+		uint8_t priority {};
+		TestType value {};
+		if (queue.tryPop(priority, value) != 0 || value >= priorities.size() || priorities[value] != priority ||
+				priority > previousPriority || (priority == previousPriority && value <= previousValue))
+			return false;
+
+		previousPriority = priority;
+		previousValue = value;
+	}
+
+	uint8_t priority {};
+	TestType value {};
+	return queue.tryPop(priority, value) == EAGAIN;
+}
+
+/**
+ * \brief Tests order of elements in the queue.
+ *
+ * First all elements are pushed and then all of them are popped. Then elements are pushed again, but after each few
+ * pushed elements the one with the highest priority is popped and checked.
+ *
+ * \tparam Queue is the type of tested queue
+ *
+ * \param [in] queue is a reference to tested queue
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+template<typename Queue>
+bool testOrder(Queue& queue)
+{
+	for (size_t i {}; i < priorities.size(); ++i)
+		if (queue.tryPush(priorities[i], TestType(i)) != 0)
+			return false;
+
+	if (popAndCheck(queue, priorities.size()) == false)
+		return false;
+
+	std::array<bool, priorities.size()> popped {};
+	size_t poppedCount {};
+	for (size_t i {}; i < priorities.size(); ++i)
+	{
+		if (queue.tryPush(priorities[i], TestType(i)) != 0)
+			return false;
+
+		if (i % 3 != 2)
+			continue;
+
+		// expected element - the oldest one with the highest priority among elements which are still in the queue
+		size_t expected {priorities.size()};
+		for (size_t j {}; j <= i; ++j)
+			if (popped[j] == false && (expected == priorities.size() || priorities[j] > priorities[expected]))
+				expected = j;
+
+		uint8_t priority {};
+		TestType value {};
+		if (queue.tryPop(priority, value) != 0 || value != expected || priority != priorities[expected])
+			return false;
+
+		popped[expected] = true;
+		++poppedCount;
+	}
+
+	return popAndCheck(queue, priorities.size() - poppedCount);
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests order of elements in RawMessageQueue.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	StaticRawMessageQueue<TestType, queueSize> rawMessageQueue;
+	return testOrder(rawMessageQueue);
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests order of elements in MessageQueue.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	StaticMessageQueue<TestType, queueSize> messageQueue;
+	return testOrder(messageQueue);
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MessageQueueOrderTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief MessageQueueOrderTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_MESSAGEQUEUEORDERTESTCASE_HPP_
+#define TEST_QUEUE_MESSAGEQUEUEORDERTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests order of elements in {Raw,}MessageQueue.
+ *
+ * Pushes elements with many different priorities (in various order, with many elements of the same priority), also
+ * interleaved with popping, asserting that elements are popped in descending order of priorities and in FIFO order
+ * within the group of elements with the same priority.
+ */
+
+class MessageQueueOrderTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_MESSAGEQUEUEORDERTESTCASE_HPP_
@@ -0,0 +1,222 @@
+/**
+ * \file
+ * \brief QueueBatchTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "QueueBatchTestCase.hpp"
+
+#include "OperationCountingType.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/StaticFifoQueue.hpp"
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of elements used in tests
+using TestType = uint32_t;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// size of queues used in tests
+constexpr size_t queueSize {4};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests batched transfers in RawFifoQueue - invalid sizes, empty and full queue, transfers limited by the number of
+ * available elements/free slots and transfers across the end of queue's storage.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	StaticRawFifoQueue<TestType, queueSize> fifoQueue;
+	TestType values[queueSize + 2] {};
+	size_t count {};
+
+	if (fifoQueue.tryPopN(values, sizeof(values), count) != EAGAIN ||
+			fifoQueue.tryPopNFor(singleDuration, values, sizeof(values), count) != ETIMEDOUT ||
+			fifoQueue.tryPushN(values, 0, count) != EMSGSIZE ||
+			fifoQueue.tryPushN(values, sizeof(*values) + 1, count) != EMSGSIZE ||
+			fifoQueue.tryPopN(values, sizeof(*values) - 1, count) != EMSGSIZE)
+		return false;
+
+	// move read and write positions, so that following transfers cross the end of queue's storage
+	{
+		TestType value {};
+		if (fifoQueue.tryPush(value) != 0 || fifoQueue.tryPush(value) != 0 || fifoQueue.tryPop(value) != 0 ||
+				fifoQueue.tryPop(value) != 0)
+			return false;
+	}
+
+	for (size_t i {}; i < queueSize + 2; ++i)
+		values[i] = i + 1;
+
+	// push more than free - only queueSize elements fit in the queue
+	if (fifoQueue.tryPushNUntil(TickClock::now() + singleDuration, values, sizeof(values), count) != 0 ||
+			count != queueSize)
+		return false;
+
+	if (fifoQueue.tryPushNFor(singleDuration, values, sizeof(values), count) != ETIMEDOUT)
+		return false;
+
+	TestType poppedValues[queueSize + 2] {};
+
+	// pop less than available
+	if (fifoQueue.tryPopNUntil(TickClock::now() + singleDuration, poppedValues, 2 * sizeof(*poppedValues), count) !=
+			0 || count != 2)
+		return false;
+
+	if (fifoQueue.pushN(values + queueSize, 2 * sizeof(*values), count) != 0 || count != 2)
+		return false;
+
+	// pop more than available
+	if (fifoQueue.popN(poppedValues + 2, sizeof(poppedValues), count) != 0 || count != queueSize)
+		return false;
+
+	for (size_t i {}; i < queueSize + 2; ++i)
+		if (poppedValues[i] != i + 1)
+			return false;
+
+	return fifoQueue.tryPopN(values, sizeof(values), count) == EAGAIN;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests batched transfers in FifoQueue - elements must be copy-constructed when pushed, swapped and destructed when
+ * popped.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	StaticFifoQueue<OperationCountingType, queueSize> fifoQueue;
+	size_t count {};
+
+	{
+		OperationCountingType values[queueSize + 1];
+		for (size_t i {}; i < queueSize + 1; ++i)
+			values[i] = OperationCountingType{static_cast<OperationCountingType::Value>(i + 1)};
+
+		OperationCountingType::resetCounters();
+
+		if (fifoQueue.tryPushN(values, 0, count) != EINVAL ||
+				fifoQueue.tryPushNFor(singleDuration, values, queueSize + 1, count) != 0 || count != queueSize ||
+				OperationCountingType::checkCounters(0, queueSize, 0, 0, 0, 0, 0) != true)
+			return false;
+	}
+
+	{
+		OperationCountingType values[queueSize + 1];
+
+		OperationCountingType::resetCounters();
+
+		if (fifoQueue.tryPopN(values, 0, count) != EINVAL ||
+				fifoQueue.tryPopNUntil(TickClock::now() + singleDuration, values, queueSize + 1, count) != 0 ||
+				count != queueSize || OperationCountingType::checkCounters(0, 0, 0, queueSize, 0, 0, queueSize) != true)
+			return false;
+
+		for (size_t i {}; i < queueSize; ++i)
+			if (values[i].getValue() != i + 1)
+				return false;
+
+		if (fifoQueue.tryPopNFor(singleDuration, values, queueSize, count) != ETIMEDOUT)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests whether thread waiting in FifoQueue::popN() is woken only once for all elements pushed with FifoQueue::pushN()
+ * - it must receive the whole batch.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	StaticFifoQueue<TestType, queueSize> fifoQueue;
+	TestType poppedValues[queueSize] {};
+	size_t poppedCount {};
+	int sharedRet {-1};
+	auto thread = makeAndStartDynamicThread({testThreadStackSize, static_cast<uint8_t>(ThisThread::getPriority() + 1)},
+			[&fifoQueue, &poppedValues, &poppedCount, &sharedRet]()
+			{
+				sharedRet = fifoQueue.popN(poppedValues, queueSize, poppedCount);
+			});
+
+	const TestType values[queueSize - 1] {1, 2, 3};
+	size_t pushedCount {};
+	const auto ret = fifoQueue.pushN(values, queueSize - 1, pushedCount);
+	thread.join();
+
+	if (ret != 0 || pushedCount != queueSize - 1 || sharedRet != 0 || poppedCount != queueSize - 1)
+		return false;
+
+	for (size_t i {}; i < queueSize - 1; ++i)
+		if (poppedValues[i] != values[i])
+			return false;
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool QueueBatchTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief QueueBatchTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_QUEUEBATCHTESTCASE_HPP_
+#define TEST_QUEUE_QUEUEBATCHTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests batched transfers of elements in {Fifo,RawFifo}Queue.
+ *
+ * Tests pushing and popping of many elements at once (pushN(), tryPushN(), tryPushNFor(), tryPushNUntil(), popN(),
+ * tryPopN(), tryPopNFor() and tryPopNUntil()) - these operations must transfer as many elements as possible (also
+ * across the end of queue's storage), preserve order of elements, return expected results and wake the waiting thread
+ * only once for the whole batch.
+ */
+
+class QueueBatchTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_QUEUEBATCHTESTCASE_HPP_
@@ -13,13 +13,12 @@
 
 #include "QueueWrappers.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "waitForNextTick.hpp"
 
 #include "distortos/StaticSoftwareTimer.hpp"
 #include "distortos/statistics.hpp"
 
-#include <malloc.h>
-
 #include <cerrno>
 
 namespace distortos
@@ -52,11 +51,23 @@ constexpr decltype(statistics::getContextSwitchCount()) waitForNextTickContextSw
 /// (main -> idle), 2 - main thread wakes up (idle -> main)
 constexpr decltype(statistics::getContextSwitchCount()) phase1TryForUntilContextSwitchCount {2};
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// expected number of context switches in phase3 and phase4 block involving software timer (excluding
+/// waitForNextTick()): 1 - main thread blocks on queue (main -> idle), 2 - software timer thread is woken by interrupt
+/// (idle -> software timer thread), 3 - main thread is unblocked by software timer thread, which then waits for next
+/// software timer (software timer thread -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase34SoftwareTimerContextSwitchCount {3};
+
+#else	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 /// expected number of context switches in phase3 and phase4 block involving software timer (excluding
 /// waitForNextTick()): 1 - main thread blocks on queue (main -> idle), 2 - main thread is unblocked by interrupt
 /// (idle -> main)
 constexpr decltype(statistics::getContextSwitchCount()) phase34SoftwareTimerContextSwitchCount {2};
 
+#endif	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | local functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -1205,7 +1216,7 @@ bool QueueOperationsTestCase::run_() const
 	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
 			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount + phase5ExpectedContextSwitchCount;
 
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
 	for (const auto& function : {phase1, phase2, phase3, phase4, phase5, phase6})
@@ -1214,7 +1225,7 @@ bool QueueOperationsTestCase::run_() const
 		if (ret != true)
 			return ret;
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
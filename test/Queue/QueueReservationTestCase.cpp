@@ -0,0 +1,276 @@
+/**
+ * \file
+ * \brief QueueReservationTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "QueueReservationTestCase.hpp"
+
+#include "distortos/StaticRawFifoQueue.hpp"
+#include "distortos/StaticRawMessageQueue.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of elements used in tests
+using TestType = uint32_t;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// size of queues used in tests
+constexpr size_t queueSize {2};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests reservations in RawFifoQueue. Only one slot for pushing and one element for popping may be reserved at a time.
+ * Elements pushed/popped with regular functions while the reservation is active must not become available before the
+ * reserved one.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	StaticRawFifoQueue<TestType, queueSize> fifoQueue;
+
+	{
+		const void* storage {};
+		if (fifoQueue.tryPeekPop(storage) != EAGAIN)
+			return false;
+	}
+
+	{
+		void* storage {};
+		if (fifoQueue.reservePush(storage) != 0 || storage == nullptr)
+			return false;
+
+		void* otherStorage {};
+		if (fifoQueue.tryReservePush(otherStorage) != EBUSY)
+			return false;
+
+		TestType value {};
+		// reserved slot is not committed yet
+		if (fifoQueue.tryPop(value) != EAGAIN)
+			return false;
+
+		*static_cast<TestType*>(storage) = 1;
+
+		// this element must not be available before the reserved one
+		if (fifoQueue.tryPush(TestType{2}) != 0 || fifoQueue.tryPop(value) != EAGAIN)
+			return false;
+
+		if (fifoQueue.commitPush(&value) != EINVAL || fifoQueue.commitPush(storage) != 0 ||
+				fifoQueue.commitPush(storage) != EINVAL)
+			return false;
+	}
+
+	{
+		const void* storage {};
+		if (fifoQueue.tryPeekPopFor(singleDuration, storage) != 0 || storage == nullptr ||
+				*static_cast<const TestType*>(storage) != 1)
+			return false;
+
+		const void* otherStorage {};
+		if (fifoQueue.tryPeekPop(otherStorage) != EBUSY)
+			return false;
+
+		TestType value {};
+		if (fifoQueue.tryPop(value) != 0 || value != 2)
+			return false;
+
+		// slots of both elements must not be reused before the reserved one is released
+		if (fifoQueue.tryPush(TestType{3}) != EAGAIN)
+			return false;
+
+		if (fifoQueue.releasePop(&value) != EINVAL || fifoQueue.releasePop(storage) != 0 ||
+				fifoQueue.releasePop(storage) != EINVAL)
+			return false;
+	}
+
+	for (size_t i {}; i < queueSize; ++i)
+	{
+		void* storage {};
+		if (fifoQueue.tryReservePushUntil(TickClock::now() + singleDuration, storage) != 0)
+			return false;
+
+		*static_cast<TestType*>(storage) = 4 + i;
+
+		if (fifoQueue.commitPush(storage) != 0)
+			return false;
+	}
+
+	{
+		void* storage {};
+		if (fifoQueue.tryReservePushFor(singleDuration, storage) != ETIMEDOUT)
+			return false;
+	}
+
+	for (size_t i {}; i < queueSize; ++i)
+	{
+		const void* storage {};
+		if (fifoQueue.tryPeekPopUntil(TickClock::now() + singleDuration, storage) != 0 ||
+				*static_cast<const TestType*>(storage) != 4 + i || fifoQueue.releasePop(storage) != 0)
+			return false;
+	}
+
+	{
+		const void* storage {};
+		if (fifoQueue.tryPeekPopFor(singleDuration, storage) != ETIMEDOUT)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests reservations in RawMessageQueue. Only one slot for pushing and one element for popping may be reserved at a
+ * time. Elements pushed/popped with regular functions while the reservation is active are available immediately and
+ * committed elements must be popped in the order of their priorities.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	StaticRawMessageQueue<TestType, queueSize> messageQueue;
+
+	{
+		uint8_t priority {};
+		const void* storage {};
+		if (messageQueue.tryPeekPop(priority, storage) != EAGAIN)
+			return false;
+	}
+
+	{
+		void* storage {};
+		if (messageQueue.reservePush(storage) != 0 || storage == nullptr)
+			return false;
+
+		void* otherStorage {};
+		if (messageQueue.tryReservePush(otherStorage) != EBUSY ||
+				messageQueue.tryReservePushFor(singleDuration, otherStorage) != EBUSY ||
+				messageQueue.tryReservePushUntil(TickClock::now() + singleDuration, otherStorage) != EBUSY)
+			return false;
+
+		uint8_t priority {};
+		TestType value {};
+		// reserved slot is not committed yet
+		if (messageQueue.tryPop(priority, value) != EAGAIN)
+			return false;
+
+		*static_cast<TestType*>(storage) = 1;
+
+		// reserved slot is not free
+		if (messageQueue.tryPush(10, TestType{2}) != 0 || messageQueue.tryPush(0, TestType{3}) != EAGAIN)
+			return false;
+
+		if (messageQueue.commitPush(20, &value) != EINVAL || messageQueue.commitPush(20, storage) != 0 ||
+				messageQueue.commitPush(20, storage) != EINVAL)
+			return false;
+	}
+
+	{
+		uint8_t priority {};
+		const void* storage {};
+		if (messageQueue.peekPop(priority, storage) != 0 || priority != 20 ||
+				*static_cast<const TestType*>(storage) != 1)
+			return false;
+
+		uint8_t otherPriority {};
+		const void* otherStorage {};
+		if (messageQueue.tryPeekPop(otherPriority, otherStorage) != EBUSY ||
+				messageQueue.tryPeekPopFor(singleDuration, otherPriority, otherStorage) != EBUSY ||
+				messageQueue.tryPeekPopUntil(TickClock::now() + singleDuration, otherPriority, otherStorage) != EBUSY)
+			return false;
+
+		TestType value {};
+		if (messageQueue.tryPop(otherPriority, value) != 0 || otherPriority != 10 || value != 2)
+			return false;
+
+		// slot of reserved element must not be reused before it is released
+		if (messageQueue.tryPush(0, TestType{3}) != 0 || messageQueue.tryPush(0, TestType{4}) != EAGAIN)
+			return false;
+
+		if (messageQueue.releasePop(&value) != EINVAL || messageQueue.releasePop(storage) != 0 ||
+				messageQueue.releasePop(storage) != EINVAL)
+			return false;
+
+		if (messageQueue.tryPop(otherPriority, value) != 0 || otherPriority != 0 || value != 3)
+			return false;
+	}
+
+	for (size_t i {}; i < queueSize; ++i)
+	{
+		void* storage {};
+		if (messageQueue.tryReservePushUntil(TickClock::now() + singleDuration, storage) != 0)
+			return false;
+
+		*static_cast<TestType*>(storage) = 4 + i;
+
+		if (messageQueue.commitPush(30 + i, storage) != 0)
+			return false;
+	}
+
+	for (size_t i {}; i < queueSize; ++i)
+	{
+		uint8_t priority {};
+		const void* storage {};
+		if (messageQueue.tryPeekPopFor(singleDuration, priority, storage) != 0 || priority != 30 + queueSize - 1 - i ||
+				*static_cast<const TestType*>(storage) != 4 + queueSize - 1 - i ||
+				messageQueue.releasePop(storage) != 0)
+			return false;
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool QueueReservationTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
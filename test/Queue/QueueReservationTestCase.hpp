@@ -0,0 +1,51 @@
+/**
+ * \file
+ * \brief QueueReservationTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_QUEUERESERVATIONTESTCASE_HPP_
+#define TEST_QUEUE_QUEUERESERVATIONTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests in place access to elements of Raw{Fifo,Message}Queue.
+ *
+ * Tests reserving slots for pushing (reservePush(), tryReservePush(), tryReservePushFor() and tryReservePushUntil())
+ * with commitPush() and reserving elements for popping (peekPop(), tryPeekPop(), tryPeekPopFor() and
+ * tryPeekPopUntil()) with releasePop() - reserved elements must not be available for popping/pushing until they are
+ * committed/released, only one slot for pushing and one element for popping may be reserved at a time in each queue,
+ * these operations must return expected results and preserve order of elements, also when mixed with regular push()
+ * and pop().
+ */
+
+class QueueReservationTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_QUEUERESERVATIONTESTCASE_HPP_
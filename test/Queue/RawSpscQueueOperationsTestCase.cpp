@@ -0,0 +1,194 @@
+/**
+ * \file
+ * \brief RawSpscQueueOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "RawSpscQueueOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicRawSpscQueue.hpp"
+#include "distortos/StaticRawSpscQueue.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// type of elements used in tests
+using TestType = uint32_t;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// long duration used in tests
+constexpr auto longDuration = singleDuration * 10;
+
+/// size of queues used in tests
+constexpr size_t queueSize {3};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Tests operations on empty, full and partially filled queue.
+ *
+ * \param [in] spscQueue is a reference to tested queue, must be empty
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testOperations(RawSpscQueue& spscQueue)
+{
+	TestType value {};
+	uint8_t invalidValue {};
+
+	if (spscQueue.tryPop(value) != EAGAIN || spscQueue.tryPopFor(singleDuration, value) != ETIMEDOUT ||
+			spscQueue.tryPopUntil(TickClock::now() + singleDuration, value) != ETIMEDOUT ||
+			spscQueue.tryPush(invalidValue) != EMSGSIZE || spscQueue.tryPop(invalidValue) != EMSGSIZE ||
+			spscQueue.pop(invalidValue) != EMSGSIZE)
+		return false;
+
+	TestType pushedValue {};
+	TestType expectedValue {};
+
+	// repeated partial filling and draining moves read and write positions across the end of storage a few times
+	for (size_t round {}; round < queueSize * 2 + 1; ++round)
+	{
+		while (spscQueue.tryPush(pushedValue) == 0)
+			++pushedValue;
+
+		if (pushedValue - expectedValue != queueSize)
+			return false;
+
+		for (size_t i {}; i < queueSize - 1; ++i)
+		{
+			if (spscQueue.tryPop(value) != 0 || value != expectedValue)
+				return false;
+			++expectedValue;
+		}
+	}
+
+	while (pushedValue != expectedValue)
+	{
+		if (spscQueue.pop(value) != 0 || value != expectedValue)
+			return false;
+		++expectedValue;
+	}
+
+	return spscQueue.tryPop(value) == EAGAIN;
+}
+
+/**
+ * \brief Tests interrupt -> thread communication scenario.
+ *
+ * Main (current) thread waits for data to become available in queue. Software timer pushes the value to the same queue
+ * at specified time point from interrupt context, main thread is expected to receive this value (with pop(),
+ * tryPopFor() and tryPopUntil()) in the same moment.
+ *
+ * \param [in] spscQueue is a reference to tested queue, must be empty
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool testInterruptToThread(RawSpscQueue& spscQueue)
+{
+	TestType sharedMagicValue {};
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&spscQueue, &sharedMagicValue]()
+			{
+				spscQueue.tryPush(sharedMagicValue);
+			});
+
+	for (size_t variant {}; variant < 3; ++variant)
+	{
+		waitForNextTick();
+
+		const auto wakeUpTimePoint = TickClock::now() + longDuration;
+		sharedMagicValue = 0x6b1c30e7 + variant;
+		softwareTimer.start(wakeUpTimePoint);
+
+		// queue is currently empty, but pop should succeed at expected time
+		TestType value {};
+		const auto ret = variant == 0 ? spscQueue.pop(value) : variant == 1 ?
+				spscQueue.tryPopFor(wakeUpTimePoint - TickClock::now() + longDuration, value) :
+				spscQueue.tryPopUntil(wakeUpTimePoint + longDuration, value);
+		const auto wokenUpTimePoint = TickClock::now();
+		if (ret != 0 || wakeUpTimePoint != wokenUpTimePoint || value != sharedMagicValue)
+			return false;
+	}
+
+	return true;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests StaticRawSpscQueue.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	StaticRawSpscQueue<TestType, queueSize> spscQueue;
+	return testOperations(spscQueue) == true && testInterruptToThread(spscQueue) == true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests DynamicRawSpscQueue.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	DynamicRawSpscQueue spscQueue {sizeof(TestType), queueSize};
+	return testOperations(spscQueue) == true && testInterruptToThread(spscQueue) == true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool RawSpscQueueOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief RawSpscQueueOperationsTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_QUEUE_RAWSPSCQUEUEOPERATIONSTESTCASE_HPP_
+#define TEST_QUEUE_RAWSPSCQUEUEOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests various operations of {Static,Dynamic}RawSpscQueue.
+ *
+ * Tests tryPush(), pop(), tryPop(), tryPopFor() and tryPopUntil() - they must return expected results, preserve order
+ * of elements (also when read and write positions wrap around) and the consumer blocked on empty queue must be woken
+ * by the element pushed from interrupt context.
+ */
+
+class RawSpscQueueOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_QUEUE_RAWSPSCQUEUEOPERATIONSTESTCASE_HPP_
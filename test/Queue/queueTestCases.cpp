@@ -2,7 +2,7 @@
  * \file
  * \brief queueTestCases object definition
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,6 +14,10 @@
 #include "QueueOperationsTestCase.hpp"
 #include "FifoQueuePriorityTestCase.hpp"
 #include "MessageQueuePriorityTestCase.hpp"
+#include "MessageQueueOrderTestCase.hpp"
+#include "QueueReservationTestCase.hpp"
+#include "QueueBatchTestCase.hpp"
+#include "RawSpscQueueOperationsTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -39,12 +43,28 @@ const FifoQueuePriorityTestCase fifoQueuePriorityTestCase;
 /// MessageQueuePriorityTestCase instance
 const MessageQueuePriorityTestCase messageQueuePriorityTestCase;
 
+/// MessageQueueOrderTestCase instance
+const MessageQueueOrderTestCase messageQueueOrderTestCase;
+
+/// QueueReservationTestCase instance
+const QueueReservationTestCase reservationTestCase;
+
+/// QueueBatchTestCase instance
+const QueueBatchTestCase batchTestCase;
+
+/// RawSpscQueueOperationsTestCase instance
+const RawSpscQueueOperationsTestCase rawSpscQueueOperationsTestCase;
+
 /// array with references to TestCase objects related to queue
 const TestCaseGroup::Range::value_type queueTestCases_[]
 {
 		TestCaseGroup::Range::value_type{operationsTestCase},
 		TestCaseGroup::Range::value_type{fifoQueuePriorityTestCase},
 		TestCaseGroup::Range::value_type{messageQueuePriorityTestCase},
+		TestCaseGroup::Range::value_type{messageQueueOrderTestCase},
+		TestCaseGroup::Range::value_type{reservationTestCase},
+		TestCaseGroup::Range::value_type{batchTestCase},
+		TestCaseGroup::Range::value_type{rawSpscQueueOperationsTestCase},
 };
 
 }	// namespace
@@ -0,0 +1,341 @@
+/**
+ * \file
+ * \brief RwLockOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "RwLockOperationsTestCase.hpp"
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/DynamicThread.hpp"
+#include "distortos/RwLock.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <array>
+
+#include <cerrno>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/// expected number of context switches in blocks involving timed-out lock (excluding waitForNextTick()): 1 - main
+/// thread blocks on reader-writer lock (main -> idle), 2 - main thread wakes up (idle -> main)
+constexpr decltype(statistics::getContextSwitchCount()) timedOutLockContextSwitchCount {2};
+
+/// size of stack of test threads, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests all non-blocking functions and detection of errors.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	RwLock rwLock;
+
+	if (rwLock.unlock() != EPERM || rwLock.unlockShared() != EPERM)
+		return false;
+
+	if (rwLock.tryLock() != 0 || rwLock.tryLock() != EBUSY || rwLock.tryLockShared() != EBUSY ||
+			rwLock.lock() != EDEADLK || rwLock.lockShared() != EDEADLK || rwLock.unlockShared() != EPERM ||
+			rwLock.unlock() != 0 || rwLock.unlock() != EPERM)
+		return false;
+
+	if (rwLock.tryLockShared() != 0 || rwLock.lockShared() != 0 || rwLock.tryLock() != EBUSY ||
+			rwLock.unlock() != EPERM || rwLock.unlockShared() != 0 || rwLock.unlockShared() != 0 ||
+			rwLock.unlockShared() != EPERM)
+		return false;
+
+	return rwLock.lock() == 0 && rwLock.unlock() == 0;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests timeouts of tryLockFor() and tryLockSharedUntil() - timed-out writer must not block readers. Tests detection of
+ * deadlock in tryLockUntil() and tryLockSharedFor().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	RwLock rwLock;
+
+	if (rwLock.lockShared() != 0)
+		return false;
+
+	{
+		// writer waits for readers (including current thread) to unlock
+		waitForNextTick();
+
+		const auto contextSwitchCount = statistics::getContextSwitchCount();
+		const auto start = TickClock::now();
+		const auto ret = rwLock.tryLockFor(singleDuration);
+		const auto realDuration = TickClock::now() - start;
+		if (ret != ETIMEDOUT || realDuration != singleDuration + decltype(singleDuration){1} ||
+				statistics::getContextSwitchCount() - contextSwitchCount != timedOutLockContextSwitchCount)
+			return false;
+	}
+
+	if (rwLock.tryLockShared() != 0 || rwLock.unlockShared() != 0 || rwLock.unlockShared() != 0)
+		return false;
+
+	if (rwLock.lock() != 0)
+		return false;
+
+	{
+		// reader thread with higher priority blocks immediately, main thread waits for it to time-out
+		int ret {};
+		TickClock::time_point wakeUpTimePoint {};
+		const auto requestedTimePoint = TickClock::now() + singleDuration * 2;
+		auto thread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX},
+				[&rwLock, &ret, &wakeUpTimePoint, requestedTimePoint]()
+				{
+					ret = rwLock.tryLockSharedUntil(requestedTimePoint);
+					wakeUpTimePoint = TickClock::now();
+				});
+		thread.join();
+		if (ret != ETIMEDOUT || wakeUpTimePoint != requestedTimePoint)
+			return false;
+	}
+
+	{
+		waitForNextTick();
+
+		const auto requestedTimePoint = TickClock::now() + singleDuration;
+		if (rwLock.tryLockUntil(requestedTimePoint) != EDEADLK || rwLock.tryLockSharedFor(singleDuration) != EDEADLK)
+			return false;
+	}
+
+	return rwLock.unlock() == 0;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests passing of the lock from writer to a group of readers - all readers blocked because of the writer must hold the
+ * lock at the same time after the writer unlocks it.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	RwLock rwLock;
+	Semaphore semaphore {0};
+	size_t readers {};
+
+	const auto readerFunctor = [&rwLock, &semaphore, &readers]()
+			{
+				if (rwLock.lockShared() != 0)
+					return;
+
+				++readers;
+				semaphore.wait();
+				rwLock.unlockShared();
+			};
+
+	if (rwLock.lock() != 0)
+		return false;
+
+	std::array<DynamicThread, 3> threads
+	{{
+			makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, readerFunctor),
+			makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX - 1}, readerFunctor),
+			makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX - 2}, readerFunctor),
+	}};
+
+	for (auto& thread : threads)
+		if (thread.getState() != ThreadState::blockedOnMutex)
+			return false;
+
+	if (rwLock.unlock() != 0)
+		return false;
+
+	const auto result = readers == threads.size() && rwLock.tryLock() == EBUSY && rwLock.tryLockShared() == 0 &&
+			rwLock.unlockShared() == 0;
+
+	for (size_t i {}; i < threads.size(); ++i)
+		semaphore.post();
+
+	for (auto& thread : threads)
+		thread.join();
+
+	return result == true && rwLock.tryLock() == 0 && rwLock.unlock() == 0;
+}
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests preference of writers - when a writer waits for readers to unlock, new readers (even with higher priority) are
+ * blocked and get the lock only after the writer.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	RwLock rwLock;
+	std::array<uint8_t, 2> sequence {};
+	size_t sequenceIndex {};
+
+	if (rwLock.lockShared() != 0)
+		return false;
+
+	auto writerThread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX - 1},
+			[&rwLock, &sequence, &sequenceIndex]()
+			{
+				if (rwLock.lock() != 0)
+					return;
+
+				sequence[sequenceIndex++] = ThisThread::getPriority();
+				rwLock.unlock();
+			});
+
+	if (writerThread.getState() != ThreadState::blockedOnRwLock || rwLock.tryLockShared() != EBUSY)
+		return false;
+
+	auto readerThread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX},
+			[&rwLock, &sequence, &sequenceIndex]()
+			{
+				if (rwLock.lockShared() != 0)
+					return;
+
+				sequence[sequenceIndex++] = ThisThread::getPriority();
+				rwLock.unlockShared();
+			});
+
+	if (readerThread.getState() != ThreadState::blockedOnMutex || sequenceIndex != 0)
+		return false;
+
+	if (rwLock.unlockShared() != 0)
+		return false;
+
+	writerThread.join();
+	readerThread.join();
+
+	return sequenceIndex == sequence.size() && sequence[0] == UINT8_MAX - 1 && sequence[1] == UINT8_MAX;
+}
+
+/**
+ * \brief Phase 5 of test case.
+ *
+ * Tests priority inheritance - writer (both the one holding the lock and the one waiting for readers to unlock) must
+ * inherit priority of threads blocked because of it only with RwLock::Protocol::priorityInheritance.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase5()
+{
+	const auto lockUnlockFunctor = [](RwLock& rwLock, const bool shared)
+			{
+				if ((shared == true ? rwLock.lockShared() : rwLock.lock()) != 0)
+					return;
+
+				shared == true ? rwLock.unlockShared() : rwLock.unlock();
+			};
+
+	const auto mainThreadPriority = ThisThread::getPriority();
+
+	for (const auto protocol : {RwLock::Protocol::none, RwLock::Protocol::priorityInheritance})
+	{
+		const auto inheritance = protocol == RwLock::Protocol::priorityInheritance;
+
+		{
+			RwLock rwLock {protocol};
+			if (rwLock.lock() != 0)
+				return false;
+
+			auto thread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, lockUnlockFunctor,
+					std::ref(rwLock), false);
+			if (thread.getState() != ThreadState::blockedOnMutex ||
+					ThisThread::getEffectivePriority() != (inheritance == true ? UINT8_MAX : mainThreadPriority))
+				return false;
+
+			if (rwLock.unlock() != 0 || ThisThread::getEffectivePriority() != mainThreadPriority)
+				return false;
+
+			thread.join();
+		}
+
+		{
+			RwLock rwLock {protocol};
+			if (rwLock.lockShared() != 0)
+				return false;
+
+			constexpr uint8_t writerPriority {UINT8_MAX - 1};
+			auto writerThread = makeAndStartDynamicThread({testThreadStackSize, writerPriority}, lockUnlockFunctor,
+					std::ref(rwLock), false);
+			// writer with priority higher than main thread starts immediately and waits for readers to unlock
+			if (writerThread.getState() != ThreadState::blockedOnRwLock)
+				return false;
+
+			auto readerThread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, lockUnlockFunctor,
+					std::ref(rwLock), true);
+			if (readerThread.getState() != ThreadState::blockedOnMutex ||
+					writerThread.getEffectivePriority() != (inheritance == true ? UINT8_MAX : writerPriority))
+				return false;
+
+			if (rwLock.unlockShared() != 0)
+				return false;
+
+			writerThread.join();
+			readerThread.join();
+		}
+	}
+
+	return true;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool RwLockOperationsTestCase::run_() const
+{
+	for (const auto& function : {phase1, phase2, phase3, phase4, phase5})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief rwLockTestCases object definition
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "rwLockTestCases.hpp"
+
+#include "RwLockOperationsTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// RwLockOperationsTestCase instance
+const RwLockOperationsTestCase operationsTestCase;
+
+/// array with references to TestCase objects related to reader-writer lock
+const TestCaseGroup::Range::value_type rwLockTestCases_[]
+{
+		TestCaseGroup::Range::value_type{operationsTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup rwLockTestCases {TestCaseGroup::Range{rwLockTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
@@ -51,10 +51,22 @@ constexpr decltype(statistics::getContextSwitchCount()) phase1TryWaitForUntilCon
 /// (main -> idle), 4 - test thread wakes (idle -> test), 5 - test thread terminates (test -> main)
 constexpr decltype(statistics::getContextSwitchCount()) phase3ThreadContextSwitchCount {5};
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// expected number of context switches in phase4 block involving software timer (excluding waitForNextTick()): 1 - main
+/// thread blocks on semaphore (main -> idle), 2 - software timer thread is woken by interrupt (idle -> software timer
+/// thread), 3 - main thread is unblocked by software timer thread, which then waits for next software timer (software
+/// timer thread -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase4SoftwareTimerContextSwitchCount {3};
+
+#else	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 /// expected number of context switches in phase4 block involving software timer (excluding waitForNextTick()): 1 - main
 /// thread blocks on semaphore (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
 constexpr decltype(statistics::getContextSwitchCount()) phase4SoftwareTimerContextSwitchCount {2};
 
+#endif	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | local functions
 +---------------------------------------------------------------------------------------------------------------------*/
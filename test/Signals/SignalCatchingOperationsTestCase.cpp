@@ -14,8 +14,12 @@
 #include "distortos/distortosConfiguration.h"
 
 /// configuration required by SignalCatchingOperationsTestCase
-#define SIGNAL_CATCHING_OPERATIONS_TEST_CASE_ENABLED defined(CONFIG_MAIN_THREAD_SIGNAL_ACTIONS) && \
-		CONFIG_MAIN_THREAD_SIGNAL_ACTIONS >= 1 && CONFIG_MAIN_THREAD_SIGNAL_ACTIONS <= 31
+#if defined(CONFIG_MAIN_THREAD_SIGNAL_ACTIONS) && CONFIG_MAIN_THREAD_SIGNAL_ACTIONS >= 1 && \
+		CONFIG_MAIN_THREAD_SIGNAL_ACTIONS <= 31
+#define SIGNAL_CATCHING_OPERATIONS_TEST_CASE_ENABLED 1
+#else	// configuration not suitable for SignalCatchingOperationsTestCase
+#define SIGNAL_CATCHING_OPERATIONS_TEST_CASE_ENABLED 0
+#endif	// configuration not suitable for SignalCatchingOperationsTestCase
 
 #if SIGNAL_CATCHING_OPERATIONS_TEST_CASE_ENABLED == 1
 
@@ -83,7 +87,7 @@ bool phase1()
 		{
 			// last iteration? clip the value so that it is identical to the one from previous iteration
 			const auto realMask = mask <= mainThreadSignalActions ? mask : mainThreadSignalActions;
-			const SignalSet signalMask {((realMask + signalNumber) % mainThreadSignalActions)};
+			const SignalSet signalMask {static_cast<uint32_t>((realMask + signalNumber) % mainThreadSignalActions)};
 			const auto setSignalActionResult = ThisThread::Signals::setSignalAction(signalNumber,
 					{abortSignalHandler, signalMask});
 			if (setSignalActionResult.first != 0)
@@ -95,7 +99,8 @@ bool phase1()
 			}
 			else	// compare returned signal action with the expected one
 			{
-				const SignalSet previousSignalMask {((mask - 1 + signalNumber) % mainThreadSignalActions)};
+				const SignalSet previousSignalMask {static_cast<uint32_t>((mask - 1 + signalNumber) %
+						mainThreadSignalActions)};
 				if (setSignalActionResult.second.getHandler() != abortSignalHandler ||
 						setSignalActionResult.second.getSignalMask().getBitset() != previousSignalMask.getBitset())
 					return false;
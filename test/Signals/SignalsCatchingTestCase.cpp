@@ -14,9 +14,12 @@
 #include "distortos/distortosConfiguration.h"
 
 /// configuration required by SignalsCatchingTestCase
-#define SIGNALS_CATCHING_TEST_CASE_ENABLED defined(CONFIG_MAIN_THREAD_QUEUED_SIGNALS) && \
-		CONFIG_MAIN_THREAD_QUEUED_SIGNALS >= 10 && defined(CONFIG_MAIN_THREAD_SIGNAL_ACTIONS) && \
-		CONFIG_MAIN_THREAD_SIGNAL_ACTIONS >= 10
+#if defined(CONFIG_MAIN_THREAD_QUEUED_SIGNALS) && CONFIG_MAIN_THREAD_QUEUED_SIGNALS >= 10 && \
+		defined(CONFIG_MAIN_THREAD_SIGNAL_ACTIONS) && CONFIG_MAIN_THREAD_SIGNAL_ACTIONS >= 10
+#define SIGNALS_CATCHING_TEST_CASE_ENABLED 1
+#else	// configuration not suitable for SignalsCatchingTestCase
+#define SIGNALS_CATCHING_TEST_CASE_ENABLED 0
+#endif	// configuration not suitable for SignalsCatchingTestCase
 
 #if SIGNALS_CATCHING_TEST_CASE_ENABLED == 1
 
@@ -1792,13 +1795,27 @@ const TestStep phase3SecondTestThreadStepsRange[]
 		{480, 495, false, ThreadPriorityStep{mainTestThreadPriority}},
 };
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// expected number of context switches in second phase - each of 43 software timers is executed by software timer
+/// thread, which preempts main test thread and then waits for next software timer
+constexpr decltype(statistics::getContextSwitchCount()) phase2ContextSwitchCount {43 * 2};
+
+#else	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// expected number of context switches in second phase - all software timers are executed in interrupt
+constexpr decltype(statistics::getContextSwitchCount()) phase2ContextSwitchCount {};
+
+#endif	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 /// test stages
 const Stage stages[]
 {
 		// tests catching of signals generated/queued by current thread for itself
 		{TestStepsRange{phase1MainTestThreadSteps}, TestStepsRange{phase1SignalHandlerSteps}, TestStepsRange{}, 0},
 		// tests catching of signals generated/queued by interrupt (via software timer) for current thread
-		{TestStepsRange{phase2MainTestThreadSteps}, TestStepsRange{phase2SignalHandlerSteps}, TestStepsRange{}, 0},
+		{TestStepsRange{phase2MainTestThreadSteps}, TestStepsRange{phase2SignalHandlerSteps}, TestStepsRange{},
+				phase2ContextSwitchCount},
 		// tests catching of signals generated/queued by second test thread for main test thread
 		{TestStepsRange{phase3MainTestThreadSteps}, TestStepsRange{phase3SignalHandlerSteps},
 				TestStepsRange{phase3SecondTestThreadStepsRange}, 43 * 2 + 2},
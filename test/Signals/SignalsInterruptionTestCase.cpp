@@ -14,9 +14,12 @@
 #include "distortos/distortosConfiguration.h"
 
 /// configuration required by SignalsInterruptionTestCase
-#define SIGNALS_INTERRUPTION_TEST_CASE_ENABLED defined(CONFIG_MAIN_THREAD_QUEUED_SIGNALS) && \
-		CONFIG_MAIN_THREAD_QUEUED_SIGNALS > 0 && defined(CONFIG_MAIN_THREAD_SIGNAL_ACTIONS) && \
-		CONFIG_MAIN_THREAD_SIGNAL_ACTIONS > 0
+#if defined(CONFIG_MAIN_THREAD_QUEUED_SIGNALS) && CONFIG_MAIN_THREAD_QUEUED_SIGNALS > 0 && \
+		defined(CONFIG_MAIN_THREAD_SIGNAL_ACTIONS) && CONFIG_MAIN_THREAD_SIGNAL_ACTIONS > 0
+#define SIGNALS_INTERRUPTION_TEST_CASE_ENABLED 1
+#else	// configuration not suitable for SignalsInterruptionTestCase
+#define SIGNALS_INTERRUPTION_TEST_CASE_ENABLED 0
+#endif	// configuration not suitable for SignalsInterruptionTestCase
 
 #if SIGNALS_INTERRUPTION_TEST_CASE_ENABLED == 1
 
@@ -192,7 +195,9 @@ private:
 	void signalingThreadFunction(SequenceAsserter& sequenceAsserter, Thread& thread) const
 	{
 		sequenceAsserter.sequencePoint(signalingThreadSequencePoint1_);
-		thread.queueSignal(signalHandlerSequencePoint_, sigval{reinterpret_cast<int>(&sequenceAsserter)});
+		sigval value {};
+		value.sival_ptr = &sequenceAsserter;
+		thread.queueSignal(signalHandlerSequencePoint_, value);
 		sequenceAsserter.sequencePoint(signalingThreadSequencePoint2_);
 	}
 
@@ -25,6 +25,8 @@
 #include "distortos/ThisThread.hpp"
 #include "distortos/ThisThread-Signals.hpp"
 
+#include <array>
+
 #include <cerrno>
 
 #endif	// def CONFIG_MAIN_THREAD_CAN_RECEIVE_SIGNALS
@@ -74,10 +76,22 @@ constexpr decltype(statistics::getContextSwitchCount()) waitForNextTickContextSw
 /// (idle -> main)
 constexpr decltype(statistics::getContextSwitchCount()) phase1TimedOutWaitContextSwitchCount {2};
 
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/// expected number of context switches in phase2 block involving software timer (excluding waitForNextTick()): 1 - main
+/// thread blocks waiting for signals (main -> idle), 2 - software timer thread is woken by interrupt (idle -> software
+/// timer thread), 3 - main thread is unblocked by software timer thread, which then waits for next software timer
+/// (software timer thread -> main)
+constexpr decltype(statistics::getContextSwitchCount()) phase2SoftwareTimerContextSwitchCount {3};
+
+#else	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 /// expected number of context switches in phase2 block involving software timer (excluding waitForNextTick()): 1 - main
 /// thread blocks waiting for signals (main -> idle), 2 - main thread is unblocked by interrupt (idle -> main)
 constexpr decltype(statistics::getContextSwitchCount()) phase2SoftwareTimerContextSwitchCount {2};
 
+#endif	// !def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
 /// expected number of context switches in phase3 block involving thread: 1 - main thread is preempted by test thread
 /// (main -> test), 2 - test thread terminates (test -> main)
 constexpr decltype(statistics::getContextSwitchCount()) phase3ThreadContextSwitchCount {2};
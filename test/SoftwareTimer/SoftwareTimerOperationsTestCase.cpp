@@ -84,6 +84,23 @@ bool SoftwareTimerOperationsTestCase::run_() const
 	if (softwareTimer.isRunning() != false || value != 2 || TickClock::now() != wakeUpTimePoint)
 		return false;
 
+	SoftwareTimer* selfStoppingSoftwareTimerPointer {};
+	auto selfStoppingSoftwareTimer = makeStaticSoftwareTimer(
+			[&value, &selfStoppingSoftwareTimerPointer]()
+			{
+				++value;
+				selfStoppingSoftwareTimerPointer->stop();
+			});
+	selfStoppingSoftwareTimerPointer = &selfStoppingSoftwareTimer;
+
+	waitForNextTick();
+	selfStoppingSoftwareTimer.start(TickClock::duration{1}, TickClock::duration{1});	// periodic
+	ThisThread::sleepFor(singleDuration);
+
+	// periodic software timer stopped in its own function must be executed only once
+	if (selfStoppingSoftwareTimer.isRunning() != false || value != 3)
+		return false;
+
 	return true;
 }
 
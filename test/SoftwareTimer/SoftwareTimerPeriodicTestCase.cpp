@@ -17,6 +17,8 @@
 #include "distortos/StaticSoftwareTimer.hpp"
 #include "distortos/ThisThread.hpp"
 
+#include <array>
+
 namespace distortos
 {
 
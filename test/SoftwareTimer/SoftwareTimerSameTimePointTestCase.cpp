@@ -0,0 +1,95 @@
+/**
+ * \file
+ * \brief SoftwareTimerSameTimePointTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SoftwareTimerSameTimePointTestCase.hpp"
+
+#include "SequenceAsserter.hpp"
+
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/ThisThread.hpp"
+
+#include <array>
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// delays between start of software timers and their common expiration time point, ticks, in the order of start
+constexpr TickClock::rep delays[] {100, 70, 40, 20, 17, 9, 5, 3, 2, 1};
+
+/// total number of software timers used in test case
+constexpr size_t totalSoftwareTimers {sizeof(delays) / sizeof(*delays)};
+
+/// expiration time point is a multiple of this value, so that it begins a slot on as many levels of timing wheel as
+/// possible
+constexpr TickClock::rep timePointAlignment {64};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerSameTimePointTestCase::run_() const
+{
+	SequenceAsserter sequenceAsserter;
+
+	using TestSoftwareTimer = decltype(makeStaticSoftwareTimer(&SequenceAsserter::sequencePoint,
+			std::ref(std::declval<SequenceAsserter&>()), std::declval<unsigned int>()));
+	std::array<TestSoftwareTimer, totalSoftwareTimers> softwareTimers
+	{{
+			makeStaticSoftwareTimer(&SequenceAsserter::sequencePoint, std::ref(sequenceAsserter), 0u),
+			makeStaticSoftwareTimer(&SequenceAsserter::sequencePoint, std::ref(sequenceAsserter), 1u),
+			makeStaticSoftwareTimer(&SequenceAsserter::sequencePoint, std::ref(sequenceAsserter), 2u),
+			makeStaticSoftwareTimer(&SequenceAsserter::sequencePoint, std::ref(sequenceAsserter), 3u),
+			makeStaticSoftwareTimer(&SequenceAsserter::sequencePoint, std::ref(sequenceAsserter), 4u),
+			makeStaticSoftwareTimer(&SequenceAsserter::sequencePoint, std::ref(sequenceAsserter), 5u),
+			makeStaticSoftwareTimer(&SequenceAsserter::sequencePoint, std::ref(sequenceAsserter), 6u),
+			makeStaticSoftwareTimer(&SequenceAsserter::sequencePoint, std::ref(sequenceAsserter), 7u),
+			makeStaticSoftwareTimer(&SequenceAsserter::sequencePoint, std::ref(sequenceAsserter), 8u),
+			makeStaticSoftwareTimer(&SequenceAsserter::sequencePoint, std::ref(sequenceAsserter), 9u),
+	}};
+
+	const auto tick = TickClock::now().time_since_epoch().count() + delays[0];
+	const TickClock::time_point timePoint
+	{TickClock::duration{(tick + timePointAlignment - 1) / timePointAlignment * timePointAlignment}};
+
+	for (size_t i {}; i < softwareTimers.size(); ++i)
+	{
+		ThisThread::sleepUntil(timePoint - TickClock::duration{delays[i]});
+		if (softwareTimers[i].start(timePoint) != 0)
+			return false;
+	}
+
+	if (sequenceAsserter.assertSequence(0) == false)
+		return false;
+
+	for (const auto& softwareTimer : softwareTimers)
+		while(softwareTimer.isRunning())
+		{
+
+		}
+
+	return sequenceAsserter.assertSequence(totalSoftwareTimers);
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,49 @@
+/**
+ * \file
+ * \brief SoftwareTimerSameTimePointTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_SOFTWARETIMER_SOFTWARETIMERSAMETIMEPOINTTESTCASE_HPP_
+#define TEST_SOFTWARETIMER_SOFTWARETIMERSAMETIMEPOINTTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests ordering of software timers with the same expiration time point.
+ *
+ * Starts 10 software timers with the same expiration time point at different moments, so that their delays vary from
+ * 1 tick to more than 100 ticks, asserting that they execute in the order in which they were started. With
+ * CONFIG_SOFTWARE_TIMER_TIMING_WHEEL software timers started earlier are moved from higher levels of the wheel to the
+ * slot which already contains software timers started later.
+ */
+
+class SoftwareTimerSameTimePointTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SOFTWARETIMER_SOFTWARETIMERSAMETIMEPOINTTESTCASE_HPP_
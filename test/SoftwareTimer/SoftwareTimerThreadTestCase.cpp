@@ -0,0 +1,210 @@
+/**
+ * \file
+ * \brief SoftwareTimerThreadTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SoftwareTimerThreadTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// single duration used in tests
+constexpr auto singleDuration = TickClock::duration{1};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests whether functions of software timers are executed in software timer thread and whether they may block. While
+ * function of first software timer is blocked, second software timer with the same expiration time point waits for
+ * execution - it must be still running and counted in the backlog. Stopping it must remove it from the backlog, so its
+ * function is never executed.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	Semaphore semaphore {0};
+	const Thread* executingThread {};
+	auto blockingSoftwareTimer = makeStaticSoftwareTimer(
+			[&semaphore, &executingThread]()
+			{
+				executingThread = &ThisThread::get();
+				semaphore.wait();
+			});
+	size_t executions {};
+	auto deferredSoftwareTimer = makeStaticSoftwareTimer(
+			[&executions]()
+			{
+				++executions;
+			});
+
+	waitForNextTick();
+
+	const auto timePoint = TickClock::now() + singleDuration;
+	if (blockingSoftwareTimer.start(timePoint) != 0 || deferredSoftwareTimer.start(timePoint) != 0)
+		return false;
+
+	ThisThread::sleepUntil(timePoint + singleDuration);
+
+	if (executingThread == nullptr || executingThread == &ThisThread::get() ||
+			blockingSoftwareTimer.isRunning() != false || deferredSoftwareTimer.isRunning() != true ||
+			statistics::getSoftwareTimerBacklog() != 1 || statistics::getMaxSoftwareTimerBacklog() < 2)
+		return false;
+
+	if (deferredSoftwareTimer.stop() != 0 || deferredSoftwareTimer.isRunning() != false ||
+			statistics::getSoftwareTimerBacklog() != 0)
+		return false;
+
+	if (semaphore.post() != 0)
+		return false;
+
+	ThisThread::sleepFor(singleDuration);
+
+	return executions == 0 && semaphore.getValue() == 0 && statistics::getSoftwareTimerBacklog() == 0;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests backlog of software timers with the same expiration time point - when function of first software timer is
+ * executed, other two must be waiting in the backlog. First software timer stops second one, which must not be
+ * executed.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	size_t executions {};
+	auto secondSoftwareTimer = makeStaticSoftwareTimer(
+			[&executions]()
+			{
+				++executions;
+			});
+	auto thirdSoftwareTimer = makeStaticSoftwareTimer(
+			[&executions]()
+			{
+				++executions;
+			});
+	size_t backlog {};
+	int stopRet {-1};
+	auto firstSoftwareTimer = makeStaticSoftwareTimer(
+			[&backlog, &stopRet, &secondSoftwareTimer]()
+			{
+				backlog = statistics::getSoftwareTimerBacklog();
+				stopRet = secondSoftwareTimer.stop();
+			});
+
+	waitForNextTick();
+
+	const auto timePoint = TickClock::now() + singleDuration;
+	if (firstSoftwareTimer.start(timePoint) != 0 || secondSoftwareTimer.start(timePoint) != 0 ||
+			thirdSoftwareTimer.start(timePoint) != 0)
+		return false;
+
+	ThisThread::sleepUntil(timePoint + singleDuration);
+
+	return backlog == 2 && stopRet == 0 && executions == 1 && firstSoftwareTimer.isRunning() == false &&
+			secondSoftwareTimer.isRunning() == false && thirdSoftwareTimer.isRunning() == false &&
+			statistics::getSoftwareTimerBacklog() == 0 && statistics::getMaxSoftwareTimerBacklog() >= 3;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests periodic software timer which is stopped while it waits for execution - it must be neither executed nor
+ * restarted.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	Semaphore semaphore {0};
+	auto blockingSoftwareTimer = makeStaticSoftwareTimer(&Semaphore::wait, std::ref(semaphore));
+	size_t executions {};
+	auto periodicSoftwareTimer = makeStaticSoftwareTimer(
+			[&executions]()
+			{
+				++executions;
+			});
+
+	waitForNextTick();
+
+	const auto timePoint = TickClock::now() + singleDuration;
+	if (blockingSoftwareTimer.start(timePoint) != 0 || periodicSoftwareTimer.start(timePoint, singleDuration) != 0)
+		return false;
+
+	ThisThread::sleepUntil(timePoint + singleDuration);
+
+	if (periodicSoftwareTimer.stop() != 0 || semaphore.post() != 0)
+		return false;
+
+	ThisThread::sleepFor(singleDuration * 3);
+
+	return executions == 0 && periodicSoftwareTimer.isRunning() == false && statistics::getSoftwareTimerBacklog() == 0;
+}
+
+}	// namespace
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerThreadTestCase::run_() const
+{
+#ifdef CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	for (const auto& function : {phase1, phase2, phase3})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+#endif	// def CONFIG_SOFTWARE_TIMER_THREAD_ENABLE
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,48 @@
+/**
+ * \file
+ * \brief SoftwareTimerThreadTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_SOFTWARETIMER_SOFTWARETIMERTHREADTESTCASE_HPP_
+#define TEST_SOFTWARETIMER_SOFTWARETIMERTHREADTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests software timer thread.
+ *
+ * Tests execution of functions of software timers in software timer thread, stopping of expired software timers which
+ * wait for execution by this thread and statistics of the backlog of such software timers. When
+ * CONFIG_SOFTWARE_TIMER_THREAD_ENABLE is not selected, this test case does nothing.
+ */
+
+class SoftwareTimerThreadTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SOFTWARETIMER_SOFTWARETIMERTHREADTESTCASE_HPP_
@@ -0,0 +1,117 @@
+/**
+ * \file
+ * \brief SoftwareTimerTicklessIdleTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "SoftwareTimerTicklessIdleTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/statistics.hpp"
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// delays between start of software timer and its expiration, ticks
+constexpr TickClock::rep delays[] {2, 9, 50};
+
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+/// allowed difference between real duration of sleep and duration measured in ticks, percent of the latter
+constexpr uint64_t runTimeTolerance {10};
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+}	// namespace
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool SoftwareTimerTicklessIdleTestCase::run_() const
+{
+#ifdef CONFIG_TICKLESS_IDLE_ENABLE
+
+	for (const auto delay : delays)
+	{
+		Semaphore semaphore {0};
+		TickClock::time_point expirationTimePoint {};
+		auto softwareTimer = makeStaticSoftwareTimer(
+				[&semaphore, &expirationTimePoint]()
+				{
+					expirationTimePoint = TickClock::now();
+					semaphore.post();
+				});
+
+		waitForNextTick();
+
+		const auto timePoint = TickClock::now() + TickClock::duration{delay};
+		const auto idleTickCount = statistics::getIdleTickCount();
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+		const auto totalRunTime = statistics::getTotalRunTime();
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+		if (softwareTimer.start(timePoint) != 0)
+			return false;
+
+		// idle thread is the only runnable thread, so "tick" interrupts are suppressed until expiration of the timer
+		if (semaphore.wait() != 0)
+			return false;
+
+		if (expirationTimePoint != timePoint)
+			return false;
+
+		// all ticks (except the one in which the software timer was started) were spent in idle thread
+		if (statistics::getIdleTickCount() - idleTickCount < static_cast<uint64_t>(delay - 1))
+			return false;
+
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+		// ticks which were suppressed must be accounted exactly once, so the real duration must match
+		const auto runTime = statistics::getTotalRunTime() - totalRunTime;
+		const auto expectedRunTime = static_cast<uint64_t>(delay) * statistics::getRunTimeFrequency() /
+				CONFIG_TICK_FREQUENCY;
+		const auto allowedDifference = expectedRunTime * runTimeTolerance / 100 +
+				statistics::getRunTimeFrequency() / CONFIG_TICK_FREQUENCY;
+		if (runTime + allowedDifference < expectedRunTime || runTime > expectedRunTime + allowedDifference)
+			return false;
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+	}
+
+#endif	// def CONFIG_TICKLESS_IDLE_ENABLE
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
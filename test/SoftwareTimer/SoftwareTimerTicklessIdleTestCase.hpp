@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief SoftwareTimerTicklessIdleTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_SOFTWARETIMER_SOFTWARETIMERTICKLESSIDLETESTCASE_HPP_
+#define TEST_SOFTWARETIMER_SOFTWARETIMERTICKLESSIDLETESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests expiration of software timers when "tick" interrupts are suppressed in tickless idle mode.
+ *
+ * Starts software timers with various delays and blocks until they expire, so that idle thread is the only runnable
+ * thread and "tick" interrupts are suppressed until the expiration. Asserts that the software timer is executed
+ * exactly at its time point, that the suppressed ticks are accounted as idle ticks and - if run time statistics are
+ * enabled - that the tick count advanced by the same amount as the real time. Does nothing if
+ * CONFIG_TICKLESS_IDLE_ENABLE is not selected.
+ */
+
+class SoftwareTimerTicklessIdleTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_SOFTWARETIMER_SOFTWARETIMERTICKLESSIDLETESTCASE_HPP_
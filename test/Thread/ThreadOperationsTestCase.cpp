@@ -11,7 +11,9 @@
 
 #include "ThreadOperationsTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "waitForNextTick.hpp"
+#include "wasteTime.hpp"
 
 #include "distortos/architecture/InterruptMaskingLock.hpp"
 
@@ -20,8 +22,6 @@
 #include "distortos/statistics.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
-
 #include <cerrno>
 
 namespace distortos
@@ -33,6 +33,17 @@ namespace test
 namespace
 {
 
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of buffer on stack used by stackUsingFunction(), bytes
+constexpr size_t stackUsingFunctionBufferSize {256};
+
+#endif	// def CONFIG_STACK_PAINTING_ENABLE
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | local functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -46,6 +57,21 @@ void emptyFunction()
 
 }
 
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+
+/**
+ * \brief Function used for test threads which writes to a buffer of stackUsingFunctionBufferSize bytes on stack
+ */
+
+void stackUsingFunction()
+{
+	volatile uint8_t buffer[stackUsingFunctionBufferSize];
+	for (auto& element : buffer)
+		element = {};
+}
+
+#endif	// def CONFIG_STACK_PAINTING_ENABLE
+
 /**
  * \brief Phase 1 of test case
  *
@@ -139,7 +165,7 @@ bool phase3()
 {
 #ifdef CONFIG_THREAD_DETACH_ENABLE
 
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 	const auto lambda =
 			[](int& sharedRet)
 			{
@@ -175,7 +201,7 @@ bool phase3()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// detaching dynamic thread that is started, but not yet terminated, must succeed
@@ -196,7 +222,7 @@ bool phase3()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// self-detach of dynamic thread must succeed
@@ -217,7 +243,7 @@ bool phase3()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	// detaching dynamic thread that is already terminated must succeed, the thread is just deleted
@@ -235,7 +261,7 @@ bool phase3()
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 #endif	// def CONFIG_THREAD_DETACH_ENABLE
@@ -243,6 +269,120 @@ bool phase3()
 	return true;
 }
 
+/**
+ * \brief Phase 4 of test case
+ *
+ * Tests run time statistics of threads.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	constexpr auto wastedTicks = 4;
+
+	auto testThread = makeDynamicThread({192, UINT8_MAX},
+			[](const TickClock::duration duration)
+			{
+				wasteTime(duration);
+			}, TickClock::duration{wastedTicks});
+	if (testThread.getRunTime() != 0)	// thread which was not started yet must have no run time
+		return false;
+
+	const auto mainThreadRunTime = ThisThread::get().getRunTime();
+	const auto totalRunTime = statistics::getTotalRunTime();
+
+	testThread.start();
+	testThread.join();
+
+	const auto testThreadRunTime = testThread.getRunTime();
+	const auto totalRunTimeDelta = statistics::getTotalRunTime() - totalRunTime;
+	const auto mainThreadRunTimeDelta = ThisThread::get().getRunTime() - mainThreadRunTime;
+
+	// "tick" interrupts are not charged to the thread, so one tick less than wasted duration is required
+	const auto minimalRunTime = static_cast<uint64_t>(wastedTicks - 1) * statistics::getRunTimeFrequency() /
+			CONFIG_TICK_FREQUENCY;
+	if (testThreadRunTime < minimalRunTime || testThreadRunTime > totalRunTimeDelta)
+		return false;
+
+	// main thread was blocked while test thread was running
+	if (mainThreadRunTimeDelta >= testThreadRunTime)
+		return false;
+
+	if (testThread.getRunTime() != testThreadRunTime)	// terminated thread must not accumulate run time
+		return false;
+
+#endif	// def CONFIG_STATISTICS_RUN_TIME_ENABLE
+
+	return true;
+}
+
+/**
+ * \brief Phase 5 of test case
+ *
+ * Tests measurement of stack usage of threads.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase5()
+{
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+
+	constexpr size_t testThreadStackSize {1024};
+
+	auto emptyThread = makeStaticThread<testThreadStackSize>(UINT8_MAX, emptyFunction);
+	auto stackUsingThread = makeStaticThread<testThreadStackSize>(UINT8_MAX, stackUsingFunction);
+
+	// stack of thread which was not started yet is not used at all
+	if (emptyThread.getStackHighWaterMark() != 0 || stackUsingThread.getStackHighWaterMark() != 0)
+		return false;
+
+	if (emptyThread.start() != 0 || emptyThread.join() != 0 || stackUsingThread.start() != 0 ||
+			stackUsingThread.join() != 0)
+		return false;
+
+	const auto emptyThreadHighWaterMark = emptyThread.getStackHighWaterMark();
+	const auto stackUsingThreadHighWaterMark = stackUsingThread.getStackHighWaterMark();
+	if (emptyThreadHighWaterMark > testThreadStackSize || stackUsingThreadHighWaterMark > testThreadStackSize)
+		return false;
+
+	if (emptyThreadHighWaterMark == 0 ||
+			stackUsingThreadHighWaterMark < emptyThreadHighWaterMark + stackUsingFunctionBufferSize)
+		return false;
+
+	statistics::StackUsage stackUsages[16] {};
+	const auto threads = statistics::getStackUsage(estd::ContiguousRange<statistics::StackUsage>{stackUsages});
+	// at least main thread, idle thread and both test threads must be reported
+	if (threads < 4 || threads > sizeof(stackUsages) / sizeof(*stackUsages))
+		return false;
+
+	size_t found {};
+	for (size_t i {}; i < threads; ++i)
+	{
+		const auto& stackUsage = stackUsages[i];
+		if (stackUsage.thread == nullptr || stackUsage.stackHighWaterMark > stackUsage.stackSize)
+			return false;
+
+		if (stackUsage.thread == &emptyThread || stackUsage.thread == &stackUsingThread)
+		{
+			if (stackUsage.stackHighWaterMark != stackUsage.thread->getStackHighWaterMark())
+				return false;
+
+			++found;
+		}
+	}
+
+	if (found != 2)
+		return false;
+
+#endif	// def CONFIG_STACK_PAINTING_ENABLE
+
+	return true;
+}
+
 }	// namespace
 
 /*---------------------------------------------------------------------------------------------------------------------+
@@ -258,19 +398,29 @@ bool ThreadOperationsTestCase::run_() const
 #else	// !def CONFIG_THREAD_DETACH_ENABLE
 	constexpr auto phase3ExpectedContextSwitchCount = 0;
 #endif	// !def CONFIG_THREAD_DETACH_ENABLE
+#ifdef CONFIG_STATISTICS_RUN_TIME_ENABLE
+	constexpr auto phase4ExpectedContextSwitchCount = 2;
+#else	// !def CONFIG_STATISTICS_RUN_TIME_ENABLE
+	constexpr auto phase4ExpectedContextSwitchCount = 0;
+#endif	// !def CONFIG_STATISTICS_RUN_TIME_ENABLE
+#ifdef CONFIG_STACK_PAINTING_ENABLE
+	constexpr auto phase5ExpectedContextSwitchCount = 4;
+#else	// !def CONFIG_STACK_PAINTING_ENABLE
+	constexpr auto phase5ExpectedContextSwitchCount = 0;
+#endif	// !def CONFIG_STACK_PAINTING_ENABLE
 	constexpr auto expectedContextSwitchCount = phase1ExpectedContextSwitchCount + phase2ExpectedContextSwitchCount +
-			phase3ExpectedContextSwitchCount;
+			phase3ExpectedContextSwitchCount + phase4ExpectedContextSwitchCount + phase5ExpectedContextSwitchCount;
 
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 	const auto contextSwitchCount = statistics::getContextSwitchCount();
 
-	for (const auto& function : {phase1, phase2, phase3})
+	for (const auto& function : {phase1, phase2, phase3, phase4, phase5})
 	{
 		const auto ret = function();
 		if (ret != true)
 			return ret;
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
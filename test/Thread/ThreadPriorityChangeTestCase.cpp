@@ -11,12 +11,13 @@
 
 #include "ThreadPriorityChangeTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "SequenceAsserter.hpp"
 
 #include "distortos/DynamicThread.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
+#include <array>
 
 namespace distortos
 {
@@ -80,7 +81,7 @@ DynamicThread makeAndStartTestThread(const uint8_t priority, SequenceAsserter& s
 
 bool ThreadPriorityChangeTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	{
 		// difference required for this whole test to work
@@ -133,7 +134,7 @@ bool ThreadPriorityChangeTestCase::run_() const
 			return false;
 	}
 
-	if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+	if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 		return false;
 
 	return true;
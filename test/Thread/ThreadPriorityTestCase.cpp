@@ -11,6 +11,7 @@
 
 #include "ThreadPriorityTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "priorityTestPhases.hpp"
 #include "SequenceAsserter.hpp"
 
@@ -18,8 +19,6 @@
 
 #include "distortos/DynamicThread.hpp"
 
-#include <malloc.h>
-
 namespace distortos
 {
 
@@ -77,7 +76,7 @@ DynamicThread makeTestThread(const ThreadParameters& threadParameters, SequenceA
 
 bool ThreadPriorityTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	for (const auto& phase : priorityTestPhases)
 	{
@@ -112,7 +111,7 @@ bool ThreadPriorityTestCase::run_() const
 				return false;
 		}
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
@@ -11,6 +11,7 @@
 
 #include "ThreadSchedulingPolicyTestCase.hpp"
 
+#include "getAllocatedMemory.hpp"
 #include "SequenceAsserter.hpp"
 #include "wasteTime.hpp"
 
@@ -19,7 +20,7 @@
 #include "distortos/DynamicThread.hpp"
 #include "distortos/ThisThread.hpp"
 
-#include <malloc.h>
+#include <array>
 
 namespace distortos
 {
@@ -99,7 +100,7 @@ DynamicThread makeTestThread(const SchedulingPolicy schedulingPolicy, SequenceAs
 
 bool ThreadSchedulingPolicyTestCase::run_() const
 {
-	const auto allocatedMemory = mallinfo().uordblks;
+	const auto allocatedMemory = getAllocatedMemory();
 
 	// scheduling policy, sequence point multiplier, sequence point step
 	using Parameters = std::tuple<SchedulingPolicy, unsigned int, unsigned int>;
@@ -159,7 +160,7 @@ bool ThreadSchedulingPolicyTestCase::run_() const
 				return false;
 		}
 
-		if (mallinfo().uordblks != allocatedMemory)	// dynamic memory must be deallocated after each test phase
+		if (getAllocatedMemory() != allocatedMemory)	// dynamic memory must be deallocated after each test phase
 			return false;
 	}
 
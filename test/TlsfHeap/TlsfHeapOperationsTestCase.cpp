@@ -0,0 +1,369 @@
+/**
+ * \file
+ * \brief TlsfHeapOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "TlsfHeapOperationsTestCase.hpp"
+
+#include "distortos/statistics.hpp"
+#include "distortos/TlsfHeap.hpp"
+
+#include <array>
+
+#include <cerrno>
+#include <cstring>
+
+#ifdef CONFIG_TLSF_HEAP_ENABLE
+
+#include <malloc.h>
+
+#endif	// def CONFIG_TLSF_HEAP_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of the first region used in tests, bytes
+constexpr size_t firstRegionSize {1024};
+
+/// size of the second region used in tests, bytes
+constexpr size_t secondRegionSize {512};
+
+/// space of each region used by header of the first block and by the marker of its end, bytes
+constexpr size_t regionOverhead {2 * TlsfHeap::alignment};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// storage for the first region used in tests
+alignas(TlsfHeap::alignment) uint8_t firstRegion[firstRegionSize];
+
+/// storage for the second region used in tests
+alignas(TlsfHeap::alignment) uint8_t secondRegion[secondRegionSize];
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Checks whether the heap has no used blocks and its free space is fully merged.
+ *
+ * \param [in] tlsfHeap is a reference to tested heap
+ * \param [in] regions is the number of regions of the heap
+ * \param [in] totalSize is the expected total size of the heap, bytes
+ *
+ * \return true if the heap is empty and fully merged, false otherwise
+ */
+
+bool isEmpty(const TlsfHeap& tlsfHeap, const size_t regions, const size_t totalSize)
+{
+	const auto statistics = tlsfHeap.getStatistics();
+	return statistics.totalSize == totalSize && statistics.freeSize == totalSize && statistics.freeBlocks == regions &&
+			statistics.usedBlocks == 0;
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests allocation and deallocation of blocks with various sizes, merging of free blocks, statistics and behaviour of
+ * exhausted heap.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	constexpr size_t totalSize {firstRegionSize - regionOverhead};
+
+	TlsfHeap tlsfHeap;
+	if (tlsfHeap.addRegion(firstRegion, regionOverhead) != false || isEmpty(tlsfHeap, 0, 0) != true)
+		return false;
+
+	if (tlsfHeap.addRegion(firstRegion, sizeof(firstRegion)) != true || isEmpty(tlsfHeap, 1, totalSize) != true ||
+			tlsfHeap.getStatistics().largestFreeBlockSize != totalSize || tlsfHeap.getStatistics().maxUsedSize != 0)
+		return false;
+
+	constexpr std::array<size_t, 6> sizes {{1, 7, TlsfHeap::alignment, 100, 3, 64}};
+	std::array<void*, sizes.size()> blocks {};
+	for (size_t i {}; i < blocks.size(); ++i)
+	{
+		blocks[i] = tlsfHeap.allocate(sizes[i]);
+		if (blocks[i] == nullptr || reinterpret_cast<uintptr_t>(blocks[i]) % TlsfHeap::alignment != 0 ||
+				TlsfHeap::getUsableSize(blocks[i]) < sizes[i] || tlsfHeap.getStatistics().usedBlocks != i + 1)
+			return false;
+
+		memset(blocks[i], static_cast<int>(i), TlsfHeap::getUsableSize(blocks[i]));
+	}
+
+	// contents of all blocks must be intact - blocks don't overlap each other or the headers
+	for (size_t i {}; i < blocks.size(); ++i)
+		for (size_t j {}; j < TlsfHeap::getUsableSize(blocks[i]); ++j)
+			if (static_cast<uint8_t*>(blocks[i])[j] != i)
+				return false;
+
+	const auto maxUsedSize = tlsfHeap.getStatistics().maxUsedSize;
+	if (maxUsedSize == 0 || maxUsedSize != totalSize - tlsfHeap.getStatistics().freeSize)
+		return false;
+
+	// free every second block first - no merging is possible, so there are "holes" in the heap
+	for (size_t i {}; i < blocks.size(); i += 2)
+		tlsfHeap.deallocate(blocks[i]);
+
+	{
+		const auto statistics = tlsfHeap.getStatistics();
+		if (statistics.usedBlocks != blocks.size() / 2 || statistics.freeBlocks != blocks.size() / 2 + 1 ||
+				statistics.largestFreeBlockSize >= statistics.freeSize || statistics.maxUsedSize != maxUsedSize)
+			return false;
+	}
+
+	for (size_t i {1}; i < blocks.size(); i += 2)
+		tlsfHeap.deallocate(blocks[i]);
+	tlsfHeap.deallocate(nullptr);
+
+	if (isEmpty(tlsfHeap, 1, totalSize) != true || tlsfHeap.getStatistics().largestFreeBlockSize != totalSize ||
+			tlsfHeap.allocate(totalSize + 1) != nullptr)
+		return false;
+
+	// exhaust the heap with small blocks
+	std::array<void*, totalSize / (2 * TlsfHeap::alignment)> smallBlocks {};
+	size_t allocated {};
+	while (allocated < smallBlocks.size() && (smallBlocks[allocated] = tlsfHeap.allocate(1)) != nullptr)
+		++allocated;
+
+	if (allocated < totalSize / (2 * TlsfHeap::alignment) - 1 || tlsfHeap.allocate(1) != nullptr ||
+			tlsfHeap.getStatistics().maxUsedSize < totalSize - TlsfHeap::alignment)
+		return false;
+
+	for (size_t i {}; i < allocated; ++i)
+		tlsfHeap.deallocate(smallBlocks[i]);
+
+	return isEmpty(tlsfHeap, 1, totalSize);
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests allocation of blocks with alignment greater than default.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	constexpr size_t totalSize {firstRegionSize - regionOverhead};
+
+	TlsfHeap tlsfHeap;
+	if (tlsfHeap.addRegion(firstRegion, sizeof(firstRegion)) != true)
+		return false;
+
+	if (tlsfHeap.allocateAligned(0, 1) != nullptr || tlsfHeap.allocateAligned(TlsfHeap::alignment + 1, 1) != nullptr)
+		return false;
+
+	// first block shifts the whole heap, so the next blocks are not aligned "by accident"
+	const auto firstBlock = tlsfHeap.allocate(1);
+	if (firstBlock == nullptr)
+		return false;
+
+	constexpr std::array<size_t, 4> alignments {{1, TlsfHeap::alignment, 64, 128}};
+	std::array<void*, alignments.size()> blocks {};
+	for (size_t i {}; i < blocks.size(); ++i)
+	{
+		blocks[i] = tlsfHeap.allocateAligned(alignments[i], 10);
+		if (blocks[i] == nullptr || reinterpret_cast<uintptr_t>(blocks[i]) % alignments[i] != 0 ||
+				reinterpret_cast<uintptr_t>(blocks[i]) % TlsfHeap::alignment != 0 ||
+				TlsfHeap::getUsableSize(blocks[i]) < 10)
+			return false;
+
+		memset(blocks[i], static_cast<int>(i), TlsfHeap::getUsableSize(blocks[i]));
+	}
+
+	for (size_t i {}; i < blocks.size(); ++i)
+		for (size_t j {}; j < TlsfHeap::getUsableSize(blocks[i]); ++j)
+			if (static_cast<uint8_t*>(blocks[i])[j] != i)
+				return false;
+
+	for (const auto block : blocks)
+		tlsfHeap.deallocate(block);
+	tlsfHeap.deallocate(firstBlock);
+
+	return isEmpty(tlsfHeap, 1, totalSize) == true && tlsfHeap.allocateAligned(firstRegionSize, 1) == nullptr;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests in-place resizing of blocks.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	constexpr size_t totalSize {firstRegionSize - regionOverhead};
+	constexpr size_t size {4 * TlsfHeap::alignment};
+
+	TlsfHeap tlsfHeap;
+	if (tlsfHeap.addRegion(firstRegion, sizeof(firstRegion)) != true)
+		return false;
+
+	const auto block = tlsfHeap.allocate(size);
+	const auto nextBlock = tlsfHeap.allocate(size);
+	const auto lastBlock = tlsfHeap.allocate(size);
+	if (block == nullptr || nextBlock == nullptr || lastBlock == nullptr)
+		return false;
+
+	memset(block, 0x5a, size);
+
+	// next block is used - growing is not possible, shrinking is always possible
+	if (tlsfHeap.resize(block, size + 1) != false || TlsfHeap::getUsableSize(block) != size ||
+			tlsfHeap.resize(block, size - 2 * TlsfHeap::alignment) != true ||
+			TlsfHeap::getUsableSize(block) != size - 2 * TlsfHeap::alignment ||
+			tlsfHeap.getStatistics().freeBlocks != 2)
+		return false;
+
+	// free space after the block is large enough after next block is freed, block is not trimmed if the tail would be
+	// too small
+	tlsfHeap.deallocate(nextBlock);
+	if (tlsfHeap.resize(block, 2 * size) != true || TlsfHeap::getUsableSize(block) < 2 * size)
+		return false;
+
+	const auto grownSize = TlsfHeap::getUsableSize(block);
+	if (tlsfHeap.resize(block, 3 * size) != false || TlsfHeap::getUsableSize(block) != grownSize)
+		return false;
+
+	// contents of block are preserved
+	for (size_t i {}; i < size - 2 * TlsfHeap::alignment; ++i)
+		if (static_cast<uint8_t*>(block)[i] != 0x5a)
+			return false;
+
+	// block may grow up to the end of region
+	tlsfHeap.deallocate(lastBlock);
+	if (tlsfHeap.resize(block, totalSize) != true || TlsfHeap::getUsableSize(block) != totalSize ||
+			tlsfHeap.getStatistics().freeBlocks != 0 || tlsfHeap.getStatistics().maxUsedSize != totalSize ||
+			tlsfHeap.resize(block, totalSize + 1) != false)
+		return false;
+
+	tlsfHeap.deallocate(block);
+	return isEmpty(tlsfHeap, 1, totalSize);
+}
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests heap with multiple regions.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	constexpr size_t firstTotalSize {firstRegionSize - regionOverhead};
+	constexpr size_t secondTotalSize {secondRegionSize - regionOverhead};
+	constexpr size_t totalSize {firstTotalSize + secondTotalSize};
+
+	{
+		TlsfHeap tlsfHeap;
+		// misaligned beginning and end of region are trimmed
+		if (tlsfHeap.addRegion(firstRegion + 1, sizeof(firstRegion) - 1) != true ||
+				isEmpty(tlsfHeap, 1, firstTotalSize - TlsfHeap::alignment) != true)
+			return false;
+	}
+
+	TlsfHeap tlsfHeap;
+	if (tlsfHeap.addRegion(firstRegion, sizeof(firstRegion)) != true ||
+			tlsfHeap.addRegion(secondRegion, sizeof(secondRegion)) != true || isEmpty(tlsfHeap, 2, totalSize) != true ||
+			tlsfHeap.getStatistics().largestFreeBlockSize != firstTotalSize)
+		return false;
+
+	// block which doesn't fit in any region can't be allocated, even if there's enough free space in total
+	if (tlsfHeap.allocate(firstTotalSize + TlsfHeap::alignment) != nullptr)
+		return false;
+
+	// only the first region is large enough for the first block, the space which remains there is too small for the
+	// second block, so it must be taken from the second region
+	const auto firstBlock = tlsfHeap.allocate(firstTotalSize - secondTotalSize);
+	const auto secondBlock = tlsfHeap.allocate(secondTotalSize);
+	if (firstBlock < firstRegion || firstBlock >= firstRegion + sizeof(firstRegion) || secondBlock < secondRegion ||
+			secondBlock >= secondRegion + sizeof(secondRegion))
+		return false;
+
+	tlsfHeap.deallocate(firstBlock);
+	tlsfHeap.deallocate(secondBlock);
+
+	// free blocks from different regions are never merged
+	return isEmpty(tlsfHeap, 2, totalSize) == true && tlsfHeap.getStatistics().largestFreeBlockSize == firstTotalSize;
+}
+
+#ifdef CONFIG_TLSF_HEAP_ENABLE
+
+/**
+ * \brief Phase 5 of test case.
+ *
+ * Tests malloc() and memalign(), which use TlsfHeap when CONFIG_TLSF_HEAP_ENABLE is selected.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase5()
+{
+	const auto heapStatistics = statistics::getHeapStatistics();
+
+	// block larger than the whole heap can't be allocated, errno of current thread is set
+	errno = 0;
+	if (malloc(heapStatistics.totalSize + 1) != nullptr || errno != ENOMEM)
+		return false;
+
+	errno = 0;
+	if (memalign(64, heapStatistics.totalSize + 1) != nullptr || errno != ENOMEM)
+		return false;
+
+	const auto block = memalign(64, 100);
+	const auto ret = block != nullptr && reinterpret_cast<uintptr_t>(block) % 64 == 0 &&
+			statistics::getHeapStatistics().usedBlocks == heapStatistics.usedBlocks + 1;
+	free(block);
+	return ret == true && statistics::getHeapStatistics().usedBlocks == heapStatistics.usedBlocks;
+}
+
+#endif	// def CONFIG_TLSF_HEAP_ENABLE
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool TlsfHeapOperationsTestCase::run_() const
+{
+#ifdef CONFIG_TLSF_HEAP_ENABLE
+	for (const auto& function : {phase1, phase2, phase3, phase4, phase5})
+#else	// !def CONFIG_TLSF_HEAP_ENABLE
+	for (const auto& function : {phase1, phase2, phase3, phase4})
+#endif	// !def CONFIG_TLSF_HEAP_ENABLE
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
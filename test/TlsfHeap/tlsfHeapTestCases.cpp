@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief tlsfHeapTestCases object definition
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "tlsfHeapTestCases.hpp"
+
+#include "TlsfHeapOperationsTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// TlsfHeapOperationsTestCase instance
+const TlsfHeapOperationsTestCase operationsTestCase;
+
+/// array with references to TestCase objects related to TLSF heap
+const TestCaseGroup::Range::value_type tlsfHeapTestCases_[]
+{
+		TestCaseGroup::Range::value_type{operationsTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup tlsfHeapTestCases {TestCaseGroup::Range{tlsfHeapTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,339 @@
+/**
+ * \file
+ * \brief TraceOperationsTestCase class implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "TraceOperationsTestCase.hpp"
+
+#include "distortos/trace.hpp"
+
+#ifdef CONFIG_TRACE_ENABLE
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include "distortos/Mutex.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+#include "distortos/StaticThread.hpp"
+#include "distortos/statistics.hpp"
+#include "distortos/ThisThread.hpp"
+#include "distortos/ThreadState.hpp"
+
+#include <functional>
+
+#endif	// def CONFIG_TRACE_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef CONFIG_TRACE_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local types
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// expected event - type, object and argument, timestamp is not checked
+struct ExpectedEvent
+{
+	/// type of event
+	trace::EventType type;
+
+	/// object related to the event
+	uint32_t object;
+
+	/// additional argument
+	uint8_t argument;
+};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// size of stack of test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/// identifier of interrupt used in test
+constexpr uint32_t testInterruptIdentifier {0x1234};
+
+/// max number of events read in single phase
+constexpr size_t maxEvents {256};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// buffer for events read in single phase
+trace::Event events[maxEvents];
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Converts pointer to object identifier used in trace events.
+ *
+ * \param [in] object is a pointer to object
+ *
+ * \return identifier of \a object used in trace events
+ */
+
+uint32_t getIdentifier(const void* const object)
+{
+	return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(object));
+}
+
+/**
+ * \brief Reads and discards all events from the buffer.
+ */
+
+void drain()
+{
+	while (trace::read(events, sizeof(events)) != 0);
+}
+
+/**
+ * \brief Reads events from the buffer and checks whether they contain expected events in expected order.
+ *
+ * Other events (for example from "tick" interrupt) may appear between expected ones. Timestamps of all events must be
+ * non-decreasing (modulo 2^32).
+ *
+ * \param [in] expectedEventsBegin is a pointer to first expected event
+ * \param [in] expectedEventsEnd is a pointer to one-past-the-last expected event
+ *
+ * \return true if all expected events were found in expected order and timestamps are valid, false otherwise
+ */
+
+bool checkEvents(const ExpectedEvent* const expectedEventsBegin, const ExpectedEvent* const expectedEventsEnd)
+{
+	const auto count = trace::read(events, sizeof(events)) / sizeof(*events);
+	if (count == maxEvents)	// buffer for events may be too small to hold all of them
+		return false;
+
+	auto expectedEvent = expectedEventsBegin;
+	for (size_t i {}; i < count; ++i)
+	{
+		if (i != 0 && events[i].timestamp - events[i - 1].timestamp > INT32_MAX)
+			return false;
+
+		if (expectedEvent != expectedEventsEnd && events[i].type == expectedEvent->type &&
+				events[i].object == expectedEvent->object && events[i].argument == expectedEvent->argument)
+			++expectedEvent;
+	}
+
+	return expectedEvent == expectedEventsEnd;
+}
+
+/**
+ * \brief Reads events from the buffer and checks whether they contain expected events in expected order.
+ *
+ * \tparam N is the number of expected events
+ *
+ * \param [in] expectedEvents is a reference to array with expected events
+ *
+ * \return true if all expected events were found in expected order and timestamps are valid, false otherwise
+ */
+
+template<size_t N>
+bool checkEvents(const ExpectedEvent (&expectedEvents)[N])
+{
+	return checkEvents(expectedEvents, expectedEvents + N);
+}
+
+/**
+ * \brief Test thread.
+ *
+ * Tries to wait for the semaphore (which fails), waits for the semaphore, then locks and unlocks the mutex. Unlocking
+ * of the mutex which is not locked is attempted at the end (which fails for error-checking mutex). Failed operations
+ * must not be traced.
+ *
+ * \param [in] semaphore is a reference to semaphore for which the thread waits
+ * \param [in] mutex is a reference to mutex which is locked and unlocked
+ */
+
+void thread(Semaphore& semaphore, Mutex& mutex)
+{
+	semaphore.tryWait();
+	semaphore.wait();
+	mutex.lock();
+	mutex.unlock();
+	mutex.unlock();
+}
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests header of binary trace.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	const auto header = trace::getHeader();
+	return header.magic == 0x43525444 && header.version == 1 && header.eventSize == sizeof(trace::Event) &&
+			header.frequency == statistics::getRunTimeFrequency() && header.reserved == 0;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests events related to threads, semaphores and mutexes.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	Semaphore semaphore {0};
+	Mutex mutex {Mutex::Type::errorChecking};
+	auto testThread = makeStaticThread<testThreadStackSize>(UINT8_MAX, thread, std::ref(semaphore), std::ref(mutex));
+
+	drain();
+
+	if (testThread.start() != 0)
+		return false;
+	if (semaphore.post() != 0)
+		return false;
+	if (testThread.join() != 0)
+		return false;
+
+	const auto mainThread = getIdentifier(&ThisThread::get());
+	const auto testThreadIdentifier = getIdentifier(&static_cast<Thread&>(testThread));
+	const auto semaphoreIdentifier = getIdentifier(&semaphore);
+	const auto mutexIdentifier = getIdentifier(&mutex);
+	const ExpectedEvent expectedEvents[]
+	{
+			{trace::EventType::contextSwitch, testThreadIdentifier, {}},
+			{trace::EventType::threadBlock, testThreadIdentifier,
+					static_cast<uint8_t>(ThreadState::blockedOnSemaphore)},
+			{trace::EventType::contextSwitch, mainThread, {}},
+			{trace::EventType::threadUnblock, testThreadIdentifier, {}},
+			{trace::EventType::semaphorePost, semaphoreIdentifier, {}},
+			{trace::EventType::contextSwitch, testThreadIdentifier, {}},
+			{trace::EventType::semaphoreWait, semaphoreIdentifier, {}},
+			{trace::EventType::mutexLock, mutexIdentifier, {}},
+			{trace::EventType::mutexUnlock, mutexIdentifier, {}},
+			{trace::EventType::contextSwitch, mainThread, {}},
+	};
+	return checkEvents(expectedEvents);
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests events related to software timers and interrupts.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	auto softwareTimer = makeStaticSoftwareTimer([](){});
+
+	waitForNextTick();
+	drain();
+
+	trace::enterInterrupt(testInterruptIdentifier);
+	trace::record(trace::EventType::user, testInterruptIdentifier, 0x56);
+	trace::exitInterrupt(testInterruptIdentifier);
+
+	if (softwareTimer.start(TickClock::duration{1}) != 0)
+		return false;
+	while (softwareTimer.isRunning() == true);
+
+	const ExpectedEvent expectedEvents[]
+	{
+			{trace::EventType::interruptEnter, testInterruptIdentifier, {}},
+			{trace::EventType::user, testInterruptIdentifier, 0x56},
+			{trace::EventType::interruptExit, testInterruptIdentifier, {}},
+			{trace::EventType::interruptEnter, trace::tickInterruptIdentifier, {}},
+			{trace::EventType::softwareTimerExpiry, getIdentifier(&static_cast<SoftwareTimer&>(softwareTimer)), {}},
+			{trace::EventType::interruptExit, trace::tickInterruptIdentifier, {}},
+	};
+	return checkEvents(expectedEvents);
+}
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests dropping of events when the buffer is full.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	constexpr size_t extraEvents {10};
+
+	// interrupts are masked, so no other events are recorded during this phase
+	const architecture::InterruptMaskingLock interruptMaskingLock;
+
+	drain();
+
+	const auto droppedEventCount = trace::getDroppedEventCount();
+
+	for (size_t i {}; i < CONFIG_TRACE_BUFFER_EVENTS + extraEvents; ++i)
+		trace::record(trace::EventType::user, i);
+
+	if (trace::getDroppedEventCount() - droppedEventCount != extraEvents)
+		return false;
+
+	size_t readEvents {};
+	size_t size;
+	while ((size = trace::read(events, sizeof(events))) != 0)
+	{
+		if (size % sizeof(*events) != 0)
+			return false;
+
+		// events which were not dropped must be read in the order in which they were recorded
+		for (size_t i {}; i < size / sizeof(*events); ++i)
+			if (events[i].type != trace::EventType::user || events[i].object != readEvents + i)
+				return false;
+
+		readEvents += size / sizeof(*events);
+	}
+
+	return readEvents == CONFIG_TRACE_BUFFER_EVENTS;
+}
+
+}	// namespace
+
+#endif	// def CONFIG_TRACE_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool TraceOperationsTestCase::run_() const
+{
+#ifdef CONFIG_TRACE_ENABLE
+
+	for (const auto& function : {phase1, phase2, phase3, phase4})
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+#endif	// def CONFIG_TRACE_ENABLE
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
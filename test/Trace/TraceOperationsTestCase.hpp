@@ -0,0 +1,47 @@
+/**
+ * \file
+ * \brief TraceOperationsTestCase class header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_TRACE_TRACEOPERATIONSTESTCASE_HPP_
+#define TEST_TRACE_TRACEOPERATIONSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests tracing of kernel events.
+ *
+ * Tests header of binary trace, recording of events related to threads, synchronization objects, software timers and
+ * interrupts, order of events and their timestamps, as well as dropping of events when the buffer is full.
+ */
+
+class TraceOperationsTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_TRACE_TRACEOPERATIONSTESTCASE_HPP_
@@ -0,0 +1,200 @@
+/**
+ * \file
+ * \brief MpuStackGuardTestCase class implementation for ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "ARMv7-M-MpuStackGuardTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+#include "distortos/architecture/Stack.hpp"
+
+#include "distortos/chip/CMSIS-proxy.h"
+
+#include "distortos/DynamicThread.hpp"
+
+#endif	// def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of MPU region used for stack guard
+constexpr uint8_t stackGuardMpuRegion {7};
+
+/// DACCVIOL bit of MMFSR - data access violation
+constexpr uint32_t mmfsrDaccviol {1 << 1};
+
+/// MMARVALID bit of MMFSR - MMFAR holds valid fault address
+constexpr uint32_t mmfsrMmarvalid {1 << 7};
+
+/// size of stack for test thread, bytes
+constexpr size_t testThreadStackSize {512};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// true if MemManage fault is expected, false otherwise
+volatile bool faultExpected;
+
+/// address of last MemManage fault caused by data access violation, 0 if no such fault occurred
+volatile uint32_t faultAddress;
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Gets current address of MPU stack guard.
+ *
+ * \return current address of MPU region used for stack guard
+ */
+
+uint32_t getStackGuard()
+{
+	const architecture::InterruptMaskingLock interruptMaskingLock;
+	MPU->RNR = stackGuardMpuRegion;
+	return MPU->RBAR & MPU_RBAR_ADDR_Msk;
+}
+
+/**
+ * \brief Writes 0 to given address and checks whether this caused MemManage fault.
+ *
+ * Store instruction is always 4 bytes long, so MemManage_Handler() can skip it.
+ *
+ * \param [in] address is the address to which 0 will be written
+ *
+ * \return address of MemManage fault caused by the write, 0 if no fault occurred
+ */
+
+uint32_t tryWrite(const uint32_t address)
+{
+	faultAddress = {};
+	faultExpected = true;
+	asm volatile
+	(
+			"	str.w		%[value], [%[address]]			\n"
+
+			::	[value] "r" (0), [address] "r" (address)
+			:	"memory"
+	);
+	faultExpected = false;
+	return faultAddress;
+}
+
+/**
+ * \brief Test thread
+ *
+ * Checks whether current MPU stack guard is located just below its stack, writes to the highest word of its own guard
+ * (which must cause MemManage fault) and then to the highest word of \a otherStackGuard (which must not cause any
+ * fault).
+ *
+ * In case of failure \a sharedResult is set to "false", otherwise it is not modified.
+ *
+ * \param [in] otherStackGuard is the address of MPU stack guard of test case's thread
+ * \param [out] sharedResult is a reference to variable with shared result of the test
+ */
+
+void thread(const uint32_t otherStackGuard, bool& sharedResult)
+{
+	const auto stackGuardEnd = getStackGuard() + architecture::stackGuardSize;
+	const auto stackPointer = reinterpret_cast<uint32_t>(&stackGuardEnd);
+	if (stackGuardEnd == otherStackGuard + architecture::stackGuardSize || stackPointer < stackGuardEnd ||
+			stackPointer >= stackGuardEnd + testThreadStackSize)
+	{
+		sharedResult = false;
+		return;
+	}
+
+	const auto ownTarget = stackGuardEnd - sizeof(uint32_t);
+	if (tryWrite(ownTarget) != ownTarget)
+		sharedResult = false;
+
+	const auto otherTarget = otherStackGuard + architecture::stackGuardSize - sizeof(uint32_t);
+	if (tryWrite(otherTarget) != 0)
+		sharedResult = false;
+}
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief MemManage_Handler() for MpuStackGuardTestCase
+ *
+ * If the fault is expected and it was caused by data access violation, then its address is saved, the fault is
+ * cleared and faulting 4-byte instruction is skipped. Otherwise the handler loops forever, just like the default one.
+ */
+
+extern "C" void MemManage_Handler()
+{
+	const auto mmfsr = SCB->CFSR & SCB_CFSR_MEMFAULTSR_Msk;
+	if (faultExpected == false || (mmfsr & (mmfsrDaccviol | mmfsrMmarvalid)) != (mmfsrDaccviol | mmfsrMmarvalid))
+		while (1);
+
+	faultAddress = SCB->MMFAR;
+	SCB->CFSR = mmfsr;	// clear all MemManage fault status bits
+	const auto exceptionStackFrame = reinterpret_cast<uint32_t*>(__get_PSP());
+	exceptionStackFrame[6] += 4;	// skip faulting instruction - stacked pc is the 7th word of exception stack frame
+}
+
+#endif	// def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool MpuStackGuardTestCase::run_() const
+{
+#ifdef CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+	if ((MPU->CTRL & MPU_CTRL_ENABLE_Msk) == 0)
+		return false;
+
+	const auto stackGuard = getStackGuard();
+	if (reinterpret_cast<uint32_t>(&stackGuard) < stackGuard + architecture::stackGuardSize)
+		return false;
+
+	bool sharedResult {true};
+	auto testThread = makeAndStartDynamicThread({testThreadStackSize, UINT8_MAX}, thread, stackGuard,
+			std::ref(sharedResult));
+	testThread.join();
+
+	if (getStackGuard() != stackGuard)
+		return false;
+
+	return sharedResult;
+
+#else	// !def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+
+	return true;
+
+#endif	// !def CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE
+}
+
+}	// namespace test
+
+}	// namespace distortos
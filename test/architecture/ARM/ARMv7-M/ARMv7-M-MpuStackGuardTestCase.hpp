@@ -0,0 +1,65 @@
+/**
+ * \file
+ * \brief MpuStackGuardTestCase class header for ARMv7-M
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_ARCHITECTURE_ARM_ARMV7_M_ARMV7_M_MPUSTACKGUARDTESTCASE_HPP_
+#define TEST_ARCHITECTURE_ARM_ARMV7_M_ARMV7_M_MPUSTACKGUARDTESTCASE_HPP_
+
+#include "PrioritizedTestCase.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests MPU stack guard.
+ *
+ * Checks whether MPU stack guard is moved during context switches so that it is located just below the stack of current
+ * thread. Test thread writes to the guard of its own stack - which must cause MemManage fault - and to the guard of
+ * test case's thread - which must not cause any fault, as only the guard of current thread is active.
+ *
+ * Test is skipped if CONFIG_ARCHITECTURE_ARMV7_M_MPU_STACK_GUARD_ENABLE is not defined.
+ */
+
+class MpuStackGuardTestCase : public PrioritizedTestCase
+{
+	/// priority at which this test case should be executed
+	constexpr static uint8_t testCasePriority_ {UINT8_MAX - 1};
+
+public:
+
+	/**
+	 * \brief MpuStackGuardTestCase's constructor
+	 */
+
+	constexpr MpuStackGuardTestCase() :
+			PrioritizedTestCase{testCasePriority_}
+	{
+
+	}
+
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_ARCHITECTURE_ARM_ARMV7_M_ARMV7_M_MPUSTACKGUARDTESTCASE_HPP_
@@ -2,7 +2,7 @@
  * \file
  * \brief architectureTestCases object definition for ARMv7-M
  *
- * \author Copyright (C) 2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2015-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -13,6 +13,7 @@
 
 #include "ARMv7-M-FpuThreadTestCase.hpp"
 #include "ARMv7-M-FpuSignalTestCase.hpp"
+#include "ARMv7-M-MpuStackGuardTestCase.hpp"
 
 #include "TestCaseGroup.hpp"
 
@@ -35,11 +36,15 @@ const FpuThreadTestCase fpuThreadTestCase;
 /// FpuSignalTestCase instance
 const FpuSignalTestCase fpuSignalTestCase;
 
+/// MpuStackGuardTestCase instance
+const MpuStackGuardTestCase mpuStackGuardTestCase;
+
 /// array with references to architecture-specific test cases
 const TestCaseGroup::Range::value_type threadTestCases_[]
 {
 		TestCaseGroup::Range::value_type{fpuThreadTestCase},
 		TestCaseGroup::Range::value_type{fpuSignalTestCase},
+		TestCaseGroup::Range::value_type{mpuStackGuardTestCase},
 };
 
 }	// namespace
@@ -0,0 +1,311 @@
+/**
+ * \file
+ * \brief ExclusiveAccessTestCase class implementation for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "POSIX-ExclusiveAccessTestCase.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION
+
+#include "waitForNextTick.hpp"
+
+#include "distortos/architecture/exclusiveAccess.hpp"
+#include "distortos/architecture/InterruptMaskingLock.hpp"
+
+#include "distortos/callOnce.hpp"
+#include "distortos/Mutex.hpp"
+#include "distortos/Semaphore.hpp"
+#include "distortos/StaticSoftwareTimer.hpp"
+
+#include <cerrno>
+
+#endif	// def CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION
+
+namespace distortos
+{
+
+namespace test
+{
+
+#ifdef CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local constants
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// number of failures of exclusive stores forced in each operation
+constexpr unsigned int forcedFailures {3};
+
+/// number of executions of software timer in phase 5
+constexpr unsigned int phase5SoftwareTimerExecutions {10};
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * \brief Phase 1 of test case.
+ *
+ * Tests the emulated exclusive monitor. With interrupts masked storeExclusive() must succeed only if it is preceded by
+ * loadExclusive() of the same object, with no clearExclusive(), no other storeExclusive() and no forced failure in
+ * between. Without interrupt masking storeExclusive() must fail if there was a context switch after loadExclusive().
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase1()
+{
+	uint32_t object {1};
+	uint32_t otherObject {};
+
+	{
+		const architecture::InterruptMaskingLock interruptMaskingLock;
+
+		if (architecture::loadExclusive(object) != 1 || architecture::storeExclusive(object, uint32_t{2}) != true ||
+				object != 2)
+			return false;
+
+		// monitor is cleared by successful store
+		if (architecture::storeExclusive(object, uint32_t{3}) != false || object != 2)
+			return false;
+
+		architecture::loadExclusive(object);
+		architecture::clearExclusive();
+		if (architecture::storeExclusive(object, uint32_t{3}) != false || object != 2)
+			return false;
+
+		architecture::loadExclusive(object);
+		if (architecture::storeExclusive(otherObject, uint32_t{3}) != false || otherObject != 0)
+			return false;
+
+		// monitor is cleared also by failed store
+		if (architecture::storeExclusive(object, uint32_t{3}) != false || object != 2)
+			return false;
+
+		architecture::forcedExclusiveStoreFailures = 1;
+		architecture::loadExclusive(object);
+		if (architecture::storeExclusive(object, uint32_t{3}) != false || object != 2 ||
+				architecture::forcedExclusiveStoreFailures != 0)
+			return false;
+
+		architecture::loadExclusive(object);
+		if (architecture::storeExclusive(object, uint32_t{3}) != true || object != 3)
+			return false;
+	}
+
+	architecture::loadExclusive(object);
+	waitForNextTick();
+	if (architecture::storeExclusive(object, uint32_t{4}) != false || object != 3)
+		return false;
+
+	return true;
+}
+
+/**
+ * \brief Phase 2 of test case.
+ *
+ * Tests fast paths of Semaphore with forced failures of exclusive stores. Semaphore::post() and Semaphore::tryWait()
+ * must retry the exclusive sequence until it succeeds and change the value of semaphore exactly once. Semaphore::
+ * tryWait() on a semaphore with value 0 must not attempt any exclusive store.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase2()
+{
+	Semaphore semaphore {0};
+
+	architecture::forcedExclusiveStoreFailures = forcedFailures;
+	if (semaphore.post() != 0 || semaphore.getValue() != 1 || architecture::forcedExclusiveStoreFailures != 0)
+		return false;
+
+	architecture::forcedExclusiveStoreFailures = forcedFailures;
+	if (semaphore.tryWait() != 0 || semaphore.getValue() != 0 || architecture::forcedExclusiveStoreFailures != 0)
+		return false;
+
+	architecture::forcedExclusiveStoreFailures = forcedFailures;
+	const auto ret = semaphore.tryWait();
+	const auto failures = architecture::forcedExclusiveStoreFailures;
+	architecture::forcedExclusiveStoreFailures = {};
+	if (ret != EAGAIN || semaphore.getValue() != 0 || failures != forcedFailures)
+		return false;
+
+	return true;
+}
+
+/**
+ * \brief Phase 3 of test case.
+ *
+ * Tests fast path of Mutex with forced failures of exclusive stores. Mutex::tryLock() of unlocked mutex without any
+ * protocol must retry the exclusive sequence until it succeeds. Mutex::tryLock() of locked mutex and of mutex with
+ * priority inheritance must not attempt any exclusive store.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase3()
+{
+	{
+		Mutex mutex {Mutex::Type::normal, Mutex::Protocol::none};
+
+		architecture::forcedExclusiveStoreFailures = forcedFailures;
+		if (mutex.tryLock() != 0 || architecture::forcedExclusiveStoreFailures != 0)
+			return false;
+
+		architecture::forcedExclusiveStoreFailures = forcedFailures;
+		const auto ret = mutex.tryLock();
+		const auto failures = architecture::forcedExclusiveStoreFailures;
+		architecture::forcedExclusiveStoreFailures = {};
+		if (ret != EBUSY || failures != forcedFailures)
+			return false;
+
+		if (mutex.unlock() != 0)
+			return false;
+
+		// mutex must be unlocked and available for the fast path again
+		if (mutex.tryLock() != 0 || mutex.unlock() != 0)
+			return false;
+	}
+
+	{
+		Mutex mutex {Mutex::Type::normal, Mutex::Protocol::priorityInheritance};
+
+		architecture::forcedExclusiveStoreFailures = forcedFailures;
+		const auto ret = mutex.tryLock();
+		const auto failures = architecture::forcedExclusiveStoreFailures;
+		architecture::forcedExclusiveStoreFailures = {};
+		if (ret != 0 || failures != forcedFailures)
+			return false;
+
+		if (mutex.unlock() != 0)
+			return false;
+	}
+
+	return true;
+}
+
+#if DISTORTOS_CALLONCE_SUPPORTED == 1
+
+/**
+ * \brief Phase 4 of test case.
+ *
+ * Tests fast path of callOnce() with forced failures of exclusive stores. First call must retry the exclusive sequence
+ * which claims the execution until it succeeds, execute the function exactly once and release the flag without any
+ * more failures. Second call must not attempt any exclusive store and must not execute the function.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase4()
+{
+	OnceFlag onceFlag;
+	unsigned int counter {};
+
+	architecture::forcedExclusiveStoreFailures = forcedFailures;
+	callOnce(onceFlag,
+			[&counter]()
+			{
+				++counter;
+			});
+	if (counter != 1 || architecture::forcedExclusiveStoreFailures != 0)
+		return false;
+
+	architecture::forcedExclusiveStoreFailures = forcedFailures;
+	callOnce(onceFlag,
+			[&counter]()
+			{
+				++counter;
+			});
+	const auto failures = architecture::forcedExclusiveStoreFailures;
+	architecture::forcedExclusiveStoreFailures = {};
+	if (counter != 1 || failures != forcedFailures)
+		return false;
+
+	return true;
+}
+
+#endif	// DISTORTOS_CALLONCE_SUPPORTED == 1
+
+/**
+ * \brief Phase 5 of test case.
+ *
+ * Executes fast paths of Semaphore::post() and Semaphore::tryWait() in a loop, while a periodic software timer posts
+ * the same semaphore. Interrupts which clear the exclusive monitor between loadExclusive() and storeExclusive() must
+ * cause retries, not lost updates - final value of semaphore must be equal to the number of executions of software
+ * timer.
+ *
+ * \return true if test succeeded, false otherwise
+ */
+
+bool phase5()
+{
+	Semaphore semaphore {0};
+	volatile unsigned int executions {};
+	auto softwareTimer = makeStaticSoftwareTimer(
+			[&semaphore, &executions]()
+			{
+				if (executions < phase5SoftwareTimerExecutions)
+				{
+					semaphore.post();
+					++executions;
+				}
+			});
+
+	waitForNextTick();
+	softwareTimer.start(TickClock::duration{1}, TickClock::duration{1});
+
+	bool result {true};
+	while (executions < phase5SoftwareTimerExecutions)
+		if (semaphore.post() != 0 || semaphore.tryWait() != 0)
+			result = false;
+
+	softwareTimer.stop();
+
+	if (result != true || semaphore.getValue() != phase5SoftwareTimerExecutions)
+		return false;
+
+	return true;
+}
+
+}	// namespace
+
+#endif	// def CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| private functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+bool ExclusiveAccessTestCase::run_() const
+{
+#ifdef CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION
+
+#if DISTORTOS_CALLONCE_SUPPORTED == 1
+	for (const auto& function : {phase1, phase2, phase3, phase4, phase5})
+#else	// DISTORTOS_CALLONCE_SUPPORTED != 1
+	for (const auto& function : {phase1, phase2, phase3, phase5})
+#endif	// DISTORTOS_CALLONCE_SUPPORTED != 1
+	{
+		const auto ret = function();
+		if (ret != true)
+			return ret;
+	}
+
+#endif	// def CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION
+
+	return true;
+}
+
+}	// namespace test
+
+}	// namespace distortos
@@ -0,0 +1,52 @@
+/**
+ * \file
+ * \brief ExclusiveAccessTestCase class header for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_ARCHITECTURE_POSIX_POSIX_EXCLUSIVEACCESSTESTCASE_HPP_
+#define TEST_ARCHITECTURE_POSIX_POSIX_EXCLUSIVEACCESSTESTCASE_HPP_
+
+#include "TestCaseCommon.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Tests emulated exclusive access and lock-free fast paths of synchronization objects.
+ *
+ * Checks whether the emulated exclusive monitor is cleared by clearExclusive(), by each storeExclusive() and by
+ * interrupts. Then forces failures of exclusive stores in the fast paths of Semaphore, Mutex and callOnce(), asserting
+ * that the sequences are retried until they succeed - without changing the result of the operation - and that the fast
+ * paths are not used when they must not be. At the end the fast paths of Semaphore are executed in a loop while a
+ * periodic software timer posts the same semaphore, which must not lose any of these posts.
+ *
+ * Test is skipped if CONFIG_ARCHITECTURE_POSIX_EXCLUSIVE_ACCESS_EMULATION is not defined.
+ */
+
+class ExclusiveAccessTestCase : public TestCaseCommon
+{
+private:
+
+	/**
+	 * \brief Runs the test case.
+	 *
+	 * \return true if the test case succeeded, false otherwise
+	 */
+
+	bool run_() const override;
+};
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_ARCHITECTURE_POSIX_POSIX_EXCLUSIVEACCESSTESTCASE_HPP_
@@ -0,0 +1,50 @@
+/**
+ * \file
+ * \brief architectureTestCases object definition for POSIX
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "architecture/architectureTestCases.hpp"
+
+#include "POSIX-ExclusiveAccessTestCase.hpp"
+
+#include "TestCaseGroup.hpp"
+
+namespace distortos
+{
+
+namespace test
+{
+
+namespace
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| local objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+/// ExclusiveAccessTestCase instance
+const ExclusiveAccessTestCase exclusiveAccessTestCase;
+
+/// array with references to architecture-specific test cases
+const TestCaseGroup::Range::value_type threadTestCases_[]
+{
+		TestCaseGroup::Range::value_type{exclusiveAccessTestCase},
+};
+
+}	// namespace
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global objects
++---------------------------------------------------------------------------------------------------------------------*/
+
+const TestCaseGroup architectureTestCases {TestCaseGroup::Range{threadTestCases_}};
+
+}	// namespace test
+
+}	// namespace distortos
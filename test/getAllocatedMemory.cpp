@@ -0,0 +1,62 @@
+/**
+ * \file
+ * \brief getAllocatedMemory() implementation
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include "getAllocatedMemory.hpp"
+
+#include "distortos/distortosConfiguration.h"
+
+#ifdef CONFIG_TLSF_HEAP_ENABLE
+
+#include "distortos/statistics.hpp"
+
+#else	// !def CONFIG_TLSF_HEAP_ENABLE
+
+#include <malloc.h>
+
+#endif	// !def CONFIG_TLSF_HEAP_ENABLE
+
+namespace distortos
+{
+
+namespace test
+{
+
+/*---------------------------------------------------------------------------------------------------------------------+
+| global functions
++---------------------------------------------------------------------------------------------------------------------*/
+
+size_t getAllocatedMemory()
+{
+#ifdef CONFIG_TLSF_HEAP_ENABLE
+
+	// malloc() uses TlsfHeap instead of newlib's allocator, so mallinfo() doesn't know about allocated blocks
+	const auto heapStatistics = statistics::getHeapStatistics();
+	return heapStatistics.totalSize - heapStatistics.freeSize;
+
+#else	// !def CONFIG_TLSF_HEAP_ENABLE
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+
+	// mallinfo() is deprecated since glibc 2.33, as its int fields may overflow
+	return mallinfo2().uordblks;
+
+#else	// !defined(__GLIBC__) || __GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 33)
+
+	return mallinfo().uordblks;
+
+#endif	// !defined(__GLIBC__) || __GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 33)
+
+#endif	// !def CONFIG_TLSF_HEAP_ENABLE
+}
+
+}	// namespace test
+
+}	// namespace distortos
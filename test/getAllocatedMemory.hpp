@@ -0,0 +1,35 @@
+/**
+ * \file
+ * \brief getAllocatedMemory() header
+ *
+ * \author Copyright (C) 2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ *
+ * \par License
+ * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
+ * distributed with this file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#ifndef TEST_GETALLOCATEDMEMORY_HPP_
+#define TEST_GETALLOCATEDMEMORY_HPP_
+
+#include <cstddef>
+
+namespace distortos
+{
+
+namespace test
+{
+
+/**
+ * \brief Gets number of bytes allocated from the heap.
+ *
+ * \return total number of bytes in all blocks which are currently allocated from the heap
+ */
+
+size_t getAllocatedMemory();
+
+}	// namespace test
+
+}	// namespace distortos
+
+#endif	// TEST_GETALLOCATEDMEMORY_HPP_
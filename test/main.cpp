@@ -24,6 +24,8 @@
 
 #include "distortos/ThisThread.hpp"
 
+#include <cstdlib>
+
 /*---------------------------------------------------------------------------------------------------------------------+
 | global functions
 +---------------------------------------------------------------------------------------------------------------------*/
@@ -35,7 +37,7 @@
  * - success - slow blinking, 1Hz frequency,
  * - failure - fast blinking, 10Hz frequency.
  * If the board doesn't provide LEDs, the result can be examined with the debugger by checking the value of "result"
- * variable.
+ * variable. On POSIX host the result is returned as the exit status of the process.
  */
 
 int main()
@@ -43,6 +45,12 @@ int main()
 	// "volatile" to allow examination of the value with debugger - the variable will not be optimized out
 	const volatile auto result = distortos::test::testCases.run();
 
+#ifdef CONFIG_ARCHITECTURE_POSIX
+
+	return result == true ? EXIT_SUCCESS : EXIT_FAILURE;
+
+#endif	// def CONFIG_ARCHITECTURE_POSIX
+
 	// next line is a good place for a breakpoint that will be hit right after test cases
 	const auto duration = result == true ? std::chrono::milliseconds{500} : std::chrono::milliseconds{50};
 	while (1)
@@ -14,6 +14,9 @@
 
 #include <array>
 
+#include <cstddef>
+#include <cstdint>
+
 namespace distortos
 {
 
@@ -2,7 +2,7 @@
  * \file
  * \brief testCases object definition
  *
- * \author Copyright (C) 2014-2015 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
+ * \author Copyright (C) 2014-2016 Kamil Szczygiel http://www.distortec.com http://www.freddiechopin.info
  *
  * \par License
  * This Source Code Form is subject to the terms of the Mozilla Public License, v. 2.0. If a copy of the MPL was not
@@ -14,11 +14,18 @@
 #include "Thread/threadTestCases.hpp"
 #include "SoftwareTimer/softwareTimerTestCases.hpp"
 #include "Semaphore/semaphoreTestCases.hpp"
+#include "EventFlags/eventFlagsTestCases.hpp"
 #include "Mutex/mutexTestCases.hpp"
+#include "RwLock/rwLockTestCases.hpp"
 #include "ConditionVariable/conditionVariableTestCases.hpp"
 #include "Queue/queueTestCases.hpp"
 #include "Signals/signalsTestCases.hpp"
 #include "CallOnce/callOnceTestCases.hpp"
+#include "MemoryPool/memoryPoolTestCases.hpp"
+#include "MemoryResource/memoryResourceTestCases.hpp"
+#include "TlsfHeap/tlsfHeapTestCases.hpp"
+#include "Trace/traceTestCases.hpp"
+#include "Profiler/profilerTestCases.hpp"
 #include "architecture/architectureTestCases.hpp"
 
 #include "TestCaseGroup.hpp"
@@ -42,11 +49,18 @@ const TestCaseGroup::Range::value_type testCases_[]
 		TestCaseGroup::Range::value_type{threadTestCases},
 		TestCaseGroup::Range::value_type{softwareTimerTestCases},
 		TestCaseGroup::Range::value_type{semaphoreTestCases},
+		TestCaseGroup::Range::value_type{eventFlagsTestCases},
 		TestCaseGroup::Range::value_type{mutexTestCases},
+		TestCaseGroup::Range::value_type{rwLockTestCases},
 		TestCaseGroup::Range::value_type{conditionVariableTestCases},
 		TestCaseGroup::Range::value_type{queueTestCases},
 		TestCaseGroup::Range::value_type{signalsTestCases},
 		TestCaseGroup::Range::value_type{callOnceTestCases},
+		TestCaseGroup::Range::value_type{memoryPoolTestCases},
+		TestCaseGroup::Range::value_type{memoryResourceTestCases},
+		TestCaseGroup::Range::value_type{tlsfHeapTestCases},
+		TestCaseGroup::Range::value_type{traceTestCases},
+		TestCaseGroup::Range::value_type{profilerTestCases},
 		TestCaseGroup::Range::value_type{architectureTestCases},
 };
 